@@ -247,6 +247,27 @@ int msg_try_send(msg_t *m, kernel_pid_t target_pid);
  */
 int msg_send_to_self(msg_t *m);
 
+/**
+ * @brief Send multiple messages to a thread (non-blocking).
+ *
+ * Delivers as many of the @p num messages in @p m as possible, in order,
+ * with interrupts disabled only once. If the target is waiting for a
+ * message, the first message is delivered directly, all others are put into
+ * the target's message queue. The target is woken up at most once.
+ *
+ * Can be called from interrupt context. This function never blocks.
+ *
+ * @param[in] m             Array of @p num messages, the ``sender_pid`` of
+ *                          each delivered message is set by this function
+ * @param[in] num           Number of messages in @p m
+ * @param[in] target_pid    PID of target thread
+ *
+ * @return  number of messages delivered (0 if the receiver is not waiting
+ *          and its message queue is full or inexistent)
+ * @return  -1, on error (invalid PID)
+ */
+int msg_send_bulk(msg_t *m, unsigned num, kernel_pid_t target_pid);
+
 /**
  * Value of msg_t::sender_pid if the sender was an interrupt service routine.
  */
@@ -309,6 +330,23 @@ int msg_receive(msg_t *m);
  */
 int msg_try_receive(msg_t *m);
 
+/**
+ * @brief Receive multiple messages.
+ *
+ * Takes up to @p num messages from the thread's message queue, followed by
+ * the messages of threads blocked sending to this thread, with interrupts
+ * disabled only once. If no message is available, blocks until one is
+ * received and then takes any further messages that have been queued
+ * meanwhile.
+ *
+ * @param[out] m    Array of at least @p num preallocated ``msg_t``
+ *                  structures
+ * @param[in] num   Maximum number of messages to receive, must be > 0
+ *
+ * @return  number of messages received, at least 1
+ */
+int msg_receive_bulk(msg_t *m, unsigned num);
+
 /**
  * @brief Send a message, block until reply received.
  *
@@ -362,6 +400,17 @@ int msg_reply_int(msg_t *m, msg_t *reply);
  */
 int msg_avail(void);
 
+/**
+ * @brief Check how many messages are available in the message queue of
+ *        another thread
+ *
+ * @param[in] pid   PID of the thread
+ *
+ * @return Number of messages available in the queue of @p pid
+ * @return -1, if @p pid is no thread or its message queue is not initialized
+ */
+int msg_avail_thread(kernel_pid_t pid);
+
 /**
  * @brief Initialize the current thread's message queue.
  *
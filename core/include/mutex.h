@@ -11,6 +11,15 @@
  * @defgroup    core_sync Synchronization
  * @brief       Mutex for thread synchronization
  * @ingroup     core
+ *
+ * With the `core_mutex_priority_inheritance` module, a thread blocking on a
+ * locked mutex lends its priority to the mutex's owner until the owner
+ * unlocks it. If the owner is itself blocked on another mutex, the priority
+ * is passed on along the chain of owners. On unlock, the owner drops to the
+ * highest priority of the threads still waiting for any of the mutexes it
+ * owns, or to its own priority if there are none, so mutexes held at the
+ * same time may be unlocked in any order.
+ *
  * @{
  *
  * @file
@@ -25,6 +34,7 @@
 #include <stddef.h>
 
 #include "list.h"
+#include "kernel_types.h"
 
 #ifdef __cplusplus
  extern "C" {
@@ -40,18 +50,41 @@ typedef struct {
      * @internal
      */
     list_node_t queue;
+#if defined(MODULE_CORE_MUTEX_PRIORITY_INHERITANCE) || defined(DOXYGEN)
+    /**
+     * @brief   The current owner of the mutex, KERNEL_PID_UNDEF if unlocked.
+     *          **Must never be changed by the user.**
+     * @internal
+     */
+    kernel_pid_t owner;
+    /**
+     * @brief   Entry in the owner's list of mutexes
+     *          (thread_t::mutexes_held). **Must never be changed by the
+     *          user.**
+     * @internal
+     */
+    list_node_t owner_entry;
+#endif
 } mutex_t;
 
 /**
  * @brief Static initializer for mutex_t.
  * @details This initializer is preferable to mutex_init().
  */
+#ifdef MODULE_CORE_MUTEX_PRIORITY_INHERITANCE
+#define MUTEX_INIT { { NULL }, KERNEL_PID_UNDEF, { NULL } }
+#else
 #define MUTEX_INIT { { NULL } }
+#endif
 
 /**
  * @brief Static initializer for mutex_t with a locked mutex
  */
+#ifdef MODULE_CORE_MUTEX_PRIORITY_INHERITANCE
+#define MUTEX_INIT_LOCKED { { MUTEX_LOCKED }, KERNEL_PID_UNDEF, { NULL } }
+#else
 #define MUTEX_INIT_LOCKED { { MUTEX_LOCKED } }
+#endif
 
 /**
  * @cond INTERNAL
@@ -72,6 +105,10 @@ typedef struct {
 static inline void mutex_init(mutex_t *mutex)
 {
     mutex->queue.next = NULL;
+#ifdef MODULE_CORE_MUTEX_PRIORITY_INHERITANCE
+    mutex->owner = KERNEL_PID_UNDEF;
+    mutex->owner_entry.next = NULL;
+#endif
 }
 
 /**
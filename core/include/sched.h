@@ -119,6 +119,20 @@ int sched_run(void);
  */
 void sched_set_status(thread_t *process, unsigned int status);
 
+/**
+ * @brief   Change the priority of a thread
+ *
+ * If the thread is on the runqueue, it is moved to the runqueue of its new
+ * priority. Does not yield, use sched_switch() afterwards if required.
+ *
+ * @pre     Interrupts are disabled
+ *
+ * @param[in]   thread      Pointer to the thread control block of the
+ *                          targeted thread
+ * @param[in]   priority    The new priority of the thread
+ */
+void sched_change_priority(thread_t *thread, uint8_t priority);
+
 /**
  * @brief       Yield if approriate.
  *
@@ -175,6 +189,30 @@ extern clist_node_t sched_runqueues[SCHED_PRIO_LEVELS];
 NORETURN void sched_task_exit(void);
 
 #ifdef MODULE_SCHEDSTATISTICS
+#if defined(MODULE_SCHEDSTATISTICS_HIST) || defined(DOXYGEN)
+/**
+ * @brief   Number of buckets of the scheduler histograms
+ *
+ * Bucket n counts durations of [2^n, 2^(n+1)) xtimer ticks, bucket 0 also
+ * counts durations of 0 ticks and the last bucket counts all longer
+ * durations.
+ */
+#ifndef SCHEDSTAT_HIST_BUCKETS
+#define SCHEDSTAT_HIST_BUCKETS  (16U)
+#endif
+
+/**
+ * @brief   Histograms recorded per thread by module `schedstatistics_hist`
+ */
+typedef enum {
+    SCHEDSTAT_HIST_WAKE_TO_RUN, /**< time from being put on the runqueue
+                                     until being scheduled */
+    SCHEDSTAT_HIST_RUN_SLICE,   /**< time from being scheduled until being
+                                     switched out */
+    SCHEDSTAT_HIST_NUMOF        /**< number of histograms */
+} schedstat_hist_t;
+#endif
+
 /**
  *  Scheduler statistics
  */
@@ -183,6 +221,13 @@ typedef struct {
                                   scheduled to run */
     unsigned int schedules;  /**< How often the thread was scheduled to run */
     uint64_t runtime_ticks;  /**< The total runtime of this thread in ticks */
+#if defined(MODULE_SCHEDSTATISTICS_HIST) || defined(DOXYGEN)
+    uint32_t lastwake;       /**< Time stamp of the last time this thread was
+                                  put on the runqueue, 0 if it has been
+                                  scheduled since */
+    uint32_t hist[SCHEDSTAT_HIST_NUMOF][SCHEDSTAT_HIST_BUCKETS]; /**< log2
+                                  histograms, see @ref schedstat_hist_t */
+#endif
 } schedstat;
 
 /**
@@ -196,6 +241,28 @@ extern schedstat sched_pidlist[KERNEL_PID_LAST + 1];
  *  @param[in] callback The callback functions the will be called
  */
 void sched_register_cb(void (*callback)(uint32_t, uint32_t));
+
+#if defined(MODULE_SCHEDSTATISTICS_HIST) || defined(DOXYGEN)
+/**
+ * @brief   Get a consistent copy of a thread's scheduler histogram
+ *
+ * @param[in]  pid      thread to query
+ * @param[in]  hist     histogram to query
+ * @param[out] buckets  the histogram's bucket counts
+ *
+ * @return  0 on success
+ * @return  -1 if @p pid is not a valid pid
+ */
+int sched_stat_histogram(kernel_pid_t pid, schedstat_hist_t hist,
+                         uint32_t buckets[SCHEDSTAT_HIST_BUCKETS]);
+
+/**
+ * @brief   Clear the scheduler histograms of a thread
+ *
+ * @param[in]  pid      thread to reset the histograms of
+ */
+void sched_stat_histogram_reset(kernel_pid_t pid);
+#endif
 #endif /* MODULE_SCHEDSTATISTICS */
 
 #ifdef __cplusplus
@@ -32,6 +32,7 @@
 #endif
 #include "irq.h"
 #include "cib.h"
+#include "trace_rec.h"
 
 #define ENABLE_DEBUG    (0)
 #include "debug.h"
@@ -97,6 +98,8 @@ static int _msg_send(msg_t *m, kernel_pid_t target_pid, bool block, unsigned sta
         return -1;
     }
 
+    trace_rec_msg_send(target_pid, m->type);
+
     thread_t *me = (thread_t *) sched_active_thread;
 
     DEBUG("msg_send() %s:%i: Sending from %" PRIkernel_pid " to %" PRIkernel_pid
@@ -176,6 +179,7 @@ int msg_send_to_self(msg_t *m)
     unsigned state = irq_disable();
 
     m->sender_pid = sched_active_pid;
+    trace_rec_msg_send(sched_active_pid, m->type);
     int res = queue_msg((thread_t *) sched_active_thread, m);
 
     irq_restore(state);
@@ -198,6 +202,7 @@ int msg_send_int(msg_t *m, kernel_pid_t target_pid)
     }
 
     m->sender_pid = KERNEL_PID_ISR;
+    trace_rec_msg_send(target_pid, m->type);
     if (target->status == STATUS_RECEIVE_BLOCKED) {
         DEBUG("msg_send_int: Direct msg copy from %" PRIkernel_pid " to %"
               PRIkernel_pid ".\n", thread_getpid(), target_pid);
@@ -217,6 +222,76 @@ int msg_send_int(msg_t *m, kernel_pid_t target_pid)
     }
 }
 
+int msg_send_bulk(msg_t *m, unsigned num, kernel_pid_t target_pid)
+{
+#ifdef DEVELHELP
+    if (!pid_is_valid(target_pid)) {
+        DEBUG("msg_send_bulk(): target_pid is invalid, continuing anyways\n");
+    }
+#endif /* DEVELHELP */
+
+    int in_isr = irq_is_in();
+    kernel_pid_t sender_pid = in_isr ? KERNEL_PID_ISR : sched_active_pid;
+    unsigned state = irq_disable();
+    /* thread_get() also returns NULL for a pid out of range */
+    thread_t *target = (thread_t *) thread_get(target_pid);
+    unsigned n = 0;
+    int wake = 0;
+
+    if (target == NULL) {
+        DEBUG("msg_send_bulk(): target thread does not exist\n");
+        irq_restore(state);
+        return -1;
+    }
+
+    if (num && (target->status == STATUS_RECEIVE_BLOCKED)) {
+        DEBUG("msg_send_bulk(): direct msg copy to %" PRIkernel_pid ".\n",
+              target_pid);
+        /* copy first msg to target */
+        msg_t *target_message = (msg_t*) target->wait_data;
+        m[0].sender_pid = sender_pid;
+        trace_rec_msg_send(target_pid, m[0].type);
+        *target_message = m[0];
+        n = 1;
+        wake = 1;
+    }
+
+    for (; n < num; n++) {
+        int queue_index = cib_put(&(target->msg_queue));
+        if (queue_index < 0) {
+            DEBUG("msg_send_bulk(): message queue is full (or there is none)\n");
+            break;
+        }
+        m[n].sender_pid = sender_pid;
+        trace_rec_msg_send(target_pid, m[n].type);
+        target->msg_array[queue_index] = m[n];
+    }
+
+#if MODULE_CORE_THREAD_FLAGS
+    if (n > (unsigned)wake) {
+        target->flags |= THREAD_FLAG_MSG_WAITING;
+        thread_flags_wake(target);
+    }
+#endif
+
+    DEBUG("msg_send_bulk(): delivered %u of %u messages\n", n, num);
+
+    if (wake) {
+        sched_set_status(target, STATUS_PENDING);
+        if (in_isr) {
+            sched_context_switch_request = 1;
+        }
+        else {
+            irq_restore(state);
+            thread_yield_higher();
+            return n;
+        }
+    }
+
+    irq_restore(state);
+    return n;
+}
+
 int msg_send_receive(msg_t *m, msg_t *reply, kernel_pid_t target_pid)
 {
     assert(sched_active_pid != target_pid);
@@ -229,7 +304,11 @@ int msg_send_receive(msg_t *m, msg_t *reply, kernel_pid_t target_pid)
      * overwritten if the target is not in RECEIVE_BLOCKED */
     *reply = *m;
     /* msg_send blocks until reply received */
-    return _msg_send(reply, target_pid, true, state);
+    int res = _msg_send(reply, target_pid, true, state);
+    if (res == 1) {
+        trace_rec_msg_recv(target_pid, reply->type);
+    }
+    return res;
 }
 
 int msg_reply(msg_t *m, msg_t *reply)
@@ -248,6 +327,7 @@ int msg_reply(msg_t *m, msg_t *reply)
 
     DEBUG("msg_reply(): %" PRIkernel_pid ": Direct msg copy.\n",
           sched_active_thread->pid);
+    trace_rec_msg_send(target->pid, reply->type);
     /* copy msg to target */
     msg_t *target_message = (msg_t*) target->wait_data;
     *target_message = *reply;
@@ -269,6 +349,7 @@ int msg_reply_int(msg_t *m, msg_t *reply)
         return -1;
     }
 
+    trace_rec_msg_send(target->pid, reply->type);
     msg_t *target_message = (msg_t*) target->wait_data;
     *target_message = *reply;
     sched_set_status(target, STATUS_PENDING);
@@ -278,12 +359,20 @@ int msg_reply_int(msg_t *m, msg_t *reply)
 
 int msg_try_receive(msg_t *m)
 {
-    return _msg_receive(m, 0);
+    int res = _msg_receive(m, 0);
+    if (res == 1) {
+        trace_rec_msg_recv(m->sender_pid, m->type);
+    }
+    return res;
 }
 
 int msg_receive(msg_t *m)
 {
-    return _msg_receive(m, 1);
+    int res = _msg_receive(m, 1);
+    if (res == 1) {
+        trace_rec_msg_recv(m->sender_pid, m->type);
+    }
+    return res;
 }
 
 static int _msg_receive(msg_t *m, int block)
@@ -372,6 +461,81 @@ static int _msg_receive(msg_t *m, int block)
     DEBUG("This should have never been reached!\n");
 }
 
+/**
+ * @brief   take up to @p num messages from the queue and from blocked senders
+ *
+ * Must be called with interrupts disabled. Blocked senders are set pending,
+ * @p sender_prio is lowered to the highest priority among them.
+ */
+static unsigned _msg_collect(thread_t *me, msg_t *m, unsigned num,
+                             uint16_t *sender_prio)
+{
+    unsigned n = 0;
+
+    if (me->msg_array) {
+        int queue_index;
+        while ((n < num) && ((queue_index = cib_get(&(me->msg_queue))) >= 0)) {
+            m[n++] = me->msg_array[queue_index];
+        }
+    }
+
+    while (n < num) {
+        list_node_t *next = list_remove_head(&me->msg_waiters);
+        if (next == NULL) {
+            break;
+        }
+
+        thread_t *sender = container_of((clist_node_t*)next, thread_t, rq_entry);
+
+        /* copy msg */
+        m[n++] = *((msg_t*) sender->wait_data);
+
+        if (sender->status != STATUS_REPLY_BLOCKED) {
+            sender->wait_data = NULL;
+            sched_set_status(sender, STATUS_PENDING);
+            if (sender->priority < *sender_prio) {
+                *sender_prio = sender->priority;
+            }
+        }
+    }
+
+    return n;
+}
+
+int msg_receive_bulk(msg_t *m, unsigned num)
+{
+    assert(num > 0);
+
+    thread_t *me = (thread_t*) sched_active_thread;
+    uint16_t sender_prio = THREAD_PRIORITY_IDLE;
+    unsigned state = irq_disable();
+    unsigned n = _msg_collect(me, m, num, &sender_prio);
+
+    irq_restore(state);
+
+    if (n == 0) {
+        /* nothing available, block for the first message */
+        _msg_receive(m, 1);
+
+        state = irq_disable();
+        n = 1 + _msg_collect(me, m + 1, num - 1, &sender_prio);
+        irq_restore(state);
+    }
+
+    DEBUG("msg_receive_bulk(): %" PRIkernel_pid ": received %u messages\n",
+          me->pid, n);
+
+    for (unsigned i = 0; i < n; i++) {
+        trace_rec_msg_recv(m[i].sender_pid, m[i].type);
+    }
+
+    if (sender_prio < THREAD_PRIORITY_IDLE) {
+        sched_switch(sender_prio);
+    }
+
+    return n;
+}
+
 int msg_avail(void)
 {
     DEBUG("msg_available: %" PRIkernel_pid ": msg_available.\n",
@@ -388,6 +552,18 @@ int msg_avail(void)
     return queue_index;
 }
 
+int msg_avail_thread(kernel_pid_t pid)
+{
+    thread_t *thread = (thread_t *) thread_get(pid);
+    int queue_index = -1;
+
+    if ((thread != NULL) && thread->msg_array) {
+        queue_index = cib_avail(&(thread->msg_queue));
+    }
+
+    return queue_index;
+}
+
 void msg_init_queue(msg_t *array, int num)
 {
     thread_t *me = (thread_t*) sched_active_thread;
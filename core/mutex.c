@@ -32,8 +32,176 @@
 #define ENABLE_DEBUG    (0)
 #include "debug.h"
 
+/*
+ * Where the CPU can compare-and-swap a pointer without disabling interrupts,
+ * an uncontended lock or unlock is a single CAS on mutex->queue.next
+ * (NULL <-> MUTEX_LOCKED). Everything else is done with interrupts disabled,
+ * so an interrupted CAS simply fails and the slow path sees a consistent
+ * queue. Without lock-free CAS (e.g. Cortex-M0), the atomic_c11.c fallback
+ * would disable interrupts itself, so the slow path is used right away.
+ * Priority inheritance needs the owner to be set along with the lock, so it
+ * always takes the slow path. Define MUTEX_FAST_PATH to 0 to compare.
+ */
+#ifndef MUTEX_FAST_PATH
+#if (__GCC_ATOMIC_POINTER_LOCK_FREE == 2) && \
+    !defined(MODULE_CORE_MUTEX_PRIORITY_INHERITANCE)
+#define MUTEX_FAST_PATH     (1)
+#else
+#define MUTEX_FAST_PATH     (0)
+#endif
+#endif
+
+#if MUTEX_FAST_PATH
+static inline int _cas(mutex_t *mutex, list_node_t *expected,
+                       list_node_t *desired, int memorder)
+{
+    return __atomic_compare_exchange_n(&mutex->queue.next, &expected, desired,
+                                       0, memorder, __ATOMIC_RELAXED);
+}
+#endif
+
+#ifdef MODULE_CORE_MUTEX_PRIORITY_INHERITANCE
+static inline void _set_owner(mutex_t *mutex, thread_t *owner)
+{
+    if (owner == NULL) {
+        /* locked before the scheduler was started */
+        mutex->owner = KERNEL_PID_UNDEF;
+        return;
+    }
+    mutex->owner = owner->pid;
+    list_add(&owner->mutexes_held, &mutex->owner_entry);
+}
+
+/**
+ * @brief   Lend the priority of @p me, which just blocked on @p mutex, to
+ *          the mutex owner, and along the chain of mutexes the owners are
+ *          blocked on
+ */
+static void _inherit_priority(mutex_t *mutex, thread_t *me)
+{
+    while (mutex) {
+        thread_t *owner = (thread_t *)sched_threads[mutex->owner];
+        if ((owner == NULL) || (owner->priority <= me->priority)) {
+            break;
+        }
+
+        DEBUG("PID[%" PRIkernel_pid "]: boosting owner %" PRIkernel_pid "\n",
+              me->pid, owner->pid);
+        sched_change_priority(owner, me->priority);
+
+        if (owner->status != STATUS_MUTEX_BLOCKED) {
+            break;
+        }
+
+        /* the owner waits for another mutex, move it up in that queue and
+         * boost that mutex's owner as well */
+        mutex = (mutex_t *)owner->wait_data;
+        list_remove(&mutex->queue, (list_node_t *)&owner->rq_entry);
+        thread_add_to_list(&mutex->queue, owner);
+    }
+}
+
+/**
+ * @brief   Remove @p mutex from its owner's mutexes and drop the owner to the
+ *          highest priority of the waiters for the mutexes it still owns
+ *
+ * Mutex queues are sorted by priority, so only their heads are checked.
+ */
+static int _restore_priority(mutex_t *mutex)
+{
+    thread_t *owner = (thread_t *)sched_threads[mutex->owner];
+
+    if (owner == NULL) {
+        return 0;
+    }
+    list_remove(&owner->mutexes_held, &mutex->owner_entry);
+
+    uint8_t priority = owner->base_priority;
+    for (list_node_t *node = owner->mutexes_held.next; node;
+         node = node->next) {
+        mutex_t *held = container_of(node, mutex_t, owner_entry);
+
+        if (held->queue.next != MUTEX_LOCKED) {
+            thread_t *waiter = container_of((clist_node_t *)held->queue.next,
+                                            thread_t, rq_entry);
+            if (waiter->priority < priority) {
+                priority = waiter->priority;
+            }
+        }
+    }
+    if (owner->priority != priority) {
+        sched_change_priority(owner, priority);
+        return 1;
+    }
+    return 0;
+}
+#else
+static inline void _set_owner(mutex_t *mutex, thread_t *owner)
+{
+    (void)mutex;
+    (void)owner;
+}
+
+static inline void _inherit_priority(mutex_t *mutex, thread_t *me)
+{
+    (void)mutex;
+    (void)me;
+}
+
+static inline int _restore_priority(mutex_t *mutex)
+{
+    (void)mutex;
+    return 0;
+}
+#endif
+
+/**
+ * @brief   Pass a locked mutex on to the first waiter, or unlock it
+ *
+ * @param[out] restored set if the owner's inherited priority was dropped
+ *
+ * @return  the thread that got the mutex, or NULL
+ */
+static thread_t *_mutex_handover(mutex_t *mutex, int *restored)
+{
+    *restored = _restore_priority(mutex);
+
+    if (mutex->queue.next == MUTEX_LOCKED) {
+        /* the mutex was locked and no thread was waiting for it */
+        mutex->queue.next = NULL;
+#ifdef MODULE_CORE_MUTEX_PRIORITY_INHERITANCE
+        mutex->owner = KERNEL_PID_UNDEF;
+#endif
+        return NULL;
+    }
+
+    list_node_t *next = list_remove_head(&mutex->queue);
+
+    thread_t *process = container_of((clist_node_t*)next, thread_t, rq_entry);
+
+    DEBUG("mutex_unlock: waking up waiting thread %" PRIkernel_pid "\n",
+          process->pid);
+    sched_set_status(process, STATUS_PENDING);
+    _set_owner(mutex, process);
+
+    if (!mutex->queue.next) {
+        mutex->queue.next = MUTEX_LOCKED;
+    }
+
+    return process;
+}
+
 int _mutex_lock(mutex_t *mutex, int blocking)
 {
+#if MUTEX_FAST_PATH
+    if (_cas(mutex, NULL, MUTEX_LOCKED, __ATOMIC_ACQUIRE)) {
+        return 1;
+    }
+    if (!blocking) {
+        return 0;
+    }
+#endif
+
     unsigned irqstate = irq_disable();
 
     DEBUG("PID[%" PRIkernel_pid "]: Mutex in use.\n", sched_active_pid);
@@ -41,6 +209,7 @@ int _mutex_lock(mutex_t *mutex, int blocking)
     if (mutex->queue.next == NULL) {
         /* mutex is unlocked. */
         mutex->queue.next = MUTEX_LOCKED;
+        _set_owner(mutex, (thread_t *)sched_active_thread);
         DEBUG("PID[%" PRIkernel_pid "]: mutex_wait early out.\n",
               sched_active_pid);
         irq_restore(irqstate);
@@ -58,6 +227,10 @@ int _mutex_lock(mutex_t *mutex, int blocking)
         else {
             thread_add_to_list(&mutex->queue, me);
         }
+#ifdef MODULE_CORE_MUTEX_PRIORITY_INHERITANCE
+        me->wait_data = mutex;
+#endif
+        _inherit_priority(mutex, me);
         irq_restore(irqstate);
         thread_yield_higher();
         /* We were woken up by scheduler. Waker removed us from queue.
@@ -72,6 +245,12 @@ int _mutex_lock(mutex_t *mutex, int blocking)
 
 void mutex_unlock(mutex_t *mutex)
 {
+#if MUTEX_FAST_PATH
+    if (_cas(mutex, MUTEX_LOCKED, NULL, __ATOMIC_RELEASE)) {
+        return;
+    }
+#endif
+
     unsigned irqstate = irq_disable();
 
     DEBUG("mutex_unlock(): queue.next: 0x%08x pid: %" PRIkernel_pid "\n",
@@ -83,25 +262,19 @@ void mutex_unlock(mutex_t *mutex)
         return;
     }
 
-    if (mutex->queue.next == MUTEX_LOCKED) {
-        mutex->queue.next = NULL;
-        /* the mutex was locked and no thread was waiting for it */
+    int restored;
+    thread_t *process = _mutex_handover(mutex, &restored);
+
+    if (process == NULL) {
         irq_restore(irqstate);
+        if (restored) {
+            /* a waiter that boosted us has timed out meanwhile, someone
+             * else might be more important now */
+            thread_yield_higher();
+        }
         return;
     }
 
-    list_node_t *next = list_remove_head(&mutex->queue);
-
-    thread_t *process = container_of((clist_node_t*)next, thread_t, rq_entry);
-
-    DEBUG("mutex_unlock: waking up waiting thread %" PRIkernel_pid "\n",
-          process->pid);
-    sched_set_status(process, STATUS_PENDING);
-
-    if (!mutex->queue.next) {
-        mutex->queue.next = MUTEX_LOCKED;
-    }
-
     uint16_t process_priority = process->priority;
     irq_restore(irqstate);
     sched_switch(process_priority);
@@ -114,19 +287,8 @@ void mutex_unlock_and_sleep(mutex_t *mutex)
     unsigned irqstate = irq_disable();
 
     if (mutex->queue.next) {
-        if (mutex->queue.next == MUTEX_LOCKED) {
-            mutex->queue.next = NULL;
-        }
-        else {
-            list_node_t *next = list_remove_head(&mutex->queue);
-            thread_t *process = container_of((clist_node_t*)next, thread_t,
-                                             rq_entry);
-            DEBUG("PID[%" PRIkernel_pid "]: waking up waiter.\n", process->pid);
-            sched_set_status(process, STATUS_PENDING);
-            if (!mutex->queue.next) {
-                mutex->queue.next = MUTEX_LOCKED;
-            }
-        }
+        int restored;
+        _mutex_handover(mutex, &restored);
     }
 
     DEBUG("PID[%" PRIkernel_pid "]: going to sleep.\n", sched_active_pid);
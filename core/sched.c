@@ -20,6 +20,7 @@
  */
 
 #include <stdint.h>
+#include <string.h>
 
 #include "sched.h"
 #include "clist.h"
@@ -29,6 +30,10 @@
 #include "irq.h"
 #include "log.h"
 
+#ifdef MODULE_TRACE_REC
+#include "trace_rec.h"
+#endif
+
 #ifdef MODULE_MPU_STACK_GUARD
 #include "mpu.h"
 #endif
@@ -79,6 +84,25 @@ static void (*sched_cb) (uint32_t timestamp, uint32_t value) = NULL;
 schedstat sched_pidlist[KERNEL_PID_LAST + 1];
 #endif
 
+#ifdef MODULE_SCHEDSTATISTICS_HIST
+static inline void _hist_add(uint32_t *hist, uint32_t ticks)
+{
+    unsigned bucket = 0;
+
+    /* floor(log2(ticks)), split as unsigned may only be 16 bit wide */
+    if (ticks >> 16) {
+        bucket = 16 + bitarithm_msb(ticks >> 16);
+    }
+    else if (ticks) {
+        bucket = bitarithm_msb(ticks);
+    }
+    if (bucket >= SCHEDSTAT_HIST_BUCKETS) {
+        bucket = SCHEDSTAT_HIST_BUCKETS - 1;
+    }
+    hist[bucket]++;
+}
+#endif
+
 int __attribute__((used)) sched_run(void)
 {
     sched_context_switch_request = 0;
@@ -104,6 +128,11 @@ int __attribute__((used)) sched_run(void)
     uint32_t now = xtimer_now().ticks32;
 #endif
 
+#ifdef MODULE_TRACE_REC
+    trace_rec_switch((active_thread == NULL) ? KERNEL_PID_UNDEF : active_thread->pid,
+                     next_thread->pid);
+#endif
+
     if (active_thread) {
         if (active_thread->status == STATUS_RUNNING) {
             active_thread->status = STATUS_PENDING;
@@ -118,7 +147,11 @@ int __attribute__((used)) sched_run(void)
 #ifdef MODULE_SCHEDSTATISTICS
         schedstat *active_stat = &sched_pidlist[active_thread->pid];
         if (active_stat->laststart) {
-            active_stat->runtime_ticks += now - active_stat->laststart;
+            uint32_t slice = now - active_stat->laststart;
+            active_stat->runtime_ticks += slice;
+#ifdef MODULE_SCHEDSTATISTICS_HIST
+            _hist_add(active_stat->hist[SCHEDSTAT_HIST_RUN_SLICE], slice);
+#endif
         }
 #endif
     }
@@ -127,6 +160,13 @@ int __attribute__((used)) sched_run(void)
     schedstat *next_stat = &sched_pidlist[next_thread->pid];
     next_stat->laststart = now;
     next_stat->schedules++;
+#ifdef MODULE_SCHEDSTATISTICS_HIST
+    if (next_stat->lastwake) {
+        _hist_add(next_stat->hist[SCHEDSTAT_HIST_WAKE_TO_RUN],
+                  now - next_stat->lastwake);
+        next_stat->lastwake = 0;
+    }
+#endif
     if (sched_cb) {
         sched_cb(now, next_thread->pid);
     }
@@ -158,6 +198,34 @@ void sched_register_cb(void (*callback)(uint32_t, uint32_t))
 }
 #endif
 
+#ifdef MODULE_SCHEDSTATISTICS_HIST
+int sched_stat_histogram(kernel_pid_t pid, schedstat_hist_t hist,
+                         uint32_t buckets[SCHEDSTAT_HIST_BUCKETS])
+{
+    if (!pid_is_valid(pid) || (hist >= SCHEDSTAT_HIST_NUMOF)) {
+        return -1;
+    }
+
+    unsigned state = irq_disable();
+    memcpy(buckets, sched_pidlist[pid].hist[hist],
+           sizeof(sched_pidlist[pid].hist[hist]));
+    irq_restore(state);
+
+    return 0;
+}
+
+void sched_stat_histogram_reset(kernel_pid_t pid)
+{
+    if (!pid_is_valid(pid)) {
+        return;
+    }
+
+    unsigned state = irq_disable();
+    memset(sched_pidlist[pid].hist, 0, sizeof(sched_pidlist[pid].hist));
+    irq_restore(state);
+}
+#endif
+
 void sched_set_status(thread_t *process, unsigned int status)
 {
     if (status >= STATUS_ON_RUNQUEUE) {
@@ -166,6 +234,9 @@ void sched_set_status(thread_t *process, unsigned int status)
                   process->pid, process->priority);
             clist_rpush(&sched_runqueues[process->priority], &(process->rq_entry));
             runqueue_bitcache |= 1 << process->priority;
+#ifdef MODULE_SCHEDSTATISTICS_HIST
+            sched_pidlist[process->pid].lastwake = xtimer_now().ticks32;
+#endif
         }
     }
     else {
@@ -183,6 +254,37 @@ void sched_set_status(thread_t *process, unsigned int status)
     process->status = status;
 }
 
+void sched_change_priority(thread_t *thread, uint8_t priority)
+{
+    if (thread->priority == priority) {
+        return;
+    }
+
+    DEBUG("sched_change_priority: thread %" PRIkernel_pid ": %" PRIu8 " -> %"
+          PRIu8 "\n", thread->pid, thread->priority, priority);
+
+    if (thread->status >= STATUS_ON_RUNQUEUE) {
+        clist_remove(&sched_runqueues[thread->priority], &(thread->rq_entry));
+        if (!sched_runqueues[thread->priority].next) {
+            runqueue_bitcache &= ~(1 << thread->priority);
+        }
+
+        thread->priority = priority;
+
+        if (thread == sched_active_thread) {
+            /* the active thread is expected at the head of its runqueue */
+            clist_lpush(&sched_runqueues[priority], &(thread->rq_entry));
+        }
+        else {
+            clist_rpush(&sched_runqueues[priority], &(thread->rq_entry));
+        }
+        runqueue_bitcache |= 1 << priority;
+    }
+    else {
+        thread->priority = priority;
+    }
+}
+
 void sched_switch(uint16_t other_prio)
 {
     thread_t *active_thread = (thread_t *) sched_active_thread;
@@ -225,6 +225,10 @@ kernel_pid_t thread_create(char *stack, int stacksize, char priority, int flags,
 
     cb->priority = priority;
     cb->status = 0;
+#ifdef MODULE_CORE_MUTEX_PRIORITY_INHERITANCE
+    cb->base_priority = priority;
+    cb->mutexes_held.next = NULL;
+#endif
 
     cb->rq_entry.next = NULL;
 
@@ -19,23 +19,109 @@
 
 #include <err.h>
 #include <signal.h>
+#include <stdbool.h>
 #include <stdlib.h>
+#include <string.h>
 #include <unistd.h>
 #include <fcntl.h>
+#ifdef __linux__
+#include <poll.h>
+#include <sys/epoll.h>
+#endif
 
 #include "async_read.h"
+#include "irq.h"
 #include "native_internal.h"
+#ifdef MODULE_NATIVE_VTIME
+#include "native_vtime.h"
+#endif
 
-static int _next_index;
-static int _fds[ASYNC_READ_NUMOF];
-static void *_args[ASYNC_READ_NUMOF];
-static native_async_read_callback_t _native_async_read_callbacks[ASYNC_READ_NUMOF];
+#define ENABLE_DEBUG (0)
+#include "debug.h"
 
+typedef struct {
+    int fd;                             /**< -1 for unused slots */
+    unsigned flags;
+    bool armed;                         /**< false while a oneshot fd waits
+                                             for native_async_read_continue() */
+    void *arg;
+    native_async_read_callback_t cb;
 #ifdef __MACH__
-static pid_t _sigio_child_pids[ASYNC_READ_NUMOF];
-static void _sigio_child(int fd);
+    pid_t sigio_child_pid;
+#endif
+} _handler_t;
+
+extern int _sig_pipefd[2];
+
+static _handler_t *_handlers;
+static unsigned _numof;
+static unsigned _size;
+
+#ifdef __linux__
+static int _epfd = -1;
+#endif
+
+#ifdef __MACH__
+static void _sigio_child(int index);
+#endif
+
+static int _find(int fd)
+{
+    for (unsigned i = 0; i < _numof; i++) {
+        if (_handlers[i].fd == fd) {
+            return i;
+        }
+    }
+    return -1;
+}
+
+static void _dispatch(unsigned index)
+{
+    _handler_t *h = &_handlers[index];
+
+    if ((h->fd < 0) || !h->armed) {
+        return;
+    }
+    if (h->flags & ASYNC_READ_ONESHOT) {
+        h->armed = false;
+    }
+#ifdef MODULE_NATIVE_VTIME
+    native_vtime_busy(h->fd);
 #endif
+    h->cb(h->fd, h->arg);
+}
+
+#ifdef __linux__
+static uint32_t _epoll_events(unsigned flags)
+{
+    uint32_t events = EPOLLIN;
+
+    if (flags & ASYNC_READ_EDGE) {
+        events |= EPOLLET;
+    }
+    if (flags & ASYNC_READ_ONESHOT) {
+        events |= EPOLLONESHOT;
+    }
+    return events;
+}
 
+static void _async_io_isr(void) {
+    struct epoll_event events[ASYNC_READ_EVENTS];
+    /* epoll rotates its ready list, so this many rounds see every fd */
+    unsigned rounds = (_numof + ASYNC_READ_EVENTS - 1) / ASYNC_READ_EVENTS;
+
+    for (unsigned r = 0; r < rounds; r++) {
+        int n = epoll_wait(_epfd, events, ASYNC_READ_EVENTS, 0);
+
+        for (int i = 0; i < n; i++) {
+            _dispatch(events[i].data.u32);
+        }
+        if (n < ASYNC_READ_EVENTS) {
+            break;
+        }
+    }
+}
+#else
 static void _async_io_isr(void) {
     fd_set rfds;
 
@@ -45,63 +131,168 @@ static void _async_io_isr(void) {
 
     struct timeval timeout = { .tv_usec = 0 };
 
-    for (int i = 0; i < _next_index; i++) {
-        FD_SET(_fds[i], &rfds);
+    for (unsigned i = 0; i < _numof; i++) {
+        if ((_handlers[i].fd < 0) || !_handlers[i].armed) {
+            continue;
+        }
+
+        FD_SET(_handlers[i].fd, &rfds);
 
-        if (max_fd < _fds[i]) {
-            max_fd = _fds[i];
+        if (max_fd < _handlers[i].fd) {
+            max_fd = _handlers[i].fd;
         }
     }
 
     if (real_select(max_fd + 1, &rfds, NULL, NULL, &timeout) > 0) {
-        for (int i = 0; i < _next_index; i++) {
-            if (FD_ISSET(_fds[i], &rfds)) {
-                _native_async_read_callbacks[i](_fds[i], _args[i]);
+        for (unsigned i = 0; i < _numof; i++) {
+            if ((_handlers[i].fd >= 0) && FD_ISSET(_handlers[i].fd, &rfds)) {
+                _dispatch(i);
             }
         }
     }
 }
+#endif
 
 void native_async_read_setup(void) {
+#ifdef __linux__
+    if (_epfd < 0) {
+        _epfd = epoll_create1(EPOLL_CLOEXEC);
+        if (_epfd == -1) {
+            err(EXIT_FAILURE, "native_async_read_setup(): epoll_create1");
+        }
+    }
+#endif
     register_interrupt(SIGIO, _async_io_isr);
 }
 
 void native_async_read_cleanup(void) {
     unregister_interrupt(SIGIO);
 
-    for (int i = 0; i < _next_index; i++) {
+    for (unsigned i = 0; i < _numof; i++) {
+        if (_handlers[i].fd < 0) {
+            continue;
+        }
 #ifdef __MACH__
-        kill(_sigio_child_pids[i], SIGKILL);
+        kill(_handlers[i].sigio_child_pid, SIGKILL);
 #endif
-        real_close(_fds[i]);
+        real_close(_handlers[i].fd);
+    }
+
+#ifdef __linux__
+    if (_epfd >= 0) {
+        real_close(_epfd);
+        _epfd = -1;
     }
+#endif
+    real_free(_handlers);
+    _handlers = NULL;
+    _numof = 0;
+    _size = 0;
+}
+
+static bool _readable(int fd)
+{
+#ifdef __linux__
+    struct pollfd pfd = { .fd = fd, .events = POLLIN };
+
+    return poll(&pfd, 1, 0) == 1;
+#else
+    fd_set rfds;
+    struct timeval t;
+    memset(&t, 0, sizeof(t));
+    FD_ZERO(&rfds);
+    FD_SET(fd, &rfds);
+
+    return real_select(fd + 1, &rfds, NULL, NULL, &t) == 1;
+#endif
 }
 
 void native_async_read_continue(int fd) {
-    (void) fd;
 #ifdef __MACH__
-    for (int i = 0; i < _next_index; i++) {
-        if (_fds[i] == fd) {
-            kill(_sigio_child_pids[i], SIGCONT);
+    for (unsigned i = 0; i < _numof; i++) {
+        if (_handlers[i].fd == fd) {
+            _handlers[i].armed = true;
+            kill(_handlers[i].sigio_child_pid, SIGCONT);
         }
     }
+#else
+    int index = _find(fd);
+
+    if ((index < 0) || !(_handlers[index].flags & ASYNC_READ_ONESHOT)) {
+        return;
+    }
+
+    _native_in_syscall++; /* no switching here */
+
+#ifdef __linux__
+    struct epoll_event ev = {
+        .events = _epoll_events(_handlers[index].flags),
+        .data.u32 = index,
+    };
+    if (epoll_ctl(_epfd, EPOLL_CTL_MOD, fd, &ev) == -1) {
+        err(EXIT_FAILURE, "native_async_read_continue(): epoll_ctl");
+    }
+#endif
+    _handlers[index].armed = true;
+
+    /* data that arrived while disarmed raised no signal of its own */
+    if (_readable(fd)) {
+        int sig = SIGIO;
+        real_write(_sig_pipefd[1], &sig, sizeof(int));
+        _native_sigpend++;
+        DEBUG("native_async_read_continue: sigpend++\n");
+    }
+
+    _native_in_syscall--;
 #endif
 }
 
 void native_async_read_add_handler(int fd, void *arg, native_async_read_callback_t handler) {
-    if (_next_index >= ASYNC_READ_NUMOF) {
-        err(EXIT_FAILURE, "native_async_read_add_handler(): too many callbacks");
+    native_async_read_add_handler_flags(fd, arg, handler, 0);
+}
+
+void native_async_read_add_handler_flags(int fd, void *arg,
+                                         native_async_read_callback_t handler,
+                                         unsigned flags) {
+    unsigned state = irq_disable();
+
+    int index = _find(-1);
+
+    if (index < 0) {
+        if (_numof == _size) {
+            /* the SIGIO handler can't run while the table moves */
+            _handler_t *handlers = real_realloc(_handlers,
+                    (_size + ASYNC_READ_NUMOF) * sizeof(_handler_t));
+            if (handlers == NULL) {
+                err(EXIT_FAILURE, "native_async_read_add_handler(): realloc");
+            }
+            _handlers = handlers;
+            _size += ASYNC_READ_NUMOF;
+        }
+        index = _numof++;
     }
 
-    _fds[_next_index] = fd;
-    _args[_next_index] = arg;
-    _native_async_read_callbacks[_next_index] = handler;
+    _handler_t *h = &_handlers[index];
+    h->fd = fd;
+    h->flags = flags;
+    h->armed = true;
+    h->arg = arg;
+    h->cb = handler;
 
 #ifdef __MACH__
     /* tuntap signalled IO is not working in OSX,
      * * check http://sourceforge.net/p/tuntaposx/bugs/17/ */
-    _sigio_child(_next_index);
+    _sigio_child(index);
 #else
+#ifdef __linux__
+    struct epoll_event ev = {
+        .events = _epoll_events(flags),
+        .data.u32 = index,
+    };
+    if (epoll_ctl(_epfd, EPOLL_CTL_ADD, fd, &ev) == -1) {
+        err(EXIT_FAILURE, "native_async_read_add_handler(): epoll_ctl");
+    }
+#endif
     /* configure fds to send signals on io */
     if (real_fcntl(fd, F_SETOWN, _native_pid) == -1) {
         err(EXIT_FAILURE, "native_async_read_add_handler(): fcntl(F_SETOWN)");
@@ -112,20 +303,40 @@ void native_async_read_add_handler(int fd, void *arg, native_async_read_callback
     }
 #endif /* not OSX */
 
-    _next_index++;
+    irq_restore(state);
+}
+
+void native_async_read_remove_handler(int fd) {
+    unsigned state = irq_disable();
+
+    int index = _find(fd);
+
+    if (index >= 0) {
+#ifdef __MACH__
+        kill(_handlers[index].sigio_child_pid, SIGKILL);
+#else
+#ifdef __linux__
+        epoll_ctl(_epfd, EPOLL_CTL_DEL, fd, NULL);
+#endif
+        real_fcntl(fd, F_SETFL, O_NONBLOCK);
+#endif
+        _handlers[index].fd = -1;
+    }
+
+    irq_restore(state);
 }
 
 #ifdef __MACH__
 static void _sigio_child(int index)
 {
-    int fd = _fds[index];
+    int fd = _handlers[index].fd;
     pid_t parent = _native_pid;
     pid_t child;
     if ((child = real_fork()) == -1) {
         err(EXIT_FAILURE, "sigio_child: fork");
     }
     if (child > 0) {
-        _sigio_child_pids[index] = child;
+        _handlers[index].sigio_child_pid = child;
 
         /* return in parent process */
         return;
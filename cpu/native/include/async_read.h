@@ -13,6 +13,10 @@
  * @file
  * @brief       Multiple asynchronus read on file descriptors
  *
+ * All file descriptors are configured to raise SIGIO. On Linux, the SIGIO
+ * handler asks an epoll instance which of them are ready and only calls
+ * their handlers, other systems fall back to select().
+ *
  * @author      Takuo Yonezawa <Yonezawa-T2@mail.dnp.co.jp>
  */
 #ifndef ASYNC_READ_H
@@ -23,12 +27,47 @@ extern "C" {
 #endif
 
 /**
- * @brief   Maximum number of file descriptors
+ * @brief   Number of handler slots allocated at once
+ *
+ * The handler table grows by this many slots whenever it is full, so there
+ * is no upper limit to the number of file descriptors.
  */
 #ifndef ASYNC_READ_NUMOF
 #define ASYNC_READ_NUMOF 2
 #endif
 
+/**
+ * @brief   Maximum number of ready file descriptors fetched from the kernel
+ *          per system call
+ */
+#ifndef ASYNC_READ_EVENTS
+#define ASYNC_READ_EVENTS 16
+#endif
+
+/**
+ * @name    Handler flags
+ * @see     native_async_read_add_handler_flags()
+ * @{
+ */
+/**
+ * @brief   Call the handler only when new data arrives
+ *
+ * The handler must read the file descriptor until it would block, remaining
+ * data is not reported again.
+ */
+#define ASYNC_READ_EDGE     (0x1)
+/**
+ * @brief   Disable the file descriptor after calling its handler
+ *
+ * The handler is not called again before native_async_read_continue() was
+ * called for the file descriptor. This suits drivers that only signal an
+ * event from the handler and read the data later from thread context. If
+ * data is still pending on native_async_read_continue(), the handler is
+ * called again right away.
+ */
+#define ASYNC_READ_ONESHOT  (0x2)
+/** @} */
+
 /**
  * @brief   asynchronus read callback type
  */
@@ -44,7 +83,8 @@ void native_async_read_setup(void);
 /**
  * @brief   shutdown asynchronus read system
  *
- * This deregisters SIGIO signal handler.
+ * This deregisters SIGIO signal handler and closes all monitored file
+ * descriptors.
  */
 void native_async_read_cleanup(void);
 
@@ -60,6 +100,9 @@ void native_async_read_continue(int fd);
 /**
  * @brief   start monitoring of file descriptor
  *
+ * The handler is called from interrupt context as long as @p fd is
+ * readable.
+ *
  * @param[in] fd       The file descriptor to monitor
  * @param[in] arg      Pointer to be passed as arguments to the callback
  * @param[in] handler  The callback function to be called when the file
@@ -67,6 +110,29 @@ void native_async_read_continue(int fd);
  */
 void native_async_read_add_handler(int fd, void *arg, native_async_read_callback_t handler);
 
+/**
+ * @brief   start monitoring of file descriptor with specific trigger mode
+ *
+ * @param[in] fd       The file descriptor to monitor
+ * @param[in] arg      Pointer to be passed as arguments to the callback
+ * @param[in] handler  The callback function to be called when the file
+ *                     descriptor is ready to read.
+ * @param[in] flags    ASYNC_READ_EDGE, ASYNC_READ_ONESHOT or 0 for the
+ *                     behavior of native_async_read_add_handler()
+ */
+void native_async_read_add_handler_flags(int fd, void *arg,
+                                         native_async_read_callback_t handler,
+                                         unsigned flags);
+
+/**
+ * @brief   stop monitoring of file descriptor
+ *
+ * The file descriptor is not closed.
+ *
+ * @param[in] fd  The file descriptor to stop monitoring
+ */
+void native_async_read_remove_handler(int fd);
+
 #ifdef __cplusplus
 }
 #endif
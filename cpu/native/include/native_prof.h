@@ -0,0 +1,117 @@
+/*
+ * Copyright (C) 2026 agent <agent@local>
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @defgroup    cpu_native_prof Sampling profiler (only under native)
+ * @ingroup     cpu_native
+ * @brief       SIGPROF based sampling profiler that attributes samples to
+ *              RIOT threads
+ *
+ * gprof does not know about RIOT's threads, which on native are ucontexts
+ * of one host process, so it attributes time wrongly across them. With
+ * module `native_prof`, the host's profiling timer (ITIMER_PROF) instead
+ * interrupts the process @ref NATIVE_PROF_HZ times per second of consumed
+ * CPU time. Each sample stores the active RIOT thread (or interrupt context)
+ * and a backtrace of the interrupted code. Identical samples are
+ * aggregated right away into a table of @ref NATIVE_PROF_STACKS entries, so
+ * profiling can run for any amount of time.
+ *
+ * The profile is written in the folded stack format, one line per distinct
+ * stack, outermost frame first:
+ *
+ *     <thread>;<function>;...;<function> <samples>
+ *
+ * which can be fed into e.g. `flamegraph.pl` or https://speedscope.app.
+ *
+ * The easiest way to use it is starting the instance with
+ * `--prof=<file>`, which starts sampling before RIOT boots and writes the
+ * profile to `<file>` when the instance exits. The module links the
+ * executable with `-rdynamic`, so functions can be named without external
+ * tools.
+ *
+ * SIGPROF is not part of RIOT's emulated interrupts, so it also samples
+ * code that runs with interrupts disabled. As with any signal, host system
+ * calls that cannot be restarted may return early with `EINTR`.
+ *
+ * @{
+ *
+ * @file
+ * @brief       Sampling profiler API
+ *
+ * @author      agent <agent@local>
+ */
+
+#ifndef NATIVE_PROF_H
+#define NATIVE_PROF_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief   Samples per second of consumed CPU time
+ *
+ * Deliberately not a round number, so sampling does not run in lockstep
+ * with periodic activity.
+ */
+#ifndef NATIVE_PROF_HZ
+#define NATIVE_PROF_HZ      (997U)
+#endif
+
+/**
+ * @brief   Maximum number of frames recorded per sample
+ */
+#ifndef NATIVE_PROF_DEPTH
+#define NATIVE_PROF_DEPTH   (32U)
+#endif
+
+/**
+ * @brief   Number of distinct stacks that can be recorded, must be a power
+ *          of 2
+ *
+ * Samples of further stacks are counted as dropped.
+ */
+#ifndef NATIVE_PROF_STACKS
+#define NATIVE_PROF_STACKS  (4096U)
+#endif
+
+/**
+ * @brief   Start sampling
+ *
+ * Samples are added to the ones recorded before.
+ */
+void native_prof_start(void);
+
+/**
+ * @brief   Stop sampling
+ */
+void native_prof_stop(void);
+
+/**
+ * @brief   Drop all recorded samples
+ */
+void native_prof_reset(void);
+
+/**
+ * @brief   Write the recorded profile in folded stack format
+ *
+ * Sampling is paused while writing.
+ *
+ * @param[in] fd    host file descriptor to write to
+ *
+ * @return  number of distinct stacks written
+ * @return  -1 on write error
+ */
+int native_prof_write(int fd);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* NATIVE_PROF_H */
+/** @} */
@@ -0,0 +1,109 @@
+/*
+ * Copyright (C) 2026 agent <agent@local>
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @defgroup    cpu_native_vtime Virtual time (only under native)
+ * @ingroup     cpu_native
+ * @brief       Runs native's periph_timer on a virtual clock that skips
+ *              idle time
+ *
+ * With module `native_vtime`, periph_timer reads a virtual clock instead of
+ * the host's monotonic clock. The virtual clock stands still while RIOT
+ * threads run (apart from a small step per read, see
+ * @ref NATIVE_VTIME_READ_STEP), and jumps straight to the next timer target
+ * as soon as all threads are idle. A scenario that waits for timers most of
+ * the time thus runs as fast as the host can execute it.
+ *
+ * On its own, every instance jumps ahead independently, which is fine for
+ * a single instance but lets communicating instances drift apart. For
+ * simulations with several instances, start
+ * `dist/tools/vtime_coord/vtime_coord.py` and pass its socket to every
+ * instance with `--vtime-coord=<socket>`. Each instance then reports when
+ * it is idle and the time of its next timer target. Only once all
+ * instances were idle for a short grace period, the coordinator advances
+ * all of them to the earliest target. Every I/O event on an instance (e.g.
+ * a received frame) marks it busy again.
+ *
+ * periph_rtt keeps running on host time.
+ *
+ * @{
+ *
+ * @file
+ * @brief       Virtual time API
+ *
+ * @author      agent <agent@local>
+ */
+
+#ifndef NATIVE_VTIME_H
+#define NATIVE_VTIME_H
+
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief   Nanoseconds the virtual clock advances with every read
+ *
+ * Keeps code that busy-waits on the timer (e.g. xtimer_spin()) from
+ * waiting forever.
+ */
+#ifndef NATIVE_VTIME_READ_STEP
+#define NATIVE_VTIME_READ_STEP  (1000U)
+#endif
+
+/**
+ * @brief   Read the virtual clock
+ *
+ * @return  virtual time in ns
+ */
+uint64_t native_vtime_now(void);
+
+/**
+ * @brief   Set the virtual time of the next timer target
+ *
+ * Called by periph_timer instead of arming a host timer. SIGALRM is raised
+ * once the virtual clock reached @p target.
+ *
+ * @param[in] target    virtual time in ns, 0 for none
+ */
+void native_vtime_set_target(uint64_t target);
+
+/**
+ * @brief   Wait for the next event with all threads idle
+ *
+ * Called by pm_set_lowest() instead of pausing the process.
+ */
+void native_vtime_idle(void);
+
+/**
+ * @brief   Report an I/O event
+ *
+ * Called by the async read dispatcher, marks the instance busy towards the
+ * coordinator.
+ *
+ * @param[in] fd    file descriptor that is ready
+ */
+void native_vtime_busy(int fd);
+
+/**
+ * @brief   Connect to a coordinator
+ *
+ * Blocks until the coordinator sent its current time.
+ *
+ * @param[in] path  path of the coordinator's UNIX socket
+ */
+void native_vtime_connect(const char *path);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* NATIVE_VTIME_H */
+/** @} */
@@ -35,6 +35,17 @@ extern "C" {
 #include "net/if.h"
 #endif
 
+/**
+ * @brief   Maximum number of frames handled per interrupt
+ *
+ * All frames that are queued on the tap device when its interrupt is
+ * serviced are passed up, up to this many, before the device is re-armed.
+ * This saves a signal and a context switch per frame under load.
+ */
+#ifndef NETDEV_TAP_RX_BURST
+#define NETDEV_TAP_RX_BURST     (16U)
+#endif
+
 /**
  * @brief tap interface state
  */
@@ -21,32 +21,35 @@
 #endif
 
 /**
- * @name hardware timer clock skew avoidance
+ * @name Random Number Generator configuration
  * @{
  */
-#define NATIVE_TIMER_MIN_RES 200
+#define RANDOM_NUMOF        (1U)
 /** @} */
 
 /**
- * @name Random Number Generator configuration
+ * @name RealTime Clock configuration
  * @{
  */
-#define RANDOM_NUMOF        (1U)
+#define RTC_NUMOF (1)
 /** @} */
 
 /**
- * @name RealTime Clock configuration
+ * @name Real Time Timer configuration
  * @{
  */
-#define RTC_NUMOF (1)
+#define RTT_FREQUENCY       (1000U)
+#define RTT_MAX_VALUE       (0xffffffff)
 /** @} */
 
 /**
  * @name Timer peripheral configuration
  * @{
  */
-#define TIMER_NUMOF        (1U)
+#define TIMER_NUMOF        (2U)
+#define TIMER_CHANNELS     (4U)
 #define TIMER_0_EN         1
+#define TIMER_1_EN         1
 
 /**
  * @brief xtimer configuration
@@ -54,12 +57,12 @@
  */
 #define XTIMER_OVERHEAD 14
 
-/* timer_set_absolute() has a high margin for possible underflow if set with
- * value not far in the future. To prevent this, we set high backoff values
- * here.
+/* Targets are absolute host times, so a target that passed while being set
+ * still fires right away. The backoffs only need to cover the signal
+ * delivery latency.
  */
-#define XTIMER_BACKOFF      200
-#define XTIMER_ISR_BACKOFF  200
+#define XTIMER_BACKOFF      20
+#define XTIMER_ISR_BACKOFF  20
 
 /** @} */
 
@@ -13,6 +13,10 @@
  *
  * @see @ref net_zep for protocol definitions
  *
+ * To connect several native instances, point all of them to
+ * `dist/tools/zep_dispatch/zep_dispatch.py`, which simulates the medium
+ * between them, optionally following a topology with lossy links.
+ *
  * @{
  *
  * @file
@@ -39,6 +39,7 @@
 #include "periph/pm.h"
 
 #include "native_internal.h"
+#include "trace_rec.h"
 
 #define ENABLE_DEBUG (0)
 #include "debug.h"
@@ -260,7 +261,9 @@ void native_irq_handler(void)
 
         if (native_irq_handlers[sig] != NULL) {
             DEBUG("native_irq_handler: calling interrupt handler for %i\n", sig);
+            trace_rec_isr_enter(sig);
             native_irq_handlers[sig]();
+            trace_rec_isr_exit(sig);
         }
         else if (sig == SIGUSR1) {
             warnx("native_irq_handler: ignoring SIGUSR1");
@@ -28,6 +28,9 @@
 #include <sys/ioctl.h>
 #include <sys/uio.h>
 #include <unistd.h>
+#ifdef __linux__
+#include <poll.h>
+#endif
 
 /* needs to be included before native's declarations of ntohl etc. */
 #include "byteorder.h"
@@ -94,16 +97,48 @@ static inline int _set_promiscous(netdev_t *netdev, int value)
     return value;
 }
 
-static inline void _isr(netdev_t *netdev)
+static bool _frame_pending(netdev_tap_t *dev)
 {
+    bool res;
+
+    _native_syscall_enter();
+#ifdef __linux__
+    struct pollfd pfd = { .fd = dev->tap_fd, .events = POLLIN };
+    res = (poll(&pfd, 1, 0) == 1);
+#else
+    fd_set rfds;
+    struct timeval t;
+    memset(&t, 0, sizeof(t));
+    FD_ZERO(&rfds);
+    FD_SET(dev->tap_fd, &rfds);
+    res = (real_select(dev->tap_fd + 1, &rfds, NULL, NULL, &t) == 1);
+#endif
+    _native_syscall_leave();
+
+    return res;
+}
+
+static void _isr(netdev_t *netdev)
+{
+    netdev_tap_t *dev = (netdev_tap_t*)netdev;
+
     if (netdev->event_callback) {
-        netdev->event_callback(netdev, NETDEV_EVENT_RX_COMPLETE);
+        /* the fd stays disarmed while draining, so the frames that are
+         * already queued don't raise a SIGIO each */
+        unsigned frames = 0;
+        do {
+            netdev->event_callback(netdev, NETDEV_EVENT_RX_COMPLETE);
+        } while ((++frames < NETDEV_TAP_RX_BURST) && _frame_pending(dev));
+        DEBUG("netdev_tap: handled %u frames\n", frames);
     }
 #if DEVELHELP
     else {
         puts("netdev_tap: _isr(): no event_callback set.");
     }
 #endif
+
+    /* raises the next event right away if frames are left */
+    native_async_read_continue(dev->tap_fd);
 }
 
 static int _get(netdev_t *dev, netopt_t opt, void *value, size_t max_len)
@@ -177,33 +212,6 @@ static inline bool _is_addr_multicast(uint8_t *addr)
     return (addr[0] & 0x01);
 }
 
-static void _continue_reading(netdev_tap_t *dev)
-{
-    /* work around lost signals */
-    fd_set rfds;
-    struct timeval t;
-    memset(&t, 0, sizeof(t));
-    FD_ZERO(&rfds);
-    FD_SET(dev->tap_fd, &rfds);
-
-    _native_in_syscall++; /* no switching here */
-
-    if (real_select(dev->tap_fd + 1, &rfds, NULL, NULL, &t) == 1) {
-        int sig = SIGIO;
-        extern int _sig_pipefd[2];
-        extern ssize_t (*real_write)(int fd, const void * buf, size_t count);
-        real_write(_sig_pipefd[1], &sig, sizeof(int));
-        _native_sigpend++;
-        DEBUG("netdev_tap: sigpend++\n");
-    }
-    else {
-        DEBUG("netdev_tap: native_async_read_continue\n");
-        native_async_read_continue(dev->tap_fd);
-    }
-
-    _native_in_syscall--;
-}
-
 static int _recv(netdev_t *netdev, void *buf, size_t len, void *info)
 {
     netdev_tap_t *dev = (netdev_tap_t*)netdev;
@@ -225,8 +233,6 @@ static int _recv(netdev_t *netdev, void *buf, size_t len, void *info)
             static uint8_t nullbuf[ETHERNET_FRAME_LEN];
 
             real_read(dev->tap_fd, nullbuf, sizeof(nullbuf));
-
-            _continue_reading(dev);
         }
 
         /* no way of figuring out packet size without racey buffering,
@@ -247,13 +253,9 @@ static int _recv(netdev_t *netdev, void *buf, size_t len, void *info)
                   hdr->dst[0], hdr->dst[1], hdr->dst[2],
                   hdr->dst[3], hdr->dst[4], hdr->dst[5]);
 
-            native_async_read_continue(dev->tap_fd);
-
             return 0;
         }
 
-        _continue_reading(dev);
-
 #ifdef MODULE_NETSTATS_L2
         netdev->stats.rx_count++;
         netdev->stats.rx_bytes += nread;
@@ -281,6 +283,7 @@ static int _send(netdev_t *netdev, const iolist_t *iolist)
 {
     netdev_tap_t *dev = (netdev_tap_t*)netdev;
 
+    /* the frame is handed to the host in one go, without copying it */
     struct iovec iov[iolist_count(iolist)];
 
     unsigned n;
@@ -390,7 +393,8 @@ static int _init(netdev_t *netdev)
 
     /* configure signal handler for fds */
     native_async_read_setup();
-    native_async_read_add_handler(dev->tap_fd, netdev, _tap_isr);
+    native_async_read_add_handler_flags(dev->tap_fd, netdev, _tap_isr,
+                                        ASYNC_READ_ONESHOT);
 
 #ifdef MODULE_NETSTATS_L2
     memset(&netdev->stats, 0, sizeof(netstats_t));
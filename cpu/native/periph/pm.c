@@ -18,6 +18,7 @@
  */
 
 #include <err.h>
+#include <signal.h>
 #include <stdio.h>
 #include <stdlib.h>
 
@@ -25,15 +26,36 @@
 #include "native_internal.h"
 #include "async_read.h"
 #include "tty_uart.h"
+#ifdef MODULE_NATIVE_VTIME
+#include "native_vtime.h"
+#endif
 
 #define ENABLE_DEBUG (0)
 #include "debug.h"
 
 void pm_set_lowest(void)
 {
+#ifdef MODULE_NATIVE_VTIME
+    native_vtime_idle();
+#else
+    sigset_t all, prev;
+
     _native_in_syscall++; /* no switching here */
-    real_pause();
+    /* a signal arriving between checking _native_sigpend and pausing would
+     * only be handled after the next one, so sigsuspend() unblocks signals
+     * and waits at once */
+    sigfillset(&all);
+    if (sigprocmask(SIG_SETMASK, &all, &prev) == -1) {
+        err(EXIT_FAILURE, "pm_set_lowest: sigprocmask");
+    }
+    if (_native_sigpend == 0) {
+        sigsuspend(&prev);
+    }
+    if (sigprocmask(SIG_SETMASK, &prev, NULL) == -1) {
+        err(EXIT_FAILURE, "pm_set_lowest: sigprocmask");
+    }
     _native_in_syscall--;
+#endif
 
     if (_native_sigpend > 0) {
         _native_in_syscall++;
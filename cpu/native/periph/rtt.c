@@ -0,0 +1,201 @@
+/*
+ * Copyright (C) 2026 agent <agent@local>
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     cpu_native
+ * @ingroup     drivers_periph_rtt
+ * @{
+ *
+ * @file
+ * @brief       Native CPU periph/rtt.h implementation
+ *
+ * The counter is derived from the host's monotonic clock. Alarms and the
+ * overflow callback share one POSIX per-process timer which raises SIGUSR2,
+ * so the RTT runs independently of the periph/timer, which uses SIGALRM.
+ *
+ * @author      agent <agent@local>
+ *
+ * @}
+ */
+
+#include <inttypes.h>
+#include <signal.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <err.h>
+
+#include "cpu.h"
+#include "native_internal.h"
+#include "periph/rtt.h"
+
+#define ENABLE_DEBUG (0)
+#include "debug.h"
+
+#define NATIVE_RTT_SIGNAL   (SIGUSR2)
+
+static timer_t _timer;
+static uint32_t _offset;
+static uint32_t _last;
+static int _powered;
+
+static uint32_t _alarm;
+static rtt_cb_t _alarm_cb;
+static void *_alarm_arg;
+
+static rtt_cb_t _overflow_cb;
+static void *_overflow_arg;
+
+static uint32_t _read_host(void)
+{
+    struct timespec t;
+
+    _native_syscall_enter();
+    if (real_clock_gettime(CLOCK_MONOTONIC, &t) == -1) {
+        err(EXIT_FAILURE, "rtt: clock_gettime");
+    }
+    _native_syscall_leave();
+
+    return ((uint32_t)t.tv_sec * RTT_FREQUENCY) +
+           (uint32_t)(t.tv_nsec / (1000000000LU / RTT_FREQUENCY));
+}
+
+static void _arm(void)
+{
+    struct itimerspec its;
+    uint32_t now = rtt_get_counter();
+    uint64_t ticks = 0;
+
+    if (_overflow_cb) {
+        ticks = (uint64_t)(RTT_MAX_VALUE - now) + 1;
+    }
+    if (_alarm_cb) {
+        uint32_t to_alarm = (_alarm - now) & RTT_MAX_VALUE;
+        if (!to_alarm) {
+            /* a zero it_value would disarm the host timer */
+            to_alarm = 1;
+        }
+        if (!ticks || (to_alarm < ticks)) {
+            ticks = to_alarm;
+        }
+    }
+    if (!_powered) {
+        ticks = 0;
+    }
+
+    memset(&its, 0, sizeof(its));
+    its.it_value.tv_sec = ticks / RTT_FREQUENCY;
+    its.it_value.tv_nsec = (ticks % RTT_FREQUENCY) *
+                           (1000000000LU / RTT_FREQUENCY);
+
+    DEBUG("rtt: arming in %" PRIu32 " ticks\n", (uint32_t)ticks);
+
+    _native_syscall_enter();
+    if (timer_settime(_timer, 0, &its, NULL) == -1) {
+        err(EXIT_FAILURE, "rtt: timer_settime");
+    }
+    _native_syscall_leave();
+}
+
+static void _native_isr_rtt(void)
+{
+    uint32_t now = rtt_get_counter();
+
+    if (_overflow_cb && (now < _last)) {
+        _overflow_cb(_overflow_arg);
+    }
+    _last = now;
+
+    if (_alarm_cb && (((now - _alarm) & RTT_MAX_VALUE) < (RTT_MAX_VALUE >> 1))) {
+        rtt_cb_t cb = _alarm_cb;
+        _alarm_cb = NULL;
+        cb(_alarm_arg);
+    }
+
+    _arm();
+}
+
+void rtt_init(void)
+{
+    struct sigevent sev;
+
+    memset(&sev, 0, sizeof(sev));
+    sev.sigev_notify = SIGEV_SIGNAL;
+    sev.sigev_signo = NATIVE_RTT_SIGNAL;
+
+    _native_syscall_enter();
+    if (timer_create(CLOCK_MONOTONIC, &sev, &_timer) == -1) {
+        err(EXIT_FAILURE, "rtt_init: timer_create");
+    }
+    _native_syscall_leave();
+
+    if (register_interrupt(NATIVE_RTT_SIGNAL, _native_isr_rtt) != 0) {
+        DEBUG("rtt_init: register_interrupt failed\n");
+    }
+
+    _offset = _read_host();
+    _last = 0;
+    rtt_poweron();
+}
+
+void rtt_set_overflow_cb(rtt_cb_t cb, void *arg)
+{
+    _overflow_arg = arg;
+    _overflow_cb = cb;
+    _arm();
+}
+
+void rtt_clear_overflow_cb(void)
+{
+    _overflow_cb = NULL;
+    _arm();
+}
+
+uint32_t rtt_get_counter(void)
+{
+    return (_read_host() - _offset) & RTT_MAX_VALUE;
+}
+
+void rtt_set_counter(uint32_t counter)
+{
+    _offset = _read_host() - counter;
+    _last = counter & RTT_MAX_VALUE;
+    _arm();
+}
+
+void rtt_set_alarm(uint32_t alarm, rtt_cb_t cb, void *arg)
+{
+    _alarm = alarm & RTT_MAX_VALUE;
+    _alarm_arg = arg;
+    _alarm_cb = cb;
+    _arm();
+}
+
+uint32_t rtt_get_alarm(void)
+{
+    return _alarm;
+}
+
+void rtt_clear_alarm(void)
+{
+    _alarm_cb = NULL;
+    _arm();
+}
+
+void rtt_poweron(void)
+{
+    _powered = 1;
+    _arm();
+}
+
+void rtt_poweroff(void)
+{
+    _powered = 0;
+    _arm();
+}
@@ -15,7 +15,20 @@
  * @file
  * @brief       Native CPU periph/timer.h implementation
  *
- * Uses POSIX realtime clock and POSIX itimer to mimic hardware.
+ * Uses the host's monotonic clock and one POSIX per-process timer to mimic
+ * hardware.
+ *
+ * Every channel of every timer device stores its target as an absolute
+ * point in time of the host's CLOCK_MONOTONIC. The host timer is armed with
+ * TIMER_ABSTIME for the earliest target, so targets don't drift with the
+ * time spent between reading the counter and arming the host timer. The
+ * resulting SIGALRM fires all channels that are due.
+ *
+ * OS X lacks POSIX per-process timers, there the earliest target is armed
+ * as relative ITIMER_REAL instead.
+ *
+ * With module native_vtime, the clock and the host timer are replaced by
+ * the virtual clock, see @ref cpu_native_vtime.
  *
  * This is based on native's hwtimer implementation by Ludwig Knüpfer.
  * I removed the multiplexing, as xtimer does the same. (kaspar)
@@ -35,9 +48,11 @@
 #define thread_t riot_thread_t
 #endif
 
+#include <inttypes.h>
 #include <time.h>
 #include <sys/time.h>
 #include <signal.h>
+#include <stdbool.h>
 #include <stdint.h>
 #include <stdlib.h>
 #include <string.h>
@@ -47,43 +62,147 @@
 #include "cpu_conf.h"
 #include "native_internal.h"
 #include "periph/timer.h"
+#ifdef MODULE_NATIVE_VTIME
+#include "native_vtime.h"
+#endif
 
 #define ENABLE_DEBUG (0)
 #include "debug.h"
 
 #define NATIVE_TIMER_SPEED 1000000
 
-static unsigned long time_null;
+#define NS_PER_TICK     (1000000000LU / NATIVE_TIMER_SPEED)
 
-static timer_cb_t _callback;
-static void *_cb_arg;
+typedef struct {
+    uint64_t target[TIMER_CHANNELS];    /**< host time in ns, 0 if unset */
+    unsigned int time_null;             /**< host ticks at timer_init() */
+    timer_cb_t cb;
+    void *arg;
+    bool running;
+} _timer_t;
 
-static struct itimerval itv;
+static _timer_t _timers[TIMER_NUMOF];
+
+#if !defined(__MACH__) && !defined(MODULE_NATIVE_VTIME)
+static timer_t _host_timer;
+#endif
+static bool _host_timer_created;
 
 /**
- * returns ticks for give timespec
+ * returns the host's monotonic clock in ns
  */
-static unsigned long ts2ticks(struct timespec *tp)
+static uint64_t _host_ns(void)
 {
-    /* TODO: check for overflow */
-    return((tp->tv_sec * NATIVE_TIMER_SPEED) + (tp->tv_nsec / 1000));
+#ifdef MODULE_NATIVE_VTIME
+    return native_vtime_now();
+#else
+    struct timespec t;
+
+    _native_syscall_enter();
+#ifdef __MACH__
+    clock_serv_t cclock;
+    mach_timespec_t mts;
+    host_get_clock_service(mach_host_self(), SYSTEM_CLOCK, &cclock);
+    clock_get_time(cclock, &mts);
+    mach_port_deallocate(mach_task_self(), cclock);
+    t.tv_sec = mts.tv_sec;
+    t.tv_nsec = mts.tv_nsec;
+#else
+
+    if (real_clock_gettime(CLOCK_MONOTONIC, &t) == -1) {
+        err(EXIT_FAILURE, "timer_read: clock_gettime");
+    }
+
+#endif
+    _native_syscall_leave();
+
+    return ((uint64_t)t.tv_sec * 1000000000LU) + t.tv_nsec;
+#endif
+}
+
+/**
+ * arm the host timer for the earliest target of all running timers
+ */
+static void _arm(void)
+{
+    uint64_t next = 0;
+
+    for (unsigned dev = 0; dev < TIMER_NUMOF; dev++) {
+        if (!_timers[dev].running) {
+            continue;
+        }
+        for (unsigned chan = 0; chan < TIMER_CHANNELS; chan++) {
+            uint64_t target = _timers[dev].target[chan];
+            if (target && (!next || (target < next))) {
+                next = target;
+            }
+        }
+    }
+
+    DEBUG("timer: arming for %" PRIu32 ".%09" PRIu32 "\n",
+          (uint32_t)(next / 1000000000LU), (uint32_t)(next % 1000000000LU));
+
+#ifdef MODULE_NATIVE_VTIME
+    native_vtime_set_target(next);
+#else
+    _native_syscall_enter();
+#ifdef __MACH__
+    struct itimerval itv;
+    memset(&itv, 0, sizeof(itv));
+    if (next) {
+        uint64_t now = _host_ns();
+        /* a zero it_value would disarm the host timer */
+        uint64_t usec = (next > now) ? (next - now + 999) / 1000 : 1;
+        itv.it_value.tv_sec = usec / 1000000;
+        itv.it_value.tv_usec = usec % 1000000;
+    }
+    if (real_setitimer(ITIMER_REAL, &itv, NULL) == -1) {
+        err(EXIT_FAILURE, "timer_arm: setitimer");
+    }
+#else
+    /* a target in the past expires right away */
+    struct itimerspec its;
+    memset(&its, 0, sizeof(its));
+    its.it_value.tv_sec = next / 1000000000LU;
+    its.it_value.tv_nsec = next % 1000000000LU;
+    if (timer_settime(_host_timer, TIMER_ABSTIME, &its, NULL) == -1) {
+        err(EXIT_FAILURE, "timer_arm: timer_settime");
+    }
+#endif
+    _native_syscall_leave();
+#endif
 }
 
 /**
  * native timer signal handler
  *
- * set new system timer, call timer interrupt handler
+ * call the callbacks of all due channels, set new system timer
  */
 void native_isr_timer(void)
 {
     DEBUG("%s\n", __func__);
 
-    _callback(_cb_arg, 0);
+    uint64_t now = _host_ns();
+
+    for (unsigned dev = 0; dev < TIMER_NUMOF; dev++) {
+        _timer_t *timer = &_timers[dev];
+
+        if (!timer->running) {
+            continue;
+        }
+        for (unsigned chan = 0; chan < TIMER_CHANNELS; chan++) {
+            if (timer->target[chan] && (timer->target[chan] <= now)) {
+                timer->target[chan] = 0;
+                timer->cb(timer->arg, chan);
+            }
+        }
+    }
+
+    _arm();
 }
 
 int timer_init(tim_t dev, unsigned long freq, timer_cb_t cb, void *arg)
 {
-    (void)freq;
     DEBUG("%s\n", __func__);
     if (dev >= TIMER_NUMOF) {
         return -1;
@@ -92,84 +211,105 @@ int timer_init(tim_t dev, unsigned long freq, timer_cb_t cb, void *arg)
         return -1;
     }
 
-    /* initialize time delta */
-    time_null = 0;
-    time_null = timer_read(0);
+    if (!_host_timer_created) {
+#if !defined(__MACH__) && !defined(MODULE_NATIVE_VTIME)
+        struct sigevent sev;
 
-    _callback = cb;
-    _cb_arg = arg;
-    if (register_interrupt(SIGALRM, native_isr_timer) != 0) {
-        DEBUG("darn!\n\n");
-    }
+        memset(&sev, 0, sizeof(sev));
+        sev.sigev_notify = SIGEV_SIGNAL;
+        sev.sigev_signo = SIGALRM;
 
-    return 0;
-}
-
-static void do_timer_set(unsigned int offset)
-{
-    DEBUG("%s\n", __func__);
-
-    if (offset && offset < NATIVE_TIMER_MIN_RES) {
-        offset = NATIVE_TIMER_MIN_RES;
+        _native_syscall_enter();
+        if (timer_create(CLOCK_MONOTONIC, &sev, &_host_timer) == -1) {
+            err(EXIT_FAILURE, "timer_init: timer_create");
+        }
+        _native_syscall_leave();
+#endif
+        if (register_interrupt(SIGALRM, native_isr_timer) != 0) {
+            DEBUG("darn!\n\n");
+        }
+        _host_timer_created = true;
     }
 
-    memset(&itv, 0, sizeof(itv));
-    itv.it_value.tv_sec = (offset / 1000000);
-    itv.it_value.tv_usec = offset % 1000000;
+    _timer_t *timer = &_timers[dev];
 
-    DEBUG("timer_set(): setting %u.%06u\n", (unsigned)itv.it_value.tv_sec, (unsigned)itv.it_value.tv_usec);
+    /* initialize time delta */
+    memset(timer->target, 0, sizeof(timer->target));
+    timer->time_null = 0;
+    timer->time_null = timer_read(dev);
+    timer->cb = cb;
+    timer->arg = arg;
+    timer->running = true;
 
-    _native_syscall_enter();
-    if (real_setitimer(ITIMER_REAL, &itv, NULL) == -1) {
-        err(EXIT_FAILURE, "timer_arm: setitimer");
-    }
-    _native_syscall_leave();
+    _arm();
+
+    return 0;
 }
 
 int timer_set(tim_t dev, int channel, unsigned int offset)
 {
-    (void)dev;
     DEBUG("%s\n", __func__);
 
-    if (channel != 0) {
+    if ((dev >= TIMER_NUMOF) || ((unsigned)channel >= TIMER_CHANNELS)) {
         return -1;
     }
 
-    if (!offset) {
-        offset = NATIVE_TIMER_MIN_RES;
-    }
-
-    do_timer_set(offset);
+    _timers[dev].target[channel] = _host_ns() + (uint64_t)offset * NS_PER_TICK;
+    _arm();
 
     return 1;
 }
 
 int timer_set_absolute(tim_t dev, int channel, unsigned int value)
 {
-    uint32_t now = timer_read(dev);
-    return timer_set(dev, channel, value - now);
+    if ((dev >= TIMER_NUMOF) || ((unsigned)channel >= TIMER_CHANNELS)) {
+        return -1;
+    }
+
+    /* derive the target from the same clock reading as "now", so it is
+     * exact */
+    uint64_t now_ns = _host_ns();
+    unsigned int now = (unsigned int)(now_ns / NS_PER_TICK) -
+                       _timers[dev].time_null;
+    unsigned int offset = value - now;
+
+    _timers[dev].target[channel] = now_ns - (now_ns % NS_PER_TICK) +
+                                   (uint64_t)offset * NS_PER_TICK;
+    _arm();
+
+    return 1;
 }
 
 int timer_clear(tim_t dev, int channel)
 {
-    (void)dev;
-    (void)channel;
+    if ((dev >= TIMER_NUMOF) || ((unsigned)channel >= TIMER_CHANNELS)) {
+        return -1;
+    }
 
-    do_timer_set(0);
+    _timers[dev].target[channel] = 0;
+    _arm();
 
     return 1;
 }
 
 void timer_start(tim_t dev)
 {
-    (void)dev;
     DEBUG("%s\n", __func__);
+
+    if (dev < TIMER_NUMOF) {
+        _timers[dev].running = true;
+        _arm();
+    }
 }
 
 void timer_stop(tim_t dev)
 {
-    (void)dev;
     DEBUG("%s\n", __func__);
+
+    if (dev < TIMER_NUMOF) {
+        _timers[dev].running = false;
+        _arm();
+    }
 }
 
 unsigned int timer_read(tim_t dev)
@@ -178,27 +318,7 @@ unsigned int timer_read(tim_t dev)
         return 0;
     }
 
-    struct timespec t;
-
     DEBUG("timer_read()\n");
 
-    _native_syscall_enter();
-#ifdef __MACH__
-    clock_serv_t cclock;
-    mach_timespec_t mts;
-    host_get_clock_service(mach_host_self(), SYSTEM_CLOCK, &cclock);
-    clock_get_time(cclock, &mts);
-    mach_port_deallocate(mach_task_self(), cclock);
-    t.tv_sec = mts.tv_sec;
-    t.tv_nsec = mts.tv_nsec;
-#else
-
-    if (real_clock_gettime(CLOCK_MONOTONIC, &t) == -1) {
-        err(EXIT_FAILURE, "timer_read: clock_gettime");
-    }
-
-#endif
-    _native_syscall_leave();
-
-    return ts2ticks(&t) - time_null;
+    return (unsigned int)(_host_ns() / NS_PER_TICK) - _timers[dev].time_null;
 }
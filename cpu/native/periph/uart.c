@@ -94,8 +94,6 @@ static void io_signal_handler(int fd, void *arg)
     if (!is_first) {
         DEBUG("\n");
     }
-
-    native_async_read_continue(fd);
 }
 
 int uart_init(uart_t uart, uint32_t baudrate, uart_rx_cb_t rx_cb, void *arg)
@@ -155,7 +153,9 @@ int uart_init(uart_t uart, uint32_t baudrate, uart_rx_cb_t rx_cb, void *arg)
     uart_config[uart].arg = arg;
 
     native_async_read_setup();
-    native_async_read_add_handler(tty_fds[uart], NULL, io_signal_handler);
+    /* io_signal_handler() reads until the tty would block */
+    native_async_read_add_handler_flags(tty_fds[uart], NULL, io_signal_handler,
+                                        ASYNC_READ_EDGE);
 
     return UART_OK;
 }
@@ -0,0 +1,278 @@
+/*
+ * Copyright (C) 2026 agent <agent@local>
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     cpu_native_prof
+ * @{
+ *
+ * @file
+ * @brief       SIGPROF based sampling profiler
+ *
+ * @author      agent <agent@local>
+ *
+ * @}
+ */
+
+#ifndef _GNU_SOURCE
+#define _GNU_SOURCE
+#endif
+#include <dlfcn.h>
+#include <err.h>
+#include <errno.h>
+#include <execinfo.h>
+#include <inttypes.h>
+#include <signal.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/time.h>
+#include <ucontext.h>
+
+#include "msg.h"
+#include "sched.h"
+#include "thread.h"
+
+#include "native_internal.h"
+#include "native_prof.h"
+
+#define ENABLE_DEBUG (0)
+#include "debug.h"
+
+#if (NATIVE_PROF_STACKS & (NATIVE_PROF_STACKS - 1))
+#error "NATIVE_PROF_STACKS must be a power of 2"
+#endif
+
+/* frames of the signal handler and the signal trampoline */
+#define HANDLER_FRAMES  (2U)
+
+/* give up looking for a free slot after this many probes */
+#define MAX_PROBES      (16U)
+
+#define LINE_LEN        (2048U)
+
+typedef struct {
+    unsigned count;
+    uint32_t hash;
+    kernel_pid_t pid;
+    uint16_t depth;
+    void *frames[NATIVE_PROF_DEPTH];
+} _stack_t;
+
+static _stack_t _stacks[NATIVE_PROF_STACKS];
+static unsigned _samples;
+static unsigned _dropped;
+static volatile int _paused;
+
+static void *_pc(void *context)
+{
+#ifdef __MACH__
+    return (void *)((ucontext_t *)context)->uc_mcontext->__ss.__eip;
+#elif defined(__FreeBSD__)
+    return (void *)((struct sigcontext *)context)->sc_eip;
+#elif defined(__arm__)
+    return (void *)((ucontext_t *)context)->uc_mcontext.arm_pc;
+#else
+    return (void *)((ucontext_t *)context)->uc_mcontext.gregs[REG_EIP];
+#endif
+}
+
+static uint32_t _hash(kernel_pid_t pid, void **frames, unsigned depth)
+{
+    /* FNV-1a over the pid and the frame addresses */
+    uint32_t hash = 2166136261U ^ (uint16_t)pid;
+
+    for (unsigned i = 0; i < depth; i++) {
+        hash = (hash ^ (uint32_t)(uintptr_t)frames[i]) * 16777619U;
+    }
+
+    return hash;
+}
+
+static void _add(kernel_pid_t pid, void **frames, unsigned depth)
+{
+    uint32_t hash = _hash(pid, frames, depth);
+
+    _samples++;
+
+    for (unsigned i = 0; i < MAX_PROBES; i++) {
+        _stack_t *stack = &_stacks[(hash + i) & (NATIVE_PROF_STACKS - 1)];
+
+        if (stack->count == 0) {
+            stack->hash = hash;
+            stack->pid = pid;
+            stack->depth = depth;
+            memcpy(stack->frames, frames, depth * sizeof(void *));
+            stack->count = 1;
+            return;
+        }
+        if ((stack->hash == hash) && (stack->pid == pid) &&
+            (stack->depth == depth) &&
+            !memcmp(stack->frames, frames, depth * sizeof(void *))) {
+            stack->count++;
+            return;
+        }
+    }
+
+    _dropped++;
+}
+
+static void _sample(int sig, siginfo_t *info, void *context)
+{
+    (void)sig;
+    (void)info;
+
+    void *frames[NATIVE_PROF_DEPTH + HANDLER_FRAMES];
+    int saved_errno = errno;
+
+    if (_paused) {
+        return;
+    }
+
+    int depth = backtrace(frames, NATIVE_PROF_DEPTH + HANDLER_FRAMES);
+    void *pc = _pc(context);
+    unsigned start = HANDLER_FRAMES;
+
+    /* skip everything up to the interrupted instruction */
+    for (int i = 0; i < depth; i++) {
+        if (frames[i] == pc) {
+            start = i;
+            break;
+        }
+    }
+
+    if ((int)start < depth) {
+        kernel_pid_t pid = _native_in_isr ? KERNEL_PID_ISR : sched_active_pid;
+        _add(pid, &frames[start], depth - start);
+    }
+
+    errno = saved_errno;
+}
+
+void native_prof_start(void)
+{
+    struct sigaction sa;
+    struct itimerval itv;
+    void *dummy[1];
+
+    /* the first call to backtrace() might load libgcc, which is not async
+     * signal safe, so do it here */
+    backtrace(dummy, 1);
+
+    memset(&sa, 0, sizeof(sa));
+    sa.sa_sigaction = _sample;
+    sa.sa_flags = SA_SIGINFO | SA_RESTART;
+    /* keep RIOT's emulated interrupts from interrupting a sample */
+    sigfillset(&sa.sa_mask);
+    if (sigaction(SIGPROF, &sa, NULL) == -1) {
+        err(EXIT_FAILURE, "native_prof_start: sigaction");
+    }
+
+    itv.it_interval.tv_sec = 0;
+    itv.it_interval.tv_usec = 1000000LU / NATIVE_PROF_HZ;
+    itv.it_value = itv.it_interval;
+    if (setitimer(ITIMER_PROF, &itv, NULL) == -1) {
+        err(EXIT_FAILURE, "native_prof_start: setitimer");
+    }
+}
+
+void native_prof_stop(void)
+{
+    struct itimerval itv;
+
+    memset(&itv, 0, sizeof(itv));
+    if (setitimer(ITIMER_PROF, &itv, NULL) == -1) {
+        err(EXIT_FAILURE, "native_prof_stop: setitimer");
+    }
+}
+
+void native_prof_reset(void)
+{
+    _paused = 1;
+    memset(_stacks, 0, sizeof(_stacks));
+    _samples = 0;
+    _dropped = 0;
+    _paused = 0;
+}
+
+static size_t _append_thread(char *line, size_t len, kernel_pid_t pid)
+{
+    const char *name = NULL;
+
+    if (pid == KERNEL_PID_ISR) {
+        name = "isr";
+    }
+    else if (pid == KERNEL_PID_UNDEF) {
+        name = "startup";
+    }
+    else {
+        name = thread_getname(pid);
+    }
+
+    if (name) {
+        return snprintf(line + len, LINE_LEN - len, "%s", name);
+    }
+    return snprintf(line + len, LINE_LEN - len, "pid %" PRIkernel_pid, pid);
+}
+
+static size_t _append_frame(char *line, size_t len, void *addr, int caller)
+{
+    Dl_info info;
+
+    /* a caller's frame holds the return address, which might belong to the
+     * next function already */
+    void *lookup = caller ? (void *)((uintptr_t)addr - 1) : addr;
+
+    if (dladdr(lookup, &info) && info.dli_sname) {
+        return snprintf(line + len, LINE_LEN - len, ";%s", info.dli_sname);
+    }
+    return snprintf(line + len, LINE_LEN - len, ";%p", addr);
+}
+
+int native_prof_write(int fd)
+{
+    static char line[LINE_LEN];
+    int res = 0;
+
+    _paused = 1;
+
+    for (unsigned i = 0; i < NATIVE_PROF_STACKS; i++) {
+        _stack_t *stack = &_stacks[i];
+
+        if (stack->count == 0) {
+            continue;
+        }
+
+        size_t len = _append_thread(line, 0, stack->pid);
+        /* frames[0] is the innermost one */
+        for (int f = stack->depth - 1; (f >= 0) && (len < LINE_LEN); f--) {
+            len += _append_frame(line, len, stack->frames[f], f > 0);
+        }
+        if (len >= LINE_LEN - 16) {
+            /* the stack was cut, keep room for the count */
+            len = LINE_LEN - 16;
+        }
+        len += snprintf(line + len, LINE_LEN - len, " %u\n", stack->count);
+
+        if (real_write(fd, line, len) != (ssize_t)len) {
+            res = -1;
+            break;
+        }
+        res++;
+    }
+
+    DEBUG("native_prof: %u samples, %u dropped\n", _samples, _dropped);
+    if (_dropped) {
+        warnx("native_prof: %u of %u samples dropped, increase "
+              "NATIVE_PROF_STACKS", _dropped, _samples);
+    }
+
+    _paused = 0;
+
+    return res;
+}
@@ -129,31 +129,6 @@ static int _send(netdev_t *netdev, const iolist_t *iolist)
     return res - v[0].iov_len - v[n + 1].iov_len;
 }
 
-static void _continue_reading(socket_zep_t *dev)
-{
-    /* work around lost signals */
-    fd_set rfds;
-    struct timeval t;
-    memset(&t, 0, sizeof(t));
-    FD_ZERO(&rfds);
-    FD_SET(dev->sock_fd, &rfds);
-
-    _native_in_syscall++; /* no switching here */
-
-    if (real_select(dev->sock_fd + 1, &rfds, NULL, NULL, &t) == 1) {
-        int sig = SIGIO;
-        extern int _sig_pipefd[2];
-        extern ssize_t (*real_write)(int fd, const void * buf, size_t count);
-        real_write(_sig_pipefd[1], &sig, sizeof(int));
-        _native_sigpend++;
-    }
-    else {
-        native_async_read_continue(dev->sock_fd);
-    }
-
-    _native_in_syscall--;
-}
-
 static inline bool _dst_not_me(socket_zep_t *dev, const void *buf)
 {
     uint8_t dst_addr[IEEE802154_LONG_ADDRESS_LEN] = { 0 };
@@ -194,6 +169,9 @@ static int _recv(netdev_t *netdev, void *buf, size_t len, void *info)
     }
     else if (len > 0) {
         size = real_read(dev->sock_fd, dev->rcv_buf, sizeof(dev->rcv_buf));
+        /* re-arm the socket, this raises the next event right away if more
+         * datagrams are pending */
+        native_async_read_continue(dev->sock_fd);
 
         if (size > 0) {
             zep_hdr_t *tmp = (zep_hdr_t *)&dev->rcv_buf;
@@ -251,7 +229,6 @@ static int _recv(netdev_t *netdev, void *buf, size_t len, void *info)
             errx(EXIT_FAILURE, "internal error _rx_event");
         }
     }
-    _continue_reading(dev);
 #ifdef MODULE_NETSTATS_L2
     netdev->stats.rx_count++;
     netdev->stats.rx_bytes += size;
@@ -411,7 +388,8 @@ void socket_zep_setup(socket_zep_t *dev, const socket_zep_params_t *params)
     dev->netdev.short_addr[0] = dev->netdev.long_addr[6];
     dev->netdev.short_addr[1] = dev->netdev.long_addr[7];
     native_async_read_setup();
-    native_async_read_add_handler(dev->sock_fd, dev, _socket_isr);
+    native_async_read_add_handler_flags(dev->sock_fd, dev, _socket_isr,
+                                        ASYNC_READ_ONESHOT);
 #ifdef MODULE_NETSTATS_L2
     memset(&dev->netdev.netdev.stats, 0, sizeof(netstats_t));
 #endif
@@ -420,8 +398,8 @@ void socket_zep_setup(socket_zep_t *dev, const socket_zep_params_t *params)
 void socket_zep_cleanup(socket_zep_t *dev)
 {
     assert(dev != NULL);
-    /* cleanup signal handling */
-    native_async_read_cleanup();
+    /* stop signal handling */
+    native_async_read_remove_handler(dev->sock_fd);
     /* close the socket */
     close(dev->sock_fd);
     dev->sock_fd = 0;
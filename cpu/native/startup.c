@@ -82,6 +82,19 @@ netdev_tap_params_t netdev_tap_params[NETDEV_TAP_MAX];
 
 socket_zep_params_t socket_zep_params[SOCKET_ZEP_MAX];
 #endif
+#ifdef MODULE_TRACE_REC
+#include "trace_rec.h"
+
+static const char *_trace_rec_file;
+#endif
+#ifdef MODULE_NATIVE_PROF
+#include "native_prof.h"
+
+static const char *_prof_file;
+#endif
+#ifdef MODULE_NATIVE_VTIME
+#include "native_vtime.h"
+#endif
 
 static const char short_opts[] = ":hi:s:deEoc:"
 #ifdef MODULE_MTD_NATIVE
@@ -92,6 +105,15 @@ static const char short_opts[] = ":hi:s:deEoc:"
 #endif
 #ifdef MODULE_SOCKET_ZEP
     "z:"
+#endif
+#ifdef MODULE_TRACE_REC
+    "t:"
+#endif
+#ifdef MODULE_NATIVE_PROF
+    "p:"
+#endif
+#ifdef MODULE_NATIVE_VTIME
+    "w:"
 #endif
     "";
 
@@ -112,6 +134,15 @@ static const struct option long_opts[] = {
 #endif
 #ifdef MODULE_SOCKET_ZEP
     { "zep", required_argument, NULL, 'z' },
+#endif
+#ifdef MODULE_TRACE_REC
+    { "trace-rec", required_argument, NULL, 't' },
+#endif
+#ifdef MODULE_NATIVE_PROF
+    { "prof", required_argument, NULL, 'p' },
+#endif
+#ifdef MODULE_NATIVE_VTIME
+    { "vtime-coord", required_argument, NULL, 'w' },
 #endif
     { NULL, 0, NULL, '\0' },
 };
@@ -292,10 +323,67 @@ void usage_exit(int status)
 "    -n <ifnum>:<ifname>, --can <ifnum>:<ifname>\n"
 "        specify CAN interface <ifname> to use for CAN device #<ifnum>\n"
 "        max number of CAN device: %d\n", CAN_DLL_NUMOF);
+#endif
+#ifdef MODULE_TRACE_REC
+    real_printf(
+"    -t <file>, --trace-rec=<file>\n"
+"        dump the trace recorder's buffer to <file> on exit\n");
+#endif
+#ifdef MODULE_NATIVE_PROF
+    real_printf(
+"    -p <file>, --prof=<file>\n"
+"        profile the instance and write folded stacks to <file> on exit\n");
+#endif
+#ifdef MODULE_NATIVE_VTIME
+    real_printf(
+"    -w <socket>, --vtime-coord=<socket>\n"
+"        advance virtual time in lock-step with the instances connected to\n"
+"        the coordinator listening on <socket>\n");
 #endif
     real_exit(status);
 }
 
+#ifdef MODULE_TRACE_REC
+static void _trace_rec_write(void *arg, const char *buf, size_t len)
+{
+    int fd = *((int *)arg);
+
+    if (real_write(fd, buf, len) != (ssize_t)len) {
+        warn("trace_rec: write");
+    }
+}
+
+static void _trace_rec_exit(void)
+{
+    int fd = real_open(_trace_rec_file, O_WRONLY | O_CREAT | O_TRUNC, 0644);
+
+    if (fd < 0) {
+        warn("trace_rec: open %s", _trace_rec_file);
+        return;
+    }
+    trace_rec_dump(_trace_rec_write, &fd);
+    real_close(fd);
+}
+#endif
+
+#ifdef MODULE_NATIVE_PROF
+static void _prof_exit(void)
+{
+    native_prof_stop();
+
+    int fd = real_open(_prof_file, O_WRONLY | O_CREAT | O_TRUNC, 0644);
+
+    if (fd < 0) {
+        warn("native_prof: open %s", _prof_file);
+        return;
+    }
+    if (native_prof_write(fd) < 0) {
+        warn("native_prof: write");
+    }
+    real_close(fd);
+}
+#endif
+
 #ifdef MODULE_SOCKET_ZEP
 static void _parse_ep_str(char *ep_str, char **addr, char **port)
 {
@@ -382,6 +470,9 @@ __attribute__((constructor)) static void startup(int argc, char **argv, char **e
     _native_id = _native_pid;
 
     int c, opt_idx = 0, uart = 0;
+#ifdef MODULE_NATIVE_VTIME
+    const char *vtime_coord = NULL;
+#endif
 #ifdef MODULE_SOCKET_ZEP
     unsigned zeps = 0;
 #endif
@@ -455,6 +546,27 @@ __attribute__((constructor)) static void startup(int argc, char **argv, char **e
             case 'z':
                 _zep_params_setup(optarg, zeps++);
                 break;
+#endif
+#ifdef MODULE_TRACE_REC
+            case 't':
+                if (!_trace_rec_file) {
+                    atexit(_trace_rec_exit);
+                }
+                _trace_rec_file = optarg;
+                break;
+#endif
+#ifdef MODULE_NATIVE_PROF
+            case 'p':
+                if (!_prof_file) {
+                    atexit(_prof_exit);
+                }
+                _prof_file = optarg;
+                break;
+#endif
+#ifdef MODULE_NATIVE_VTIME
+            case 'w':
+                vtime_coord = optarg;
+                break;
 #endif
             default:
                 usage_exit(EXIT_FAILURE);
@@ -497,6 +609,13 @@ __attribute__((constructor)) static void startup(int argc, char **argv, char **e
     _native_null_out_file = _native_log_output(stdouttype, STDOUT_FILENO);
     _native_input(stdintype);
 
+#ifdef MODULE_NATIVE_PROF
+    if (_prof_file) {
+        /* started only now, as the timer would not survive daemonize() */
+        native_prof_start();
+    }
+#endif
+
     /* startup is a constructor which is being called from the init_array during
      * C runtime initialization, this is normally used for code which must run
      * before launching main(), such as C++ global object constructors etc.
@@ -532,6 +651,11 @@ __attribute__((constructor)) static void startup(int argc, char **argv, char **e
 
     native_cpu_init();
     native_interrupt_init();
+#ifdef MODULE_NATIVE_VTIME
+    if (vtime_coord) {
+        native_vtime_connect(vtime_coord);
+    }
+#endif
 #ifdef MODULE_NETDEV_TAP
     for (int i = 0; i < NETDEV_TAP_MAX; i++) {
         netdev_tap_params[i].tap_name = &argv[optind + i];
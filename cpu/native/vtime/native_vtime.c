@@ -0,0 +1,240 @@
+/*
+ * Copyright (C) 2026 agent <agent@local>
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     cpu_native_vtime
+ * @{
+ *
+ * @file
+ * @brief       Virtual time implementation
+ *
+ * The coordinator protocol is line based, all times are virtual ns:
+ *
+ *     instance -> coordinator: HELLO <pid>
+ *     instance -> coordinator: IDLE <next target or 0>
+ *     instance -> coordinator: BUSY
+ *     coordinator -> instance: ADVANCE <time>
+ *
+ * @author      agent <agent@local>
+ *
+ * @}
+ */
+
+#include <err.h>
+#include <errno.h>
+#include <inttypes.h>
+#include <signal.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+
+#include "async_read.h"
+#include "native_internal.h"
+#include "native_vtime.h"
+
+#define ENABLE_DEBUG (0)
+#include "debug.h"
+
+#define LINE_LEN    (48U)
+
+extern int _sig_pipefd[2];
+
+/* start at 1 s, 0 is used for "no target" */
+static uint64_t _now = 1000000000LLU;
+static uint64_t _target;
+
+static int _coord_fd = -1;
+static bool _synced;
+static bool _idle_sent;
+static char _rx_buf[LINE_LEN];
+static unsigned _rx_len;
+
+static void _raise_sigalrm(void)
+{
+    int sig = SIGALRM;
+
+    if (real_write(_sig_pipefd[1], &sig, sizeof(int)) == -1) {
+        err(EXIT_FAILURE, "native_vtime: real_write()");
+    }
+    _native_sigpend++;
+}
+
+static void _advance(uint64_t time)
+{
+    if (time > _now) {
+        _now = time;
+    }
+    DEBUG("native_vtime: now %" PRIu64 "\n", _now);
+    if (_target && (_target <= _now)) {
+        _target = 0;
+        _raise_sigalrm();
+    }
+}
+
+static void _send(const char *line)
+{
+    size_t len = strlen(line);
+
+    if (real_write(_coord_fd, line, len) != (ssize_t)len) {
+        err(EXIT_FAILURE, "native_vtime: lost coordinator");
+    }
+}
+
+static void _handle_line(char *line)
+{
+    if (strncmp(line, "ADVANCE ", 8) == 0) {
+        uint64_t time = strtoull(line + 8, NULL, 10);
+
+        _idle_sent = false;
+        if (!_synced) {
+            /* adopt the time of the instances that are already running */
+            _now = time;
+            _synced = true;
+        }
+        else {
+            _advance(time);
+        }
+    }
+    else {
+        warnx("native_vtime: unexpected \"%s\" from coordinator", line);
+    }
+}
+
+/* returns false once the coordinator has no more data */
+static bool _receive(void)
+{
+    ssize_t res = real_read(_coord_fd, _rx_buf + _rx_len,
+                            sizeof(_rx_buf) - 1 - _rx_len);
+
+    if (res == 0) {
+        errx(EXIT_FAILURE, "native_vtime: coordinator closed the connection");
+    }
+    if (res < 0) {
+        if ((errno == EAGAIN) || (errno == EWOULDBLOCK)) {
+            return false;
+        }
+        err(EXIT_FAILURE, "native_vtime: read");
+    }
+    _rx_len += res;
+    _rx_buf[_rx_len] = '\0';
+
+    char *nl;
+    while ((nl = strchr(_rx_buf, '\n')) != NULL) {
+        *nl = '\0';
+        _handle_line(_rx_buf);
+        _rx_len -= (nl + 1) - _rx_buf;
+        memmove(_rx_buf, nl + 1, _rx_len + 1);
+    }
+    if (_rx_len == sizeof(_rx_buf) - 1) {
+        errx(EXIT_FAILURE, "native_vtime: garbage from coordinator");
+    }
+    return true;
+}
+
+static void _coord_isr(int fd, void *arg)
+{
+    (void)fd;
+    (void)arg;
+
+    while (_receive()) {}
+}
+
+uint64_t native_vtime_now(void)
+{
+    _now += NATIVE_VTIME_READ_STEP;
+    return _now;
+}
+
+void native_vtime_set_target(uint64_t target)
+{
+    _target = target;
+}
+
+void native_vtime_idle(void)
+{
+    sigset_t all, old;
+
+    _native_in_syscall++; /* no switching here */
+
+    /* a signal arriving between the check of _native_sigpend and the wait
+     * would be lost, so keep them blocked until sigsuspend() */
+    sigfillset(&all);
+    if (sigprocmask(SIG_BLOCK, &all, &old) == -1) {
+        err(EXIT_FAILURE, "native_vtime_idle: sigprocmask");
+    }
+
+    if (_native_sigpend == 0) {
+        if (_coord_fd < 0) {
+            if (_target) {
+                _advance(_target);
+            }
+            else {
+                /* only I/O can wake us up */
+                sigsuspend(&old);
+            }
+        }
+        else {
+            if (!_idle_sent) {
+                char line[LINE_LEN];
+                snprintf(line, sizeof(line), "IDLE %" PRIu64 "\n", _target);
+                _send(line);
+                _idle_sent = true;
+            }
+            sigsuspend(&old);
+        }
+    }
+
+    if (sigprocmask(SIG_SETMASK, &old, NULL) == -1) {
+        err(EXIT_FAILURE, "native_vtime_idle: sigprocmask");
+    }
+    _native_in_syscall--;
+}
+
+void native_vtime_busy(int fd)
+{
+    if ((fd != _coord_fd) && _idle_sent) {
+        _send("BUSY\n");
+        _idle_sent = false;
+    }
+}
+
+void native_vtime_connect(const char *path)
+{
+    struct sockaddr_un addr;
+    char line[LINE_LEN];
+
+    memset(&addr, 0, sizeof(addr));
+    addr.sun_family = AF_UNIX;
+    if (strlen(path) >= sizeof(addr.sun_path)) {
+        errx(EXIT_FAILURE, "native_vtime: socket path too long");
+    }
+    strcpy(addr.sun_path, path);
+
+    _coord_fd = real_socket(AF_UNIX, SOCK_STREAM, 0);
+    if (_coord_fd == -1) {
+        err(EXIT_FAILURE, "native_vtime: socket");
+    }
+    if (real_connect(_coord_fd, (struct sockaddr *)&addr, sizeof(addr)) == -1) {
+        err(EXIT_FAILURE, "native_vtime: connect(%s)", path);
+    }
+
+    snprintf(line, sizeof(line), "HELLO %d\n", (int)_native_pid);
+    _send(line);
+
+    /* the socket is still blocking, wait for the current time */
+    while (!_synced) {
+        _receive();
+    }
+
+    native_async_read_setup();
+    native_async_read_add_handler_flags(_coord_fd, NULL, _coord_isr,
+                                        ASYNC_READ_EDGE);
+}
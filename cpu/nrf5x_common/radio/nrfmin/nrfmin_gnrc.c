@@ -36,7 +36,8 @@
 #endif
 
 #ifndef NRFMIN_GNRC_STACKSIZE
-#define NRFMIN_GNRC_STACKSIZE       THREAD_STACKSIZE_DEFAULT
+#define NRFMIN_GNRC_STACKSIZE       (THREAD_STACKSIZE_DEFAULT + \
+                                     GNRC_NETAPI_RTC_EXTRA_STACKSIZE)
 #endif
 /** @} */
 
@@ -0,0 +1,158 @@
+#! /usr/bin/env python3
+
+#
+# Copyright (C) 2026 agent <agent@local>
+#
+# This file is subject to the terms and conditions of the GNU Lesser
+# General Public License v2.1. See the file LICENSE in the top level
+# directory for more details.
+#
+
+"""
+trace_rec2chrome
+
+Converts a dump of RIOT's trace recorder (module `trace_rec`) into the Chrome
+trace event format.
+
+Description
+-----------
+
+Every thread becomes a track showing when it was running, with the user
+defined spans nested into it. Interrupt service routines get their own track.
+Messages are drawn as flow arrows from the send to the matching receive.
+
+Open the result with `chrome://tracing` or https://ui.perfetto.dev.
+
+Usage
+-----
+
+    usage: trace_rec2chrome.py [-h] [-o OUTFILE] infile
+
+    positional arguments:
+      infile                trace_rec dump, e.g. written by native's
+                            --trace-rec=<file> option
+
+    optional arguments:
+      -h, --help            show this help message and exit
+      -o OUTFILE, --outfile OUTFILE
+                            output file (default: stdout)
+"""
+
+import sys
+import json
+import argparse
+import collections
+
+PID = 0
+ISR_TID = 'isr'
+
+
+class Converter(object):
+    """Turns trace_rec records into Chrome trace events"""
+
+    def __init__(self):
+        self.ticks_per_sec = 1000000
+        self.isr_pid = None
+        self.names = {}
+        self.events = []
+        self.running = None
+        self.last_ticks = None
+        self.wraps = 0
+        self.flow_id = 0
+        # pending message flows per (sender, receiver) pair
+        self.flows = collections.defaultdict(collections.deque)
+
+    def _ts(self, ticks):
+        # times are 32 bit timer ticks, unwrap them
+        if self.last_ticks is not None and ticks < self.last_ticks:
+            self.wraps += 1
+        self.last_ticks = ticks
+        return (ticks + (self.wraps << 32)) * 1000000.0 / self.ticks_per_sec
+
+    def _event(self, ph, ts, tid, name, **kwargs):
+        event = {'ph': ph, 'ts': ts, 'pid': PID, 'tid': tid, 'name': name}
+        event.update(kwargs)
+        self.events.append(event)
+
+    def _thread_name(self, pid):
+        return self.names.get(pid, 'pid {}'.format(pid))
+
+    def header(self, fields):
+        self.ticks_per_sec = int(fields[3])
+        self.isr_pid = int(fields[4])
+
+    def thread(self, pid, name):
+        self.names[pid] = name
+        self.events.append({'ph': 'M', 'pid': PID, 'tid': pid,
+                            'name': 'thread_name', 'args': {'name': name}})
+
+    def record(self, ticks, event, pid, peer, arg, span):
+        ts = self._ts(ticks)
+
+        if event == 'switch':
+            if self.running is not None:
+                self._event('E', ts, self.running,
+                            self._thread_name(self.running))
+            self._event('B', ts, pid, self._thread_name(pid))
+            self.running = pid
+        elif event == 'isr_enter':
+            self._event('B', ts, ISR_TID, 'irq {}'.format(peer),
+                        args={'interrupted': self._thread_name(pid)})
+        elif event == 'isr_exit':
+            self._event('E', ts, ISR_TID, 'irq {}'.format(peer))
+        elif event == 'span_begin':
+            self._event('B', ts, self._tid(pid), span)
+        elif event == 'span_end':
+            self._event('E', ts, self._tid(pid), span)
+        elif event == 'msg_send':
+            self.flow_id += 1
+            self.flows[(pid, peer)].append(self.flow_id)
+            args = {'to': self._thread_name(peer), 'type': hex(arg)}
+            self._event('i', ts, self._tid(pid), 'msg_send', s='t',
+                        args=args)
+            self._event('s', ts, self._tid(pid), 'msg', cat='msg',
+                        id=self.flow_id)
+        elif event == 'msg_recv':
+            args = {'from': self._thread_name(peer), 'type': hex(arg)}
+            self._event('i', ts, self._tid(pid), 'msg_recv', s='t',
+                        args=args)
+            pending = self.flows[(peer, pid)]
+            if pending:
+                self._event('f', ts, self._tid(pid), 'msg', cat='msg',
+                            id=pending.popleft(), bp='e')
+
+    def _tid(self, pid):
+        return ISR_TID if pid == self.isr_pid else pid
+
+    def convert(self, lines):
+        for line in lines:
+            line = line.rstrip('\n')
+            if not line:
+                continue
+            fields = line.split(' ')
+            if fields[0] == '#':
+                self.header(fields)
+            elif fields[0] == 'T':
+                self.thread(int(fields[1]), ' '.join(fields[2:]))
+            else:
+                self.record(int(fields[0]), fields[1], int(fields[2]),
+                            int(fields[3]), int(fields[4]),
+                            ' '.join(fields[5:]))
+        return {'traceEvents': self.events, 'displayTimeUnit': 'ns'}
+
+
+def main():
+    parser = argparse.ArgumentParser()
+    parser.add_argument('infile', type=argparse.FileType('r'),
+                        help="trace_rec dump, e.g. written by native's "
+                             "--trace-rec=<file> option")
+    parser.add_argument('-o', '--outfile', type=argparse.FileType('w'),
+                        default=sys.stdout,
+                        help='output file (default: stdout)')
+    args = parser.parse_args()
+
+    json.dump(Converter().convert(args.infile), args.outfile)
+
+
+if __name__ == '__main__':
+    main()
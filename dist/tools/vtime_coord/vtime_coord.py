@@ -0,0 +1,193 @@
+#! /usr/bin/env python3
+
+#
+# Copyright (C) 2026 agent <agent@local>
+#
+# This file is subject to the terms and conditions of the GNU Lesser
+# General Public License v2.1. See the file LICENSE in the top level
+# directory for more details.
+#
+
+"""
+vtime_coord
+
+Advances the virtual time of several native instances (module `native_vtime`)
+in lock-step.
+
+Description
+-----------
+
+Every instance connects to the coordinator's UNIX socket when started with
+`--vtime-coord=<socket>`. Whenever all of its threads are idle, an instance
+reports the virtual time of its next timer target. Once all connected
+instances were idle for the grace period, the coordinator advances all of
+them to the earliest target. Every I/O event on an instance marks it busy
+again, so frames that are still in flight between instances are handled
+before time moves on, as long as they arrive within the grace period.
+
+Usage
+-----
+
+    usage: vtime_coord.py [-h] [-g GRACE] [-v] socket
+
+    positional arguments:
+      socket                path of the UNIX socket to listen on
+
+    optional arguments:
+      -h, --help            show this help message and exit
+      -g GRACE, --grace GRACE
+                            wall clock time in ms all instances must have been
+                            idle before advancing (default: 2)
+      -v, --verbose         print every advance
+"""
+
+import os
+import sys
+import time
+import socket
+import argparse
+import selectors
+
+START_NS = 1000000000
+
+
+class Instance(object):
+    """Connection to one native instance"""
+
+    def __init__(self, conn):
+        self.conn = conn
+        self.buf = b''
+        self.pid = None
+        self.idle = False
+        self.target = 0
+        self.idle_since = 0.0
+
+    def send(self, line):
+        self.conn.sendall(line.encode() + b'\n')
+
+
+class Coordinator(object):
+    """Collects idle reports and advances virtual time"""
+
+    def __init__(self, path, grace, verbose):
+        self.path = path
+        self.grace = grace
+        self.verbose = verbose
+        self.now = START_NS
+        self.instances = {}
+        self.sel = selectors.DefaultSelector()
+        self.started = time.monotonic()
+
+    def _accept(self, server):
+        conn, _ = server.accept()
+        self.instances[conn] = Instance(conn)
+        self.sel.register(conn, selectors.EVENT_READ)
+
+    def _drop(self, inst):
+        self.sel.unregister(inst.conn)
+        inst.conn.close()
+        del self.instances[inst.conn]
+        print('instance {} left'.format(inst.pid))
+
+    def _line(self, inst, line):
+        fields = line.split()
+        if not fields:
+            return
+        if fields[0] == 'HELLO':
+            inst.pid = fields[1]
+            inst.send('ADVANCE {}'.format(self.now))
+            print('instance {} joined at {:.6f} s'.format(
+                inst.pid, self.now / 1e9))
+        elif fields[0] == 'IDLE':
+            inst.idle = True
+            inst.target = int(fields[1])
+            inst.idle_since = time.monotonic()
+        elif fields[0] == 'BUSY':
+            inst.idle = False
+        else:
+            print('unexpected "{}" from instance {}'.format(line, inst.pid),
+                  file=sys.stderr)
+
+    def _receive(self, inst):
+        data = inst.conn.recv(4096)
+        if not data:
+            self._drop(inst)
+            return
+        inst.buf += data
+        while b'\n' in inst.buf:
+            line, inst.buf = inst.buf.split(b'\n', 1)
+            self._line(inst, line.decode())
+
+    def _quiet_for(self):
+        """returns how long all instances have been idle, None if not"""
+        if not self.instances:
+            return None
+        if not all(inst.idle for inst in self.instances.values()):
+            return None
+        last = max(inst.idle_since for inst in self.instances.values())
+        return time.monotonic() - last
+
+    def _targets(self):
+        """returns the pending timer targets of all instances"""
+        return [inst.target for inst in self.instances.values()
+                if inst.target]
+
+    def _advance(self, targets):
+        self.now = max(self.now, min(targets))
+        if self.verbose:
+            wall = time.monotonic() - self.started
+            print('{:.6f} s virtual, {:.3f} s wall'.format(self.now / 1e9,
+                                                           wall))
+        for inst in self.instances.values():
+            inst.idle = False
+            inst.send('ADVANCE {}'.format(self.now))
+
+    def run(self):
+        if os.path.exists(self.path):
+            os.unlink(self.path)
+        server = socket.socket(socket.AF_UNIX, socket.SOCK_STREAM)
+        server.bind(self.path)
+        server.listen()
+        self.sel.register(server, selectors.EVENT_READ)
+        print('listening on {}'.format(self.path))
+
+        try:
+            while True:
+                # without pending targets, everybody waits for external
+                # input, so there is nothing to advance to until an instance
+                # reports again
+                quiet = self._quiet_for()
+                timeout = None
+                if (quiet is not None) and self._targets():
+                    timeout = max(0, self.grace - quiet)
+                for key, _ in self.sel.select(timeout):
+                    if key.fileobj is server:
+                        self._accept(server)
+                    else:
+                        self._receive(self.instances[key.fileobj])
+                quiet = self._quiet_for()
+                targets = self._targets()
+                if (quiet is not None) and (quiet >= self.grace) and targets:
+                    self._advance(targets)
+        except KeyboardInterrupt:
+            pass
+        finally:
+            server.close()
+            os.unlink(self.path)
+
+
+def main():
+    parser = argparse.ArgumentParser()
+    parser.add_argument('socket', help='path of the UNIX socket to listen on')
+    parser.add_argument('-g', '--grace', type=float, default=2,
+                        help='wall clock time in ms all instances must have '
+                             'been idle before advancing (default: 2)')
+    parser.add_argument('-v', '--verbose', action='store_true',
+                        help='print every advance')
+    args = parser.parse_args()
+
+    Coordinator(args.socket, args.grace / 1000, args.verbose).run()
+
+
+if __name__ == '__main__':
+    main()
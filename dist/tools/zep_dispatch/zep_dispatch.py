@@ -0,0 +1,372 @@
+#! /usr/bin/env python3
+
+#
+# Copyright (C) 2026 agent <agent@local>
+#
+# This file is subject to the terms and conditions of the GNU Lesser
+# General Public License v2.1. See the file LICENSE in the top level
+# directory for more details.
+#
+
+"""
+zep_dispatch
+
+Simulates the radio medium between native instances that use `socket_zep`.
+
+Description
+-----------
+
+Every instance sends its ZEP frames to the dispatcher, e.g. with
+
+    bin/native/app.elf -z [::1]:17755,[::1]:17754
+
+An instance is identified by the UDP port it sends from, which also
+determines its link layer address. Without a topology, every frame is handed
+to every other instance that sent a frame before. With a topology, a frame is
+only handed to the neighbours of its sender, and every link can lose, delay
+and rate limit frames. A link's frames are delivered in order; a frame waits
+for the previous one to be transmitted at the link's rate.
+
+Topology file
+-------------
+
+    # node <name> <port>
+    node a 17755
+    node b 17756
+    node c 17757
+    # link <x> <y> [loss=<0..1>] [delay=<ms>] [rate=<kbit/s>]
+    link a b loss=0.1 delay=2 rate=250
+    # dlink <from> <to> [...] only adds the direction from -> to
+    link b c
+    dlink c b loss=0.5
+
+Later lines override earlier ones for the same direction. `--grid` creates
+a grid of nodes instead, named by their port, where every node is linked to
+its horizontal and vertical neighbours.
+
+Per link counters are printed on exit, and every `--interval` seconds if
+given. `--stats` also writes them to a JSON file on exit.
+
+Usage
+-----
+
+    usage: zep_dispatch.py [-h] [-l LISTEN] [-t TOPOLOGY | -g COLSxROWS]
+                           [-p BASE_PORT] [--loss LOSS] [--delay DELAY]
+                           [--rate RATE] [-s STATS] [-i INTERVAL]
+                           [--seed SEED] [-v]
+"""
+
+import sys
+import json
+import time
+import heapq
+import random
+import signal
+import socket
+import argparse
+import selectors
+
+ZEP_PORT_DEFAULT = 17754
+ZEP_V2_DATA_HDR_LEN = 32
+
+
+class Link(object):
+    """Directed link between two nodes"""
+
+    def __init__(self, loss=0.0, delay=0.0, rate=0.0):
+        self.loss = loss
+        self.delay = delay
+        self.rate = rate
+        self.busy_until = 0.0
+        self.frames = 0
+        self.bytes = 0
+        self.lost = 0
+        self.delivered = 0
+
+    def counters(self):
+        return {'frames': self.frames, 'bytes': self.bytes,
+                'lost': self.lost, 'delivered': self.delivered}
+
+
+class Topology(object):
+    """Nodes by port and the links between them"""
+
+    def __init__(self):
+        self.names = {}
+        self.ports = {}
+        self.links = {}
+
+    def add_node(self, name, port):
+        self.names[port] = name
+        self.ports[name] = port
+
+    def add_link(self, src, dst, link):
+        self.links.setdefault(self.ports[src], {})[self.ports[dst]] = link
+
+    def neighbours(self, port):
+        return self.links.get(port, {})
+
+    def name(self, port):
+        return self.names.get(port, str(port))
+
+    @staticmethod
+    def _link_params(fields, lineno):
+        params = {}
+        for field in fields:
+            key, sep, value = field.partition('=')
+            if not sep or key not in ('loss', 'delay', 'rate'):
+                raise ValueError('line {}: unexpected "{}"'.format(lineno,
+                                                                    field))
+            params[key] = float(value)
+        if 'delay' in params:
+            params['delay'] /= 1000
+        if not 0 <= params.get('loss', 0) <= 1:
+            raise ValueError('line {}: loss must be in [0, 1]'.format(lineno))
+        return params
+
+    @classmethod
+    def parse(cls, lines):
+        topo = cls()
+        for lineno, line in enumerate(lines, 1):
+            fields = line.split('#', 1)[0].split()
+            if not fields:
+                continue
+            if (fields[0] == 'node') and (len(fields) == 3):
+                topo.add_node(fields[1], int(fields[2]))
+            elif (fields[0] in ('link', 'dlink')) and (len(fields) >= 3):
+                for name in fields[1:3]:
+                    if name not in topo.ports:
+                        raise ValueError('line {}: unknown node "{}"'
+                                         .format(lineno, name))
+                params = cls._link_params(fields[3:], lineno)
+                topo.add_link(fields[1], fields[2], Link(**params))
+                if fields[0] == 'link':
+                    topo.add_link(fields[2], fields[1], Link(**params))
+            else:
+                raise ValueError('line {}: can\'t parse "{}"'.format(lineno,
+                                                                   line))
+        return topo
+
+    @classmethod
+    def grid(cls, cols, rows, base_port, **params):
+        topo = cls()
+        for i in range(cols * rows):
+            topo.add_node(str(base_port + i), base_port + i)
+        for i in range(cols * rows):
+            x, y = i % cols, i // cols
+            neighbours = []
+            if x + 1 < cols:
+                neighbours.append(i + 1)
+            if y + 1 < rows:
+                neighbours.append(i + cols)
+            for j in neighbours:
+                topo.add_link(str(base_port + i), str(base_port + j),
+                              Link(**params))
+                topo.add_link(str(base_port + j), str(base_port + i),
+                              Link(**params))
+        return topo
+
+
+class Dispatcher(object):
+    """Fans ZEP frames out to the neighbours of their sender"""
+
+    def __init__(self, sock, topology, verbose):
+        self.sock = sock
+        self.topology = topology
+        self.verbose = verbose
+        self.peers = {}
+        self.hub_links = {}
+        self.pending = []
+        self.seq = 0
+        self.unknown = set()
+
+    def _links(self, port):
+        if self.topology is not None:
+            return self.topology.neighbours(port)
+        # ideal medium, everybody hears everybody
+        links = self.hub_links.setdefault(port, {})
+        for other in self.peers:
+            if (other != port) and (other not in links):
+                links[other] = Link()
+        return links
+
+    def _schedule(self, when, dst, frame):
+        heapq.heappush(self.pending, (when, self.seq, dst, frame))
+        self.seq += 1
+
+    def _receive(self):
+        frame, addr = self.sock.recvfrom(2048)
+        port = addr[1]
+        now = time.monotonic()
+
+        if (self.topology is not None) and \
+           (port not in self.topology.names):
+            if port not in self.unknown:
+                print('ignoring frames from {}, not in topology'.format(addr),
+                      file=sys.stderr)
+                self.unknown.add(port)
+            return
+        if port not in self.peers:
+            print('node {} joined from {}'.format(self.topology.name(port)
+                                                  if self.topology else port,
+                                                  addr))
+        self.peers[port] = addr
+        if self.verbose:
+            print('{} bytes from {}'.format(len(frame), self._name(port)))
+
+        for dst, link in self._links(port).items():
+            link.frames += 1
+            link.bytes += len(frame)
+            if dst not in self.peers:
+                # not started yet
+                link.lost += 1
+                continue
+            if link.loss and (random.random() < link.loss):
+                link.lost += 1
+                continue
+            start = max(now, link.busy_until)
+            if link.rate:
+                payload = max(0, len(frame) - ZEP_V2_DATA_HDR_LEN)
+                start += (payload * 8) / (link.rate * 1000)
+            link.busy_until = start
+            self._schedule(start + link.delay, dst, frame)
+            link.delivered += 1
+
+    def _deliver(self, now):
+        while self.pending and (self.pending[0][0] <= now):
+            _, _, dst, frame = heapq.heappop(self.pending)
+            self.sock.sendto(frame, self.peers[dst])
+
+    def _name(self, port):
+        if self.topology is not None:
+            return self.topology.name(port)
+        return str(port)
+
+    def counters(self):
+        links = self.topology.links if self.topology else self.hub_links
+        res = []
+        for src in sorted(links):
+            for dst in sorted(links[src]):
+                entry = {'from': self._name(src), 'to': self._name(dst)}
+                entry.update(links[src][dst].counters())
+                res.append(entry)
+        return res
+
+    def print_counters(self):
+        print('{:>10} {:>10} {:>10} {:>12} {:>10} {:>10}'.format(
+              'from', 'to', 'frames', 'bytes', 'lost', 'delivered'))
+        for c in self.counters():
+            if not c['frames']:
+                continue
+            print('{from:>10} {to:>10} {frames:>10} {bytes:>12} {lost:>10} '
+                  '{delivered:>10}'.format(**c))
+
+    def run(self, interval):
+        sel = selectors.DefaultSelector()
+        sel.register(self.sock, selectors.EVENT_READ)
+        next_report = time.monotonic() + interval if interval else None
+
+        while True:
+            now = time.monotonic()
+            deadlines = []
+            if self.pending:
+                deadlines.append(self.pending[0][0])
+            if next_report is not None:
+                deadlines.append(next_report)
+            timeout = max(0, min(deadlines) - now) if deadlines else None
+            if sel.select(timeout):
+                # drain the socket before delivering
+                self.sock.setblocking(False)
+                try:
+                    while True:
+                        self._receive()
+                except BlockingIOError:
+                    pass
+                self.sock.setblocking(True)
+            now = time.monotonic()
+            self._deliver(now)
+            if (next_report is not None) and (now >= next_report):
+                self.print_counters()
+                next_report += interval
+
+
+def _endpoint(string):
+    host, sep, port = string.rpartition(':')
+    if not sep:
+        raise argparse.ArgumentTypeError('expected <addr>:<port>')
+    return host.strip('[]'), int(port)
+
+
+def _grid(string):
+    try:
+        cols, rows = (int(v) for v in string.lower().split('x'))
+    except ValueError:
+        raise argparse.ArgumentTypeError('expected <cols>x<rows>')
+    return cols, rows
+
+
+def main():
+    parser = argparse.ArgumentParser()
+    parser.add_argument('-l', '--listen', type=_endpoint,
+                        default=('::1', ZEP_PORT_DEFAULT),
+                        help='address to listen on (default: [::1]:{})'
+                             .format(ZEP_PORT_DEFAULT))
+    topo_args = parser.add_mutually_exclusive_group()
+    topo_args.add_argument('-t', '--topology', type=argparse.FileType('r'),
+                           help='topology file (default: ideal hub)')
+    topo_args.add_argument('-g', '--grid', type=_grid, metavar='COLSxROWS',
+                           help='use a grid topology instead')
+    parser.add_argument('-p', '--base-port', type=int,
+                        default=ZEP_PORT_DEFAULT + 1,
+                        help='port of the first grid node (default: {})'
+                             .format(ZEP_PORT_DEFAULT + 1))
+    parser.add_argument('--loss', type=float, default=0,
+                        help='loss rate of grid links (default: 0)')
+    parser.add_argument('--delay', type=float, default=0,
+                        help='delay of grid links in ms (default: 0)')
+    parser.add_argument('--rate', type=float, default=0,
+                        help='rate of grid links in kbit/s (default: 0, '
+                             'unlimited)')
+    parser.add_argument('-s', '--stats', type=argparse.FileType('w'),
+                        help='write link counters as JSON on exit')
+    parser.add_argument('-i', '--interval', type=float, default=0,
+                        help='print link counters every INTERVAL seconds')
+    parser.add_argument('--seed', type=int,
+                        help='seed for the loss model')
+    parser.add_argument('-v', '--verbose', action='store_true')
+    args = parser.parse_args()
+
+    random.seed(args.seed)
+    topology = None
+    if args.topology:
+        try:
+            topology = Topology.parse(args.topology)
+        except ValueError as e:
+            parser.error('{}: {}'.format(args.topology.name, e))
+    elif args.grid:
+        topology = Topology.grid(*args.grid, base_port=args.base_port,
+                                 loss=args.loss, delay=args.delay / 1000,
+                                 rate=args.rate)
+
+    info = socket.getaddrinfo(args.listen[0], args.listen[1],
+                              type=socket.SOCK_DGRAM)[0]
+    sock = socket.socket(info[0], socket.SOCK_DGRAM)
+    sock.bind(info[4])
+    print('listening on {}'.format(info[4]))
+
+    dispatcher = Dispatcher(sock, topology, args.verbose)
+    signal.signal(signal.SIGTERM, lambda signum, frame: sys.exit(0))
+    try:
+        dispatcher.run(args.interval)
+    except KeyboardInterrupt:
+        pass
+    finally:
+        sock.close()
+        dispatcher.print_counters()
+        if args.stats:
+            json.dump(dispatcher.counters(), args.stats, indent=2)
+            args.stats.write('\n')
+
+
+if __name__ == '__main__':
+    main()
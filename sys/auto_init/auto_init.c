@@ -28,6 +28,10 @@
 #include "xtimer.h"
 #endif
 
+#ifdef MODULE_ZTIMER
+#include "ztimer.h"
+#endif
+
 #ifdef MODULE_GNRC_SIXLOWPAN
 #include "net/gnrc/sixlowpan.h"
 #endif
@@ -101,6 +105,10 @@ void auto_init(void)
     DEBUG("Auto init xtimer module.\n");
     xtimer_init();
 #endif
+#ifdef MODULE_ZTIMER
+    DEBUG("Auto init ztimer module.\n");
+    ztimer_init();
+#endif
 #ifdef MODULE_MCI
     DEBUG("Auto init mci module.\n");
     mci_initialize();
@@ -33,7 +33,8 @@
  * @brief   MAC layer stack parameters
  * @{
  */
-#define CC2420_MAC_STACKSIZE           (THREAD_STACKSIZE_MAIN)
+#define CC2420_MAC_STACKSIZE           (THREAD_STACKSIZE_MAIN + \
+                                        GNRC_NETAPI_RTC_EXTRA_STACKSIZE)
 #ifndef CC2420_MAC_PRIO
 #define CC2420_MAC_PRIO                (GNRC_NETIF_PRIO)
 #endif
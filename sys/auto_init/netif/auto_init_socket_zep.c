@@ -30,7 +30,8 @@
 /**
  * @brief   Define stack parameters for the MAC layer thread
  */
-#define SOCKET_ZEP_MAC_STACKSIZE    (THREAD_STACKSIZE_DEFAULT + DEBUG_EXTRA_STACKSIZE)
+#define SOCKET_ZEP_MAC_STACKSIZE    (THREAD_STACKSIZE_DEFAULT + DEBUG_EXTRA_STACKSIZE + \
+                                     GNRC_NETAPI_RTC_EXTRA_STACKSIZE)
 #ifndef SOCKET_ZEP_MAC_PRIO
 #define SOCKET_ZEP_MAC_PRIO         (GNRC_NETIF_PRIO)
 #endif
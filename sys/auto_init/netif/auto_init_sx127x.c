@@ -35,7 +35,8 @@
 /**
  * @brief   Define stack parameters for the MAC layer thread
  */
-#define SX127X_STACKSIZE           (THREAD_STACKSIZE_DEFAULT)
+#define SX127X_STACKSIZE           (THREAD_STACKSIZE_DEFAULT + \
+                                    GNRC_NETAPI_RTC_EXTRA_STACKSIZE)
 #ifndef SX127X_PRIO
 #define SX127X_PRIO                (GNRC_NETIF_PRIO)
 #endif
@@ -28,7 +28,8 @@
  * @brief   Define stack parameters for the MAC layer thread
  * @{
  */
-#define MAC_STACKSIZE   (THREAD_STACKSIZE_DEFAULT)
+#define MAC_STACKSIZE   (THREAD_STACKSIZE_DEFAULT + \
+                         GNRC_NETAPI_RTC_EXTRA_STACKSIZE)
 #define MAC_PRIO        (GNRC_NETIF_PRIO)
 /*** @} */
 
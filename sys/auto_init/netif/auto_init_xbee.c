@@ -35,7 +35,8 @@
 /**
  * @brief   Define stack parameters for the MAC layer thread
  */
-#define XBEE_MAC_STACKSIZE           (THREAD_STACKSIZE_DEFAULT)
+#define XBEE_MAC_STACKSIZE           (THREAD_STACKSIZE_DEFAULT + \
+                                      GNRC_NETAPI_RTC_EXTRA_STACKSIZE)
 #ifndef XBEE_MAC_PRIO
 #define XBEE_MAC_PRIO                (GNRC_NETIF_PRIO)
 #endif
@@ -19,11 +19,13 @@
 #ifndef NET_FIB_TABLE_H
 #define NET_FIB_TABLE_H
 
+#include <stdbool.h>
 #include <stdint.h>
 
 #include "kernel_types.h"
 #include "universal_address.h"
 #include "mutex.h"
+#include "xtimer.h"
 
 #ifdef __cplusplus
 extern "C" {
@@ -35,10 +37,32 @@ extern "C" {
  */
 #define FIB_MAX_REGISTERED_RP (5)
 
+/**
+ * @brief Node of the path-compressed binary trie indexing the entries of a
+ *        single hop FIB table by prefix
+ *
+ * The trie is keyed by the address size in bytes followed by the address,
+ * so addresses of distinct sizes never share a node. A node either holds the
+ * entries of its prefix or branches into two sub-tries.
+ *
+ * Two nodes are stored with each @ref fib_entry_t. Together with
+ * fib_entry_t::next they grow an entry from 32 to 72 bytes on 32-bit
+ * platforms, i.e. by 40 bytes, and a @ref fib_table_t by its root, free list
+ * and expiry timer.
+ */
+typedef struct fib_trie_node {
+    /** sub-tries for prefixes having a 0 or a 1 at bit @ref len */
+    struct fib_trie_node *child[2];
+    /** entries with this prefix, NULL for a branching node */
+    struct fib_entry *entries;
+    /** length of the prefix in bits, including the size byte */
+    uint16_t len;
+} fib_trie_node_t;
+
 /**
  * @brief Container descriptor for a FIB entry
  */
-typedef struct {
+typedef struct fib_entry {
     /** interface ID */
     kernel_pid_t iface_id;
     /** Lifetime of this entry (an absolute time-point is stored by the FIB) */
@@ -51,6 +75,10 @@ typedef struct {
     uint32_t next_hop_flags;
     /** Pointer to the shared generic address */
     universal_address_container_t *next_hop;
+    /** Next entry of the same trie node */
+    struct fib_entry *next;
+    /** Storage for trie nodes, handed out by the table to any of its entries */
+    fib_trie_node_t trie_nodes[2];
 } fib_entry_t;
 
 /**
@@ -133,6 +161,17 @@ typedef struct {
     *   e.g. when the unreachable destination is covered by the prefix
     */
     universal_address_container_t* prefix_rp[FIB_MAX_REGISTERED_RP];
+    /** root of the trie indexing the single hop entries */
+    fib_trie_node_t *trie_root;
+    /** unused trie nodes, linked by their fib_trie_node_t::child[0] */
+    fib_trie_node_t *trie_free;
+    /** fires at the earliest lifetime of all single hop entries */
+    xtimer_t expiry_timer;
+    /** the absolute time @ref fib_table_t::expiry_timer fires at */
+    uint64_t next_expiry;
+    /** set by @ref fib_table_t::expiry_timer, the expired entries are
+     *  removed on the next access to the table */
+    volatile bool expired;
 } fib_table_t;
 
 #ifdef __cplusplus
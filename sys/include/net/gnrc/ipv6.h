@@ -16,6 +16,11 @@
  *  * @ref GNRC_NETAPI_MSG_TYPE_RCV, and
  *  * @ref GNRC_NETAPI_MSG_TYPE_SND,
  *
+ * A multicast packet without a given interface is sent over all interfaces.
+ * Only the headers that need to be filled for every interface (the IPv6
+ * header, its extension headers and the upper layer header) are duplicated
+ * for it; the payload is shared between the interfaces.
+ *
  * @{
  *
  * @file
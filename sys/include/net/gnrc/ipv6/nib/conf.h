@@ -262,6 +262,28 @@ extern "C" {
 #define GNRC_IPV6_NIB_OFFL_NUMOF            (8)
 #endif
 
+/**
+ * @brief   Number of hash buckets to look up neighbor cache and other on-link
+ *          entries by their address
+ *
+ * Lookups by address take O(@ref GNRC_IPV6_NIB_NUMOF /
+ * GNRC_IPV6_NIB_ONL_HASH_SIZE) on average.
+ */
+#ifndef GNRC_IPV6_NIB_ONL_HASH_SIZE
+#define GNRC_IPV6_NIB_ONL_HASH_SIZE         (GNRC_IPV6_NIB_NUMOF)
+#endif
+
+/**
+ * @brief   Number of hash buckets to look up forwarding table and prefix list
+ *          entries by their prefix
+ *
+ * A longest-prefix match looks into one bucket per prefix length currently
+ * in the NIB.
+ */
+#ifndef GNRC_IPV6_NIB_OFFL_HASH_SIZE
+#define GNRC_IPV6_NIB_OFFL_HASH_SIZE        (GNRC_IPV6_NIB_OFFL_NUMOF)
+#endif
+
 #if GNRC_IPV6_NIB_CONF_MULTIHOP_P6C || defined(DOXYGEN)
 /**
  * @brief   Number of authoritative border router entries in NIB
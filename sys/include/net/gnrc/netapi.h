@@ -51,6 +51,39 @@
  * USEMODULE += gnrc_netapi_callbacks
  * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
  * @}
+ *
+ * @defgroup    net_gnrc_netapi_rtc   Run-to-completion receive path
+ * @ingroup     net_gnrc_netapi
+ * @brief       Handles received packets in the thread that dispatched them
+ * @{
+ * @details The submodule `gnrc_netapi_rtc` makes 6LoWPAN, IPv6 and UDP
+ *          register a @ref net_gnrc_netapi_callbacks "callback" instead of
+ *          their thread. A packet dispatched to them with
+ *          @ref GNRC_NETAPI_MSG_TYPE_RCV is then handled by a direct function
+ *          call, so a received UDP datagram is passed from the network
+ *          interface's thread up to the socket's mailbox without a context
+ *          switch in between.
+ *
+ * Every layer guards its state with a mutex its own thread also holds while
+ * handling a message. The callback only takes it with mutex_trylock(): if
+ * the layer is busy, the packet is queued to the layer's thread as before.
+ * The same happens while the layer's thread still has messages queued, so a
+ * packet does not overtake the ones received before it.
+ * Sending, get/set requests and timer events still go through the threads.
+ * Since the control plane (e.g. neighbor discovery) may block on synchronous
+ * @ref gnrc_netapi_get() calls to the network interfaces, IPv6 only handles
+ * UDP and TCP packets directly.
+ *
+ * The network interfaces' threads need @ref GNRC_NETAPI_RTC_EXTRA_STACKSIZE
+ * more stack to run the layers above them.
+ *
+ * To use, add the module `gnrc_netapi_rtc` to the `USEMODULE` macro in
+ * your application's Makefile:
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ {.mk}
+ * USEMODULE += gnrc_netapi_rtc
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+ * @}
  * @author      Martine Lenders <mlenders@inf.fu-berlin.de>
  * @author      Hauke Petersen <hauke.petersen@fu-berlin.de>
  */
@@ -62,6 +95,7 @@
 #include "net/netopt.h"
 #include "net/gnrc/nettype.h"
 #include "net/gnrc/pkt.h"
+#include "net/gnrc/pktqueue.h"
 
 #ifdef __cplusplus
 extern "C" {
@@ -92,6 +126,38 @@ extern "C" {
  */
 #define GNRC_NETAPI_MSG_TYPE_ACK        (0x0205)
 
+/**
+ * @brief   @ref core_msg type for passing a train of @ref net_gnrc_pkt down
+ *          the network stack
+ *
+ * The message's content points to the first node of a @ref gnrc_pktqueue_t
+ * list. The receiver takes packets from the head of the train and answers
+ * with a @ref GNRC_NETAPI_MSG_TYPE_ACK carrying the number of packets it
+ * took. The nodes themselves stay with the sender.
+ *
+ * Currently handled by @ref net_gnrc_netif and @ref net_gnrc_sixlowpan, and
+ * only sent by 6LoWPAN fragmentation. @ref net_gnrc_tcp does not use it: it
+ * only sends a segment while no other one is unacknowledged, so it never
+ * has a train of segments to hand down.
+ *
+ * @see     gnrc_netapi_send_train()
+ */
+#define GNRC_NETAPI_MSG_TYPE_SND_TRAIN  (0x0206)
+
+/**
+ * @brief   Additional stack a thread needs to run the receive path of the
+ *          layers above it
+ *
+ * @see     @ref net_gnrc_netapi_rtc
+ */
+#ifndef GNRC_NETAPI_RTC_EXTRA_STACKSIZE
+#ifdef MODULE_GNRC_NETAPI_RTC
+#define GNRC_NETAPI_RTC_EXTRA_STACKSIZE (THREAD_STACKSIZE_DEFAULT)
+#else
+#define GNRC_NETAPI_RTC_EXTRA_STACKSIZE (0)
+#endif
+#endif
+
 /**
  * @brief   Data structure to be send for setting (@ref GNRC_NETAPI_MSG_TYPE_SET)
  *          and getting (@ref GNRC_NETAPI_MSG_TYPE_GET) options
@@ -114,6 +180,29 @@ typedef struct {
  */
 int gnrc_netapi_send(kernel_pid_t pid, gnrc_pktsnip_t *pkt);
 
+/**
+ * @brief   Shortcut function for sending @ref GNRC_NETAPI_MSG_TYPE_SND_TRAIN
+ *          messages and parsing the returned @ref GNRC_NETAPI_MSG_TYPE_ACK
+ *          message
+ *
+ * Hands all packets in @p train to @p pid with a single message. The call
+ * blocks until @p pid handled the train, so the nodes of @p train may be
+ * allocated on the caller's stack. Instead of dropping packets when the
+ * receiver is busy, the packets the receiver did not take are left in
+ * @p train for the caller to send later or to release.
+ *
+ * @pre `pid != thread_getpid()`
+ *
+ * @param[in] pid       PID of the targeted network module
+ * @param[in,out] train packets to send. Packets taken by @p pid are removed
+ *                      from its head, the remaining ones are still owned by
+ *                      the caller.
+ *
+ * @return              number of packets taken by @p pid
+ * @return              -1 on error (invalid PID)
+ */
+int gnrc_netapi_send_train(kernel_pid_t pid, gnrc_pktqueue_t **train);
+
 /**
  * @brief   Sends @p cmd to all subscribers to (@p type, @p demux_ctx).
  *
@@ -10,6 +10,12 @@
  * @defgroup    net_gnrc_netreg  Network protocol registry
  * @ingroup     net_gnrc
  * @brief       Registry to receive messages of a specified protocol type by GNRC.
+ *
+ * The entries of every protocol type are hashed by their
+ * @ref gnrc_netreg_entry_t::demux_ctx "demux context" into
+ * @ref GNRC_NETREG_BUCKETS buckets. A lookup only searches the bucket of the
+ * demux context, so dispatching a packet does not slow down with the number
+ * of e.g. bound UDP ports.
  * @{
  *
  * @file
@@ -72,6 +78,17 @@ typedef enum {
 } gnrc_netreg_type_t;
 #endif
 
+/**
+ * @brief   Number of hash buckets per protocol type
+ *
+ * Must be a power of 2. The registry needs `GNRC_NETTYPE_NUMOF *
+ * GNRC_NETREG_BUCKETS` pointers, so set this to 1 to save RAM on nodes with
+ * only a few registrations.
+ */
+#ifndef GNRC_NETREG_BUCKETS
+#define GNRC_NETREG_BUCKETS         (8U)
+#endif
+
 /**
  * @brief   Demux context value to get all packets of a certain type.
  *
@@ -18,6 +18,16 @@
  *          this *will* lead to alignment problems and can potentially result
  *          in segmentation/hard faults and other unexpected behaviour.
  *
+ * `gnrc_pktbuf_static` allocates first-fit from a list of free chunks by
+ * default. With the `gnrc_pktbuf_static_sfit` module, it keeps free chunks
+ * in segregated size classes instead, which bounds the allocation time and
+ * keeps bursty traffic from fragmenting the buffer as much.
+ *
+ * `gnrc_pktbuf_tlsf` allocates packet snips and their data from a pool of
+ * their own with TLSF (see @ref pkg_tlsf), so both allocation and free take
+ * constant time. Unlike `gnrc_pktbuf_malloc` it does not share the heap with
+ * the rest of the system.
+ *
  * @{
  *
  * @file
@@ -58,6 +68,29 @@ extern "C" {
 #define GNRC_PKTBUF_SIZE    (6144)
 #endif  /* GNRC_PKTBUF_SIZE */
 
+/**
+ * @def     GNRC_PKTBUF_TLSF_OVERHEAD
+ * @brief   Bytes `gnrc_pktbuf_tlsf` adds to its pool of
+ *          @ref GNRC_PKTBUF_SIZE bytes for the control structure of TLSF.
+ *
+ * @details This is `tlsf_size() + tlsf_pool_overhead()` of pkg/tlsf, which
+ *          can't be called to size a static array. `tlsf_size()` is the size
+ *          of TLSF's `control_t`: a block header of four words, a first-level
+ *          bitmap, and per first-level size class a second-level bitmap and
+ *          the heads of 32 free lists. There are 24 first-level classes with
+ *          32-bit pointers and 25 with 64-bit pointers. One more word covers
+ *          padding, and `tlsf_pool_overhead()` adds two `size_t` for the
+ *          block headers at both ends of the pool. That gives 3200 byte on
+ *          32-bit platforms. gnrc_pktbuf_init() asserts that it is enough.
+ */
+#ifndef GNRC_PKTBUF_TLSF_OVERHEAD
+#define GNRC_PKTBUF_TLSF_OVERHEAD \
+    ((5U * sizeof(void *)) + sizeof(unsigned) + \
+     (((sizeof(void *) == 8) ? 25U : 24U) * \
+      (sizeof(unsigned) + (32U * sizeof(void *)))) + \
+     (2U * sizeof(size_t)))
+#endif  /* GNRC_PKTBUF_TLSF_OVERHEAD */
+
 /**
  * @brief   Initializes packet buffer module.
  */
@@ -282,6 +315,9 @@ gnrc_pktsnip_t *gnrc_pktbuf_duplicate_upto(gnrc_pktsnip_t *pkt, gnrc_nettype_t t
  * @note    Only available with DEVELHELP defined.
  *
  * @details Statistics include maximum number of reserved bytes.
+ *          For `gnrc_pktbuf_static` and `gnrc_pktbuf_tlsf`, they also
+ *          include the bytes in use, their high watermark, the fragmentation
+ *          of the free bytes and the number of failed allocations.
  */
 void gnrc_pktbuf_stats(void);
 #endif
@@ -14,6 +14,33 @@
  * @see <a href="https://tools.ietf.org/html/rfc4944#section-5.3">
  *          RFC 4944, section 5.3
  *      </a>
+ *
+ * Reassembly
+ * ==========
+ * Fragments are copied straight to their position in the datagram, which is
+ * allocated in the packet buffer with its full size when its first fragment
+ * arrives. Up to `RBUF_SIZE` (default: 4) datagrams are reassembled at a
+ * time; if another one arrives, the entry that was used least recently is
+ * dropped. Entries are found by a hash over source address and tag in one
+ * of `RBUF_HASH_SIZE` (default: `RBUF_SIZE`) buckets.
+ *
+ * A node that receives from many others at once, e.g. a border router, needs
+ * to raise `RBUF_SIZE`. All datagrams under reassembly are held in the packet
+ * buffer, so `GNRC_PKTBUF_SIZE` needs to grow accordingly: to reassemble 32
+ * datagrams of 1280 byte at once, it needs to be larger than 32 * 1280 byte
+ * plus what the rest of the stack uses.
+ *
+ * Fragment forwarding
+ * ===================
+ * With the `gnrc_sixlowpan_frag_vrb` module, a router does not reassemble
+ * datagrams it forwards. Only the first fragment is decompressed to find the
+ * next hop of the datagram. It is then sent on immediately with a new tag,
+ * and the remaining fragments are switched to the same next hop and tag as
+ * they arrive. Up to `GNRC_SIXLOWPAN_FRAG_VRB_SIZE` (default: 16) datagrams
+ * can be forwarded at a time, independent of the size of the reassembly
+ * buffer. Like reassembly buffer entries, they are found by a hash over
+ * source address and tag, in one of `GNRC_SIXLOWPAN_FRAG_VRB_HASH_SIZE`
+ * (default: `GNRC_SIXLOWPAN_FRAG_VRB_SIZE`) buckets.
  * @{
  *
  * @file
@@ -54,6 +81,18 @@ extern "C" {
 #define GNRC_SIXLOWPAN_MSG_FRAG_GC_RBUF     (0x0226)
 /** @} */
 
+/**
+ * @brief   Maximum number of fragments handed to the network interface with
+ *          one @ref GNRC_NETAPI_MSG_TYPE_SND_TRAIN message
+ *
+ * The fragments of a train are allocated in the packet buffer at the same
+ * time, so larger values trade packet buffer space for fewer context
+ * switches.
+ */
+#ifndef GNRC_SIXLOWPAN_FRAG_TRAIN_LEN
+#define GNRC_SIXLOWPAN_FRAG_TRAIN_LEN       (4U)
+#endif
+
 /**
  * @brief   An entry in the 6LoWPAN reassembly buffer.
  *
@@ -129,6 +168,16 @@ void gnrc_sixlowpan_frag_send(gnrc_pktsnip_t *pkt, void *ctx, unsigned page);
  */
 void gnrc_sixlowpan_frag_recv(gnrc_pktsnip_t *pkt, void *ctx, unsigned page);
 
+/**
+ * @brief   Sets the thread that receives @ref GNRC_SIXLOWPAN_MSG_FRAG_GC_RBUF
+ *
+ * Fragments may be handled outside of that thread (e.g. with
+ * `gnrc_netapi_rtc`), so the timer can't be addressed to the current one.
+ *
+ * @param[in] pid   PID of the thread that calls gnrc_sixlowpan_frag_rbuf_gc()
+ */
+void gnrc_sixlowpan_frag_rbuf_set_gc_pid(kernel_pid_t pid);
+
 /**
  * @brief   Garbage collect reassembly buffer.
  */
@@ -44,6 +44,22 @@ extern "C" {
  */
 void gnrc_sixlowpan_iphc_recv(gnrc_pktsnip_t *pkt, void *ctx, unsigned page);
 
+/**
+ * @brief   Compresses the IPv6 header of a packet without sending it.
+ *
+ * The IPv6 header (and compressible next headers) of @p pkt are replaced by
+ * a 6LoWPAN IPHC dispatch.
+ *
+ * @pre (pkt != NULL)
+ *
+ * @param[in,out] pkt   A 6LoWPAN frame with an uncompressed IPv6 header,
+ *                      starting with a @ref gnrc_netif_hdr_t.
+ *
+ * @return  true, on success.
+ * @return  false, on error. @p pkt is released in that case.
+ */
+bool gnrc_sixlowpan_iphc_encode(gnrc_pktsnip_t *pkt);
+
 /**
  * @brief   Compresses a 6LoWPAN for IPHC.
  *
@@ -0,0 +1,233 @@
+/*
+ * Copyright (C) 2026 agent <agent@local>
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @defgroup    sys_trace_rec Trace recorder
+ * @ingroup     sys
+ * @brief       Records scheduler and IPC events into a ring buffer
+ *
+ * With module `trace_rec`, the kernel records the following events, each
+ * as a fixed size @ref trace_rec_t into a statically allocated ring buffer
+ * of @ref TRACE_REC_NUMOF entries:
+ *
+ * - context switches (in sched_run())
+ * - interrupt service routine entry and exit (only on CPUs that call
+ *   trace_rec_isr_enter() and trace_rec_isr_exit(), currently native)
+ * - message sends and successful receives (core/msg.c)
+ * - user defined spans, see trace_rec_span_begin()
+ *
+ * Once the buffer is full, the oldest records are overwritten, so the buffer
+ * always holds the most recent history.
+ *
+ * trace_rec_dump() writes the buffer in a line based text format:
+ *
+ *     # trace_rec 1 <ticks per second> <pid used for interrupt context>
+ *     T <pid> <thread name>
+ *     ...
+ *     <time> <event> <pid> <peer> <arg> [<span name>]
+ *     ...
+ *
+ * `dist/tools/trace_rec/trace_rec2chrome.py` converts such a dump into
+ * Chrome trace event JSON, which can be viewed with `chrome://tracing` or
+ * https://ui.perfetto.dev.
+ *
+ * On native, start the instance with `--trace-rec=<file>` to get the dump
+ * written to `<file>` when the instance exits.
+ *
+ * The kernel only includes this header and calls its hooks with module
+ * `trace_rec`, so core does not depend on it. Elsewhere, all functions of
+ * this header compile to nothing without the module, so the hooks can stay
+ * in place.
+ *
+ * @{
+ *
+ * @file
+ * @brief       Trace recorder API
+ *
+ * @author      agent <agent@local>
+ */
+
+#ifndef TRACE_REC_H
+#define TRACE_REC_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "kernel_types.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief   Number of records in the ring buffer, must be a power of 2
+ */
+#ifndef TRACE_REC_NUMOF
+#define TRACE_REC_NUMOF     (512U)
+#endif
+
+/**
+ * @brief   Recorded event types
+ */
+typedef enum {
+    TRACE_REC_SWITCH,       /**< @p pid was scheduled, @p peer was active */
+    TRACE_REC_ISR_ENTER,    /**< ISR @p peer interrupted @p pid */
+    TRACE_REC_ISR_EXIT,     /**< ISR @p peer is done */
+    TRACE_REC_MSG_SEND,     /**< @p pid sends a message of type @p arg to
+                                 @p peer */
+    TRACE_REC_MSG_RECV,     /**< @p pid received a message of type @p arg
+                                 from @p peer */
+    TRACE_REC_SPAN_BEGIN,   /**< @p pid enters span @p arg */
+    TRACE_REC_SPAN_END,     /**< @p pid leaves span @p arg */
+    TRACE_REC_NUMOF_TYPES,  /**< number of event types */
+} trace_rec_type_t;
+
+/**
+ * @brief   Trace record
+ */
+typedef struct {
+    uint32_t time;          /**< xtimer ticks at the time of the event */
+    uintptr_t arg;          /**< event specific argument */
+    uint8_t type;           /**< event type, see @ref trace_rec_type_t */
+    uint8_t pid;            /**< thread the event happened on,
+                                 KERNEL_PID_ISR in interrupt context */
+    uint16_t peer;          /**< other thread or interrupt involved */
+} trace_rec_t;
+
+/**
+ * @brief   Callback type for trace_rec_dump()
+ *
+ * @param[in] arg   argument given to trace_rec_dump()
+ * @param[in] buf   text to write
+ * @param[in] len   length of @p buf
+ */
+typedef void (*trace_rec_write_t)(void *arg, const char *buf, size_t len);
+
+#if defined(MODULE_TRACE_REC) || defined(DOXYGEN)
+/**
+ * @brief   Add a record to the ring buffer
+ *
+ * Can be called from any context.
+ *
+ * @param[in] type  event type
+ * @param[in] peer  other thread or interrupt involved
+ * @param[in] arg   event specific argument
+ */
+void trace_rec_add(trace_rec_type_t type, unsigned peer, uintptr_t arg);
+
+/**
+ * @brief   Record a context switch
+ *
+ * Called by the scheduler.
+ *
+ * @param[in] prev  pid of the thread that was active
+ * @param[in] next  pid of the thread that gets scheduled
+ */
+void trace_rec_switch(kernel_pid_t prev, kernel_pid_t next);
+
+/**
+ * @brief   Write all records in the buffer, oldest first
+ *
+ * Recording is paused while dumping.
+ *
+ * @param[in] write     called for every line of the dump
+ * @param[in] arg       argument passed to @p write
+ */
+void trace_rec_dump(trace_rec_write_t write, void *arg);
+
+/**
+ * @brief   Drop all records in the buffer
+ */
+void trace_rec_clear(void);
+#else
+static inline void trace_rec_add(trace_rec_type_t type, unsigned peer,
+                                 uintptr_t arg)
+{
+    (void)type;
+    (void)peer;
+    (void)arg;
+}
+
+static inline void trace_rec_switch(kernel_pid_t prev, kernel_pid_t next)
+{
+    (void)prev;
+    (void)next;
+}
+#endif
+
+/**
+ * @brief   Record the entry of an interrupt service routine
+ *
+ * @param[in] irq   number of the interrupt
+ */
+static inline void trace_rec_isr_enter(unsigned irq)
+{
+    trace_rec_add(TRACE_REC_ISR_ENTER, irq, 0);
+}
+
+/**
+ * @brief   Record the exit of an interrupt service routine
+ *
+ * @param[in] irq   number of the interrupt
+ */
+static inline void trace_rec_isr_exit(unsigned irq)
+{
+    trace_rec_add(TRACE_REC_ISR_EXIT, irq, 0);
+}
+
+/**
+ * @brief   Record sending a message
+ *
+ * @param[in] target    pid of the receiving thread
+ * @param[in] type      type of the message
+ */
+static inline void trace_rec_msg_send(kernel_pid_t target, uint16_t type)
+{
+    trace_rec_add(TRACE_REC_MSG_SEND, (unsigned)target, type);
+}
+
+/**
+ * @brief   Record receiving a message
+ *
+ * @param[in] sender    pid of the sending thread
+ * @param[in] type      type of the message
+ */
+static inline void trace_rec_msg_recv(kernel_pid_t sender, uint16_t type)
+{
+    trace_rec_add(TRACE_REC_MSG_RECV, (unsigned)sender, type);
+}
+
+/**
+ * @brief   Begin a user defined span on the calling thread
+ *
+ * Spans of one thread must be properly nested.
+ *
+ * @param[in] name  name of the span, must stay valid until the buffer was
+ *                  dumped (use string literals)
+ */
+static inline void trace_rec_span_begin(const char *name)
+{
+    trace_rec_add(TRACE_REC_SPAN_BEGIN, 0, (uintptr_t)name);
+}
+
+/**
+ * @brief   End a user defined span on the calling thread
+ *
+ * @param[in] name  name given to trace_rec_span_begin()
+ */
+static inline void trace_rec_span_end(const char *name)
+{
+    trace_rec_add(TRACE_REC_SPAN_END, 0, (uintptr_t)name);
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* TRACE_REC_H */
+/** @} */
@@ -57,11 +57,24 @@ extern "C" {
  * @brief The container descriptor used to identify a universal address entry
  */
 typedef struct {
-    uint8_t use_count;                       /**< The number of entries link here */
+    uint16_t use_count;                      /**< The number of entries link here */
     uint8_t address_size;                    /**< Size in bytes of the used generic address */
     uint8_t address[UNIVERSAL_ADDRESS_SIZE]; /**< The generic address data */
 } universal_address_container_t;
 
+/**
+ * @brief Memory usage statistics of the universal address entries
+ */
+typedef struct {
+    size_t size;        /**< Number of entries available */
+    size_t used;        /**< Number of entries currently in use */
+    size_t max_used;    /**< Maximum number of entries in use at the same time */
+    size_t refs;        /**< Sum of the universal_address_container_t::use_count
+                             of all entries */
+    size_t failed;      /**< Number of additions that failed for lack of a
+                             free entry */
+} universal_address_stats_t;
+
 /**
  * @brief Initialize the data structure for the entries
  */
@@ -162,6 +175,13 @@ void universal_address_print_entry(universal_address_container_t *entry);
  */
 int universal_address_get_num_used_entries(void);
 
+/**
+ * @brief Get the memory usage statistics of the universal address entries
+ *
+ * @param[out] stats     the statistics, reset by universal_address_init()
+ */
+void universal_address_get_stats(universal_address_stats_t *stats);
+
 /**
  * @brief Print the content of the generic address table up to the used element
  */
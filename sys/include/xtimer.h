@@ -20,6 +20,12 @@
  * number of active timers.  The reason for this is that multiplexing is
  * realized by next-first singly linked lists.
  *
+ * Alternatively, the `xtimer_wheel` module replaces these lists by a
+ * hierarchical timing wheel with O(1) insertion and removal, at the cost of
+ * a fixed amount of RAM for the wheel slots (see @ref XTIMER_WHEEL_SLOT_BITS
+ * and @ref XTIMER_WHEEL_LEVELS) and some additional interrupts for cascading
+ * timers between the levels of the wheel.
+ *
  * @{
  * @file
  * @brief   xtimer interface definitions
@@ -74,6 +80,14 @@ typedef struct xtimer {
     xtimer_callback_t callback;  /**< callback function to call when timer
                                      expires */
     void *arg;                   /**< argument to pass to callback function */
+#if defined(MODULE_XTIMER_WHEEL) || defined(DOXYGEN)
+    struct xtimer **pprev;       /**< reference to the pointer pointing to
+                                      this timer in its timing wheel slot,
+                                      only valid while the timer is set */
+    uintptr_t pprev_check;       /**< derived from pprev while the timer is
+                                      set, to tell set timers from
+                                      uninitialized ones */
+#endif
 } xtimer_t;
 
 /**
@@ -89,6 +103,10 @@ static inline xtimer_ticks32_t xtimer_now(void);
 /**
  * @brief get the current system time as 64bit time stamp
  *
+ * Does not disable interrupts. The timer period counters are read using a
+ * sequence counter, the read is retried if the overflow handler updated them
+ * concurrently.
+ *
  * @return  current time as 64bit time stamp
  */
 static inline xtimer_ticks64_t xtimer_now64(void);
@@ -111,6 +129,7 @@ static inline uint32_t xtimer_now_usec(void);
  * @brief get the current system time in microseconds since start
  *
  * This is a convenience function for @c xtimer_usec_from_ticks64(xtimer_now64())
+ * and, like xtimer_now64(), does not disable interrupts.
  */
 static inline uint64_t xtimer_now_usec64(void);
 
@@ -541,6 +560,26 @@ void xtimer_set_timeout_flag(xtimer_t *t, uint32_t timeout);
 #define XTIMER_PERIODIC_RELATIVE (512)
 #endif
 
+#ifndef XTIMER_WHEEL_SLOT_BITS
+/**
+ * @brief   log2 of the number of slots per level of the timing wheel
+ *
+ * Only used by the `xtimer_wheel` module. Must not be greater than 5.
+ */
+#define XTIMER_WHEEL_SLOT_BITS  (5)
+#endif
+
+#ifndef XTIMER_WHEEL_LEVELS
+/**
+ * @brief   Number of levels of the timing wheel
+ *
+ * Only used by the `xtimer_wheel` module. Timers further in the future than
+ * 2^(XTIMER_WHEEL_SLOT_BITS * XTIMER_WHEEL_LEVELS) ticks are kept in a
+ * separate list which is re-examined once per such period.
+ */
+#define XTIMER_WHEEL_LEVELS     (6)
+#endif
+
 /*
  * Default xtimer configuration
  */
@@ -0,0 +1,245 @@
+/*
+ * Copyright (C) 2026 agent <agent@local>
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @defgroup    sys_ztimer Multi-clock timer subsystem
+ * @ingroup     sys
+ * @brief       Relative 32 bit timers on multiple, independent clocks
+ *
+ * @note    Experimental, @ref sys_xtimer "xtimer" is still RIOT's main timer
+ *          subsystem
+ *
+ * @ref sys_xtimer "xtimer" multiplexes all timers onto one high frequency
+ * periph_timer. Timers that are minutes away still keep that timer (and its
+ * overflow handling) busy, and xtimer needs to handle 64 bit time internally
+ * just to be able to schedule long timeouts.
+ *
+ * ztimer instead provides one API for several clocks, each with its own
+ * timer list and its own hardware backend:
+ *
+ * - @ref ZTIMER_USEC: microsecond clock, backed by a periph_timer
+ *   (module `ztimer_usec`)
+ * - @ref ZTIMER_MSEC: millisecond clock, backed by the RTT
+ *   (module `ztimer_msec`)
+ *
+ * A timeout that is meant to be long-lived (neighbor cache, routing and DNS
+ * cache entries, ...) is set on @ref ZTIMER_MSEC and never wakes up the
+ * microsecond clock.
+ *
+ * All timer values are relative 32 bit offsets in the unit of the clock.
+ * Every clock keeps its pending timers in a list sorted by expiry, in which
+ * each entry only stores its offset to its predecessor (like
+ * @ref sys_evtimer "evtimer"). Hardware counter overflows thus never need to
+ * be handled for scheduling.
+ *
+ * If the hardware counter of a clock is narrower than 32 bit, the clock's
+ * interrupt is kept firing at least every half counter period while timers
+ * are pending on it, so ztimer_now() is extended to 32 bit. An idle clock
+ * does not cause any interrupt, so ztimer_now() of such a clock is only
+ * continuous while at least one timer is set on it, see ztimer_now().
+ *
+ * ztimer_usec and xtimer cannot share the same periph_timer device, see
+ * @ref ZTIMER_USEC_DEV.
+ *
+ * @{
+ *
+ * @file
+ * @brief       ztimer API
+ *
+ * @author      agent <agent@local>
+ */
+
+#ifndef ZTIMER_H
+#define ZTIMER_H
+
+#include <stdint.h>
+
+#include "kernel_types.h"
+#include "msg.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief   Timer list entry
+ */
+typedef struct ztimer_base ztimer_base_t;
+
+/**
+ * @brief   Timer list entry
+ */
+struct ztimer_base {
+    ztimer_base_t *next;        /**< next entry in the clock's list */
+    uint32_t offset;            /**< offset from the previous entry */
+};
+
+/**
+ * @brief   ztimer clock type
+ */
+typedef struct ztimer_clock ztimer_clock_t;
+
+/**
+ * @brief   ztimer backend operations
+ */
+typedef struct {
+    /**
+     * @brief   Set the clock's interrupt to fire @p val ticks from now
+     */
+    void (*set)(ztimer_clock_t *clock, uint32_t val);
+
+    /**
+     * @brief   Read the clock's hardware counter
+     */
+    uint32_t (*now)(ztimer_clock_t *clock);
+
+    /**
+     * @brief   Cancel any pending interrupt of the clock
+     */
+    void (*cancel)(ztimer_clock_t *clock);
+} ztimer_ops_t;
+
+/**
+ * @brief   ztimer clock
+ *
+ * Backends embed this as first member of their own clock structure.
+ */
+struct ztimer_clock {
+    ztimer_base_t list;         /**< list head, list.offset holds the clock
+                                     time the head's offset refers to */
+    const ztimer_ops_t *ops;    /**< backend operations */
+    uint32_t max_value;         /**< maximum value of the hardware counter,
+                                     must be 2^n - 1 */
+    uint32_t checkpoint;        /**< 32 bit time at @p lower_last */
+    uint32_t lower_last;        /**< last read hardware counter value */
+    uint16_t adjust;            /**< ticks subtracted from every interrupt
+                                     target to compensate for overhead */
+};
+
+/**
+ * @brief   ztimer callback type
+ */
+typedef void (*ztimer_callback_t)(void *arg);
+
+/**
+ * @brief   ztimer structure
+ *
+ * A timer may only be set on one clock at a time.
+ */
+typedef struct {
+    ztimer_base_t base;         /**< clock list entry */
+    ztimer_callback_t callback; /**< timer callback function pointer */
+    void *arg;                  /**< timer callback argument */
+} ztimer_t;
+
+/**
+ * @brief   Microsecond clock
+ */
+extern ztimer_clock_t *const ZTIMER_USEC;
+
+/**
+ * @brief   Millisecond clock
+ */
+extern ztimer_clock_t *const ZTIMER_MSEC;
+
+/**
+ * @brief   Set a timer on a clock
+ *
+ * The callback will be called from interrupt context @p val ticks of
+ * @p clock from now. A timer that is already set on @p clock is reset.
+ *
+ * @param[in] clock     clock to operate on
+ * @param[in] timer     timer entry to set
+ * @param[in] val       timer target (relative ticks from now)
+ */
+void ztimer_set(ztimer_clock_t *clock, ztimer_t *timer, uint32_t val);
+
+/**
+ * @brief   Remove a timer from a clock
+ *
+ * Does nothing if @p timer is not set on @p clock.
+ *
+ * @param[in] clock     clock to remove @p timer from
+ * @param[in] timer     timer entry to remove
+ */
+void ztimer_remove(ztimer_clock_t *clock, ztimer_t *timer);
+
+/**
+ * @brief   Get the current time of a clock
+ *
+ * @warning If the hardware counter of @p clock is narrower than 32 bit, the
+ *          counter is extended by its interrupt only while a timer is set on
+ *          @p clock. Without a timer, only the last counter period between
+ *          two calls is accounted for, so the returned time falls behind by
+ *          whole counter periods if the calls are further apart. Keep a
+ *          timer set on @p clock for as long as intervals are measured with
+ *          it, e.g. a timeout for the measured operation.
+ *
+ * @param[in] clock     clock to query
+ *
+ * @return  current time of @p clock, in ticks of the clock
+ */
+uint32_t ztimer_now(ztimer_clock_t *clock);
+
+/**
+ * @brief   Put the calling thread to sleep for the specified number of ticks
+ *
+ * @param[in] clock     clock to use
+ * @param[in] duration  duration of the sleep in ticks of @p clock
+ */
+void ztimer_sleep(ztimer_clock_t *clock, uint32_t duration);
+
+/**
+ * @brief   Set a timer that wakes up a thread
+ *
+ * @param[in] clock     clock to use
+ * @param[in] timer     timer struct to use
+ * @param[in] offset    clock ticks from now
+ * @param[in] pid       pid of the thread that will be woken up
+ */
+void ztimer_set_wakeup(ztimer_clock_t *clock, ztimer_t *timer, uint32_t offset,
+                       kernel_pid_t pid);
+
+/**
+ * @brief   Set a timer that sends a message
+ *
+ * The message is sent from interrupt context, so if the target thread's
+ * message queue is full, the message is lost.
+ *
+ * @param[in] clock         clock to use
+ * @param[in] timer         timer struct to use
+ * @param[in] offset        clock ticks from now
+ * @param[in] msg           pointer to msg that will be sent
+ * @param[in] target_pid    pid the message will be sent to
+ */
+void ztimer_set_msg(ztimer_clock_t *clock, ztimer_t *timer, uint32_t offset,
+                    msg_t *msg, kernel_pid_t target_pid);
+
+/**
+ * @brief   Main ztimer interrupt handler
+ *
+ * To be called by the backends from interrupt context when the clock's
+ * interrupt fires.
+ *
+ * @param[in] clock     clock that fired
+ */
+void ztimer_handler(ztimer_clock_t *clock);
+
+/**
+ * @brief   Initialize the configured ztimer clocks
+ *
+ * Called by auto_init.
+ */
+void ztimer_init(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* ZTIMER_H */
+/** @} */
@@ -0,0 +1,76 @@
+/*
+ * Copyright (C) 2026 agent <agent@local>
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     sys_ztimer
+ * @{
+ *
+ * @file
+ * @brief       ztimer default clock configuration
+ *
+ * All values can be overridden in the board's periph_conf.h or via CFLAGS.
+ *
+ * @author      agent <agent@local>
+ */
+
+#ifndef ZTIMER_CONFIG_H
+#define ZTIMER_CONFIG_H
+
+#include "board.h"
+#include "periph_conf.h"
+#ifdef MODULE_XTIMER
+#include "xtimer.h"
+#endif
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief   periph_timer device backing ZTIMER_USEC
+ *
+ * Must not be the device used by xtimer (XTIMER_DEV) if both are in use, so
+ * it defaults to TIMER_DEV(1) if XTIMER_DEV is TIMER_DEV(0) then.
+ */
+#ifndef ZTIMER_USEC_DEV
+#ifdef MODULE_XTIMER
+#define ZTIMER_USEC_DEV         (((XTIMER_DEV) == TIMER_DEV(0)) ? \
+                                 TIMER_DEV(1) : TIMER_DEV(0))
+#else
+#define ZTIMER_USEC_DEV         (TIMER_DEV(0))
+#endif
+#endif
+
+/**
+ * @brief   Maximum value of the ZTIMER_USEC_DEV counter
+ */
+#ifndef ZTIMER_USEC_MAX_VALUE
+#define ZTIMER_USEC_MAX_VALUE   (0xffffffffUL)
+#endif
+
+/**
+ * @brief   Ticks subtracted from every ZTIMER_USEC target to compensate
+ *          for the interrupt overhead
+ */
+#ifndef ZTIMER_USEC_ADJUST
+#define ZTIMER_USEC_ADJUST      (0U)
+#endif
+
+/**
+ * @brief   Minimum relative value ZTIMER_USEC_DEV can reliably be set to
+ */
+#ifndef ZTIMER_USEC_MIN
+#define ZTIMER_USEC_MIN         (10U)
+#endif
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* ZTIMER_CONFIG_H */
+/** @} */
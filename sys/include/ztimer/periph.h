@@ -0,0 +1,60 @@
+/*
+ * Copyright (C) 2026 agent <agent@local>
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @defgroup    sys_ztimer_periph ztimer periph_timer backend
+ * @ingroup     sys_ztimer
+ * @brief       ztimer clock on top of a periph_timer device
+ *
+ * Uses channel 0 of the timer device.
+ *
+ * @{
+ *
+ * @file
+ * @brief       ztimer periph_timer backend API
+ *
+ * @author      agent <agent@local>
+ */
+
+#ifndef ZTIMER_PERIPH_H
+#define ZTIMER_PERIPH_H
+
+#include "ztimer.h"
+#include "periph/timer.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief   ztimer periph_timer clock
+ */
+typedef struct {
+    ztimer_clock_t super;   /**< ztimer clock, must be first */
+    tim_t dev;              /**< periph_timer device */
+    uint16_t min;           /**< minimum relative value accepted by
+                                 timer_set() */
+} ztimer_periph_t;
+
+/**
+ * @brief   Initialize a periph_timer based clock
+ *
+ * @param[in] clock     clock to initialize
+ * @param[in] dev       periph_timer device to use
+ * @param[in] freq      frequency to run the timer at
+ * @param[in] max_val   maximum value of the timer counter, 2^n - 1
+ */
+void ztimer_periph_init(ztimer_periph_t *clock, tim_t dev, unsigned long freq,
+                        uint32_t max_val);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* ZTIMER_PERIPH_H */
+/** @} */
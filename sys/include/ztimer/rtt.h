@@ -0,0 +1,61 @@
+/*
+ * Copyright (C) 2026 agent <agent@local>
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @defgroup    sys_ztimer_rtt ztimer RTT backend
+ * @ingroup     sys_ztimer
+ * @brief       ztimer clock on top of the RTT
+ *
+ * The clock runs at RTT_FREQUENCY. As there is only one RTT, there can only
+ * be one clock using this backend.
+ *
+ * @{
+ *
+ * @file
+ * @brief       ztimer RTT backend API
+ *
+ * @author      agent <agent@local>
+ */
+
+#ifndef ZTIMER_RTT_H
+#define ZTIMER_RTT_H
+
+#include "ztimer.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief   Minimum number of RTT ticks an alarm is set in the future
+ *
+ * Setting the RTT alarm to the current counter value (or the next one) is
+ * unreliable on many RTT implementations.
+ */
+#ifndef ZTIMER_RTT_MIN
+#define ZTIMER_RTT_MIN      (2U)
+#endif
+
+/**
+ * @brief   ztimer RTT clock
+ */
+typedef ztimer_clock_t ztimer_rtt_t;
+
+/**
+ * @brief   Initialize the RTT based clock
+ *
+ * @param[in] clock     clock to initialize
+ */
+void ztimer_rtt_init(ztimer_rtt_t *clock);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* ZTIMER_RTT_H */
+/** @} */
@@ -150,6 +150,25 @@ int gnrc_netapi_send(kernel_pid_t pid, gnrc_pktsnip_t *pkt)
     return _snd_rcv(pid, GNRC_NETAPI_MSG_TYPE_SND, pkt);
 }
 
+int gnrc_netapi_send_train(kernel_pid_t pid, gnrc_pktqueue_t **train)
+{
+    msg_t cmd;
+    msg_t ack;
+
+    cmd.type = GNRC_NETAPI_MSG_TYPE_SND_TRAIN;
+    cmd.content.ptr = (void *)*train;
+    if (msg_send_receive(&cmd, &ack, pid) < 1) {
+        DEBUG("gnrc_netapi: unable to send train to %" PRIkernel_pid "\n", pid);
+        return -1;
+    }
+    assert(ack.type == GNRC_NETAPI_MSG_TYPE_ACK);
+    /* remove the packets the receiver took from the train */
+    for (uint32_t i = 0; (i < ack.content.value) && (*train != NULL); i++) {
+        gnrc_pktqueue_remove_head(train);
+    }
+    return (int)ack.content.value;
+}
+
 int gnrc_netapi_receive(kernel_pid_t pid, gnrc_pktsnip_t *pkt)
 {
     return _snd_rcv(pid, GNRC_NETAPI_MSG_TYPE_RCV, pkt);
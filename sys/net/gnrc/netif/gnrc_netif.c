@@ -1333,6 +1333,21 @@ static void *_gnrc_netif_thread(void *args)
                           msg.content.ptr, res);
                 }
                 break;
+            case GNRC_NETAPI_MSG_TYPE_SND_TRAIN:
+                DEBUG("gnrc_netif: GNRC_NETAPI_MSG_TYPE_SND_TRAIN received\n");
+                reply.content.value = 0;
+                for (gnrc_pktqueue_t *node = msg.content.ptr; node != NULL;
+                     node = node->next) {
+                    res = netif->ops->send(netif, node->pkt);
+                    if (res < 0) {
+                        DEBUG("gnrc_netif: error sending packet %p (code: %u)\n",
+                              (void *)node->pkt, res);
+                    }
+                    /* the device took ownership of the packet either way */
+                    reply.content.value++;
+                }
+                msg_reply(&msg, &reply);
+                break;
             case GNRC_NETAPI_MSG_TYPE_SET:
                 opt = msg.content.ptr;
 #ifdef MODULE_NETOPT
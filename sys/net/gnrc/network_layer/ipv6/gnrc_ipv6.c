@@ -19,6 +19,7 @@
 #include "byteorder.h"
 #include "cpu_conf.h"
 #include "kernel_types.h"
+#include "mutex.h"
 #include "net/gnrc.h"
 #include "net/gnrc/icmpv6.h"
 #include "net/gnrc/sixlowpan/ctx.h"
@@ -63,6 +64,12 @@ static char addr_str[IPV6_ADDR_MAX_STR_LEN];
 
 kernel_pid_t gnrc_ipv6_pid = KERNEL_PID_UNDEF;
 
+#ifdef MODULE_GNRC_NETAPI_RTC
+/* held while a packet is handled, so the dispatching thread and the IPv6
+ * thread don't handle packets concurrently */
+static mutex_t _rtc_lock = MUTEX_INIT;
+#endif
+
 /* handles GNRC_NETAPI_MSG_TYPE_RCV commands */
 static void _receive(gnrc_pktsnip_t *pkt);
 /* Sends packet over the appropriate interface(s).
@@ -248,11 +255,63 @@ static void _dispatch_next_header(gnrc_pktsnip_t *current, gnrc_pktsnip_t *pkt,
     }
 }
 
+#ifdef MODULE_GNRC_NETAPI_RTC
+/* Neighbor discovery and other ICMPv6 handling may call gnrc_netapi_get()
+ * on the interfaces, which would block (or deadlock) the interface thread the
+ * packet was dispatched by, so only upper layer data is handled directly */
+static bool _rtc_is_data(gnrc_pktsnip_t *pkt)
+{
+    gnrc_pktsnip_t *ipv6 = gnrc_pktsnip_search_type(pkt, GNRC_NETTYPE_IPV6);
+    ipv6_hdr_t *hdr;
+
+    if ((ipv6 == NULL) || (ipv6->size < sizeof(ipv6_hdr_t)) ||
+        !ipv6_hdr_is(ipv6->data)) {
+        return false;
+    }
+    hdr = ipv6->data;
+    return (hdr->nh == PROTNUM_UDP) || (hdr->nh == PROTNUM_TCP);
+}
+
+static void _rtc_cb(uint16_t cmd, gnrc_pktsnip_t *pkt, void *ctx)
+{
+    msg_t msg;
+
+    (void)ctx;
+    if ((cmd == GNRC_NETAPI_MSG_TYPE_RCV) && _rtc_is_data(pkt) &&
+        mutex_trylock(&_rtc_lock)) {
+        /* packets queued before must not be overtaken */
+        if (msg_avail_thread(gnrc_ipv6_pid) == 0) {
+            DEBUG("ipv6: handle received packet in thread %" PRIkernel_pid "\n",
+                  sched_active_pid);
+            _receive(pkt);
+            mutex_unlock(&_rtc_lock);
+            return;
+        }
+        mutex_unlock(&_rtc_lock);
+    }
+    /* packet is to be sent, control traffic, or IPv6 thread is busy */
+    msg.type = cmd;
+    msg.content.ptr = pkt;
+    if (msg_try_send(&msg, gnrc_ipv6_pid) < 1) {
+        DEBUG("ipv6: unable to queue packet to IPv6 thread\n");
+        gnrc_pktbuf_release(pkt);
+    }
+}
+#endif
+
 static void *_event_loop(void *args)
 {
     msg_t msg, reply, msg_q[GNRC_IPV6_MSG_QUEUE_SIZE];
+#ifdef MODULE_GNRC_NETAPI_RTC
+    gnrc_netreg_entry_cbd_t me_cbd = { .cb = _rtc_cb, .ctx = NULL };
+    gnrc_netreg_entry_t me_reg;
+
+    /* receive packets in the dispatching thread */
+    gnrc_netreg_entry_init_cb(&me_reg, GNRC_NETREG_DEMUX_CTX_ALL, &me_cbd);
+#else
     gnrc_netreg_entry_t me_reg = GNRC_NETREG_ENTRY_INIT_PID(GNRC_NETREG_DEMUX_CTX_ALL,
                                                             sched_active_pid);
+#endif
 
     (void)args;
     msg_init_queue(msg_q, GNRC_IPV6_MSG_QUEUE_SIZE);
@@ -267,6 +326,9 @@ static void *_event_loop(void *args)
     while (1) {
         DEBUG("ipv6: waiting for incoming message.\n");
         msg_receive(&msg);
+#ifdef MODULE_GNRC_NETAPI_RTC
+        mutex_lock(&_rtc_lock);
+#endif
 
         switch (msg.type) {
             case GNRC_NETAPI_MSG_TYPE_RCV:
@@ -308,6 +370,9 @@ static void *_event_loop(void *args)
             default:
                 break;
         }
+#ifdef MODULE_GNRC_NETAPI_RTC
+        mutex_unlock(&_rtc_lock);
+#endif
     }
 
     return NULL;
@@ -513,6 +578,53 @@ static inline void _send_multicast_over_iface(gnrc_pktsnip_t *pkt,
     _send_to_iface(netif, pkt);
 }
 
+#if GNRC_NETIF_NUMOF > 1
+/**
+ * @brief   Splits the upper layer header of @p ipv6 from its payload
+ *
+ * The upper layer header needs to be private to each interface a multicast
+ * packet is sent over, as its checksum depends on the source address, but
+ * the payload behind it can be shared. This is only needed for upper layer
+ * protocols that build header and payload in one snip.
+ */
+static void _split_upper_hdr(gnrc_pktsnip_t *ipv6)
+{
+    gnrc_pktsnip_t *upper = ipv6->next, *payload;
+    size_t hdr_size;
+    void *data;
+
+    while ((upper != NULL) && _is_ipv6_hdr(upper)) {
+        upper = upper->next;
+    }
+    if ((upper == NULL) || (upper->users > 1)) {
+        return;
+    }
+    switch (upper->type) {
+#ifdef MODULE_GNRC_ICMPV6
+        case GNRC_NETTYPE_ICMPV6:
+            hdr_size = sizeof(icmpv6_hdr_t);
+            break;
+#endif
+        default:
+            return;
+    }
+    if ((upper->size <= hdr_size) ||
+        ((payload = gnrc_pktbuf_mark(upper, hdr_size,
+                                     GNRC_NETTYPE_UNDEF)) == NULL)) {
+        /* duplicate the whole snip for every interface then */
+        return;
+    }
+    /* gnrc_pktbuf_mark() puts the marked snip behind the rest, as it would
+     * be in a received packet, so swap their data to keep the order of a
+     * packet that is sent */
+    data = upper->data;
+    upper->data = payload->data;
+    payload->data = data;
+    payload->size = upper->size;
+    upper->size = hdr_size;
+}
+#endif  /* GNRC_NETIF_NUMOF */
+
 static void _send_multicast(gnrc_pktsnip_t *pkt, bool prep_hdr,
                             gnrc_netif_t *netif, uint8_t netif_hdr_flags)
 {
@@ -532,32 +644,37 @@ static void _send_multicast(gnrc_pktsnip_t *pkt, bool prep_hdr,
 #if GNRC_NETIF_NUMOF > 1
     /* interface not given: send over all interfaces */
     if (netif == NULL) {
-        /* send packet to link layer */
+        if (prep_hdr && (ifnum > 1)) {
+            _split_upper_hdr(pkt);
+        }
+        /* every interface gets its own reference to the packet. Only the
+         * headers that are filled for the interface are duplicated (by
+         * _fill_ipv6_hdr()), the payload stays shared */
         gnrc_pktbuf_hold(pkt, ifnum - 1);
 
         while ((netif = gnrc_netif_iter(netif))) {
+            gnrc_pktsnip_t *tmp = pkt;
+
             if (prep_hdr) {
                 DEBUG("ipv6: prepare IPv6 header for sending\n");
                 /* need to get second write access (duplication) to fill IPv6
                  * header interface-local */
-                gnrc_pktsnip_t *tmp = gnrc_pktbuf_start_write(pkt);
+                tmp = gnrc_pktbuf_start_write(pkt);
 
                 if (tmp == NULL) {
                     DEBUG("ipv6: unable to get write access to IPv6 header, "
                           "for interface %" PRIkernel_pid "\n", netif->pid);
                     gnrc_pktbuf_release(pkt);
-                    return;
+                    continue;
                 }
                 if (_fill_ipv6_hdr(netif, tmp) < 0) {
-                    /* error on filling up header */
-                    if (tmp != pkt) {
-                        gnrc_pktbuf_release(tmp);
-                    }
-                    gnrc_pktbuf_release(pkt);
-                    return;
+                    /* error on filling up header, tmp holds the reference
+                     * of this interface */
+                    gnrc_pktbuf_release(tmp);
+                    continue;
                 }
             }
-            _send_multicast_over_iface(pkt, netif, netif_hdr_flags);
+            _send_multicast_over_iface(tmp, netif, netif_hdr_flags);
         }
     }
     else {
@@ -42,6 +42,25 @@ static _nib_dr_entry_t _def_routers[GNRC_IPV6_NIB_DEFAULT_ROUTER_NUMOF];
 static _nib_abr_entry_t _abrs[GNRC_IPV6_NIB_ABR_NUMOF];
 #endif  /* GNRC_IPV6_NIB_CONF_MULTIHOP_P6C */
 
+/**
+ * @brief   A prefix length used by off-link entries
+ */
+typedef struct {
+    uint16_t numof;     /**< number of off-link entries with that length */
+    uint8_t len;        /**< the prefix length */
+} _pfx_len_t;
+
+/* If several entries in a bucket of the following indexes match a lookup,
+ * the one that comes first in _nodes or _dsts is returned, as with a linear
+ * search */
+/* on-link entries with a specified address, hashed by that address */
+static _nib_onl_entry_t *_nodes_idx[GNRC_IPV6_NIB_ONL_HASH_SIZE];
+/* allocated off-link entries, hashed by their prefix and its length */
+static _nib_offl_entry_t *_dsts_idx[GNRC_IPV6_NIB_OFFL_HASH_SIZE];
+/* prefix lengths in _dsts_idx, longest first */
+static _pfx_len_t _dsts_pfx_lens[GNRC_IPV6_NIB_OFFL_NUMOF];
+static unsigned _dsts_pfx_lens_numof = 0;
+
 static char addr_str[IPV6_ADDR_MAX_STR_LEN];
 
 mutex_t _nib_mutex = MUTEX_INIT;
@@ -59,6 +78,9 @@ void _nib_init(void)
     memset(_nodes, 0, sizeof(_nodes));
     memset(_def_routers, 0, sizeof(_def_routers));
     memset(_dsts, 0, sizeof(_dsts));
+    memset(_nodes_idx, 0, sizeof(_nodes_idx));
+    memset(_dsts_idx, 0, sizeof(_dsts_idx));
+    _dsts_pfx_lens_numof = 0;
 #if GNRC_IPV6_NIB_CONF_MULTIHOP_P6C
     memset(_abrs, 0, sizeof(_abrs));
 #endif  /* GNRC_IPV6_NIB_CONF_MULTIHOP_P6C */
@@ -74,6 +96,62 @@ static inline bool _addr_equals(const ipv6_addr_t *addr,
            (ipv6_addr_equal(addr, &node->ipv6));
 }
 
+static uint32_t _addr_hash(const ipv6_addr_t *addr)
+{
+    uint32_t hash = addr->u32[0].u32 ^ addr->u32[1].u32 ^
+                    addr->u32[2].u32 ^ addr->u32[3].u32;
+
+    /* mix, so addresses that only differ in a few bits of their IID still
+     * end up in different buckets */
+    hash ^= hash >> 16;
+    hash *= 0x45d9f3bU;
+    hash ^= hash >> 16;
+    return hash;
+}
+
+static inline _nib_onl_entry_t **_onl_bucket(const ipv6_addr_t *addr)
+{
+    return &_nodes_idx[_addr_hash(addr) % GNRC_IPV6_NIB_ONL_HASH_SIZE];
+}
+
+static void _onl_unindex(_nib_onl_entry_t *node)
+{
+    if (ipv6_addr_is_unspecified(&node->ipv6)) {
+        /* entries without address are not indexed */
+        return;
+    }
+    for (_nib_onl_entry_t **ptr = _onl_bucket(&node->ipv6); *ptr != NULL;
+         ptr = &(*ptr)->idx_next) {
+        if (*ptr == node) {
+            *ptr = node->idx_next;
+            node->idx_next = NULL;
+            return;
+        }
+    }
+}
+
+static void _onl_set_addr(_nib_onl_entry_t *node, const ipv6_addr_t *addr)
+{
+    _onl_unindex(node);
+    memcpy(&node->ipv6, addr, sizeof(node->ipv6));
+    if (!ipv6_addr_is_unspecified(addr)) {
+        _nib_onl_entry_t **bucket = _onl_bucket(addr);
+
+        node->idx_next = *bucket;
+        *bucket = node;
+    }
+}
+
+bool _nib_onl_clear(_nib_onl_entry_t *node)
+{
+    if (node->mode == _EMPTY) {
+        _onl_unindex(node);
+        memset(node, 0, sizeof(_nib_onl_entry_t));
+        return true;
+    }
+    return false;
+}
+
 _nib_onl_entry_t *_nib_onl_alloc(const ipv6_addr_t *addr, unsigned iface)
 {
     _nib_onl_entry_t *node = NULL;
@@ -81,6 +159,23 @@ _nib_onl_entry_t *_nib_onl_alloc(const ipv6_addr_t *addr, unsigned iface)
     DEBUG("nib: Allocating on-link node entry (addr = %s, iface = %u)\n",
           (addr == NULL) ? "NULL" : ipv6_addr_to_str(addr_str, addr,
                                                      sizeof(addr_str)), iface);
+    if ((addr != NULL) && !ipv6_addr_is_unspecified(addr)) {
+        for (_nib_onl_entry_t *tmp = *_onl_bucket(addr); tmp != NULL;
+             tmp = tmp->idx_next) {
+            if ((_nib_onl_get_if(tmp) == iface) &&
+                ipv6_addr_equal(addr, &tmp->ipv6) &&
+                ((node == NULL) || (tmp < node))) {
+                node = tmp;
+            }
+        }
+        if (node != NULL) {
+            DEBUG("  %p is an exact match\n", (void *)node);
+            _override_node(addr, iface, node);
+            return node;
+        }
+    }
+    /* address is new: search for an entry without address on the interface
+     * or a free one */
     for (unsigned i = 0; i < GNRC_IPV6_NIB_NUMOF; i++) {
         _nib_onl_entry_t *tmp = &_nodes[i];
 
@@ -198,26 +293,51 @@ _nib_onl_entry_t *_nib_onl_iter(const _nib_onl_entry_t *last)
     return NULL;
 }
 
+static inline bool _onl_matches(const _nib_onl_entry_t *node,
+                                const ipv6_addr_t *addr, unsigned iface)
+{
+    return (node->mode != _EMPTY) &&
+           /* either requested or current interface undefined or
+            * interfaces equal */
+           ((_nib_onl_get_if(node) == 0) || (iface == 0) ||
+            (_nib_onl_get_if(node) == iface)) &&
+           ipv6_addr_equal(&node->ipv6, addr);
+}
+
 _nib_onl_entry_t *_nib_onl_get(const ipv6_addr_t *addr, unsigned iface)
 {
+    _nib_onl_entry_t *res = NULL;
+
     assert(addr != NULL);
     DEBUG("nib: Getting on-link node entry (addr = %s, iface = %u)\n",
           ipv6_addr_to_str(addr_str, addr, sizeof(addr_str)), iface);
-    for (unsigned i = 0; i < GNRC_IPV6_NIB_NUMOF; i++) {
-        _nib_onl_entry_t *node = &_nodes[i];
-
-        if ((node->mode != _EMPTY) &&
-            /* either requested or current interface undefined or
-             * interfaces equal */
-            ((_nib_onl_get_if(node) == 0) || (iface == 0) ||
-             (_nib_onl_get_if(node) == iface)) &&
-            ipv6_addr_equal(&node->ipv6, addr)) {
-            DEBUG("  Found %p\n", (void *)node);
-            return node;
+    if (ipv6_addr_is_unspecified(addr)) {
+        /* entries without address are not indexed */
+        for (unsigned i = 0; i < GNRC_IPV6_NIB_NUMOF; i++) {
+            if (_onl_matches(&_nodes[i], addr, iface)) {
+                res = &_nodes[i];
+                break;
+            }
         }
     }
-    DEBUG("  No suitable entry found\n");
-    return NULL;
+    else {
+        for (_nib_onl_entry_t *node = *_onl_bucket(addr); node != NULL;
+             node = node->idx_next) {
+            if (_onl_matches(node, addr, iface) &&
+                ((res == NULL) || (node < res))) {
+                res = node;
+            }
+        }
+    }
+#if ENABLE_DEBUG
+    if (res != NULL) {
+        DEBUG("  Found %p\n", (void *)res);
+    }
+    else {
+        DEBUG("  No suitable entry found\n");
+    }
+#endif  /* ENABLE_DEBUG */
+    return res;
 }
 
 void _nib_nc_set_reachable(_nib_onl_entry_t *node)
@@ -437,10 +557,107 @@ void _nib_drl_ft_get(const _nib_dr_entry_t *drl, gnrc_ipv6_nib_ft_t *fte)
     fte->iface = _nib_onl_get_if(drl->next_hop);
 }
 
+static inline void _init_pfx_key(ipv6_addr_t *key, const ipv6_addr_t *pfx,
+                                 unsigned pfx_len)
+{
+    ipv6_addr_set_unspecified(key);
+    ipv6_addr_init_prefix(key, pfx, pfx_len);
+}
+
+static inline _nib_offl_entry_t **_offl_bucket(const ipv6_addr_t *key,
+                                               unsigned pfx_len)
+{
+    return &_dsts_idx[(_addr_hash(key) + pfx_len) %
+                      GNRC_IPV6_NIB_OFFL_HASH_SIZE];
+}
+
+static void _offl_index(_nib_offl_entry_t *dst)
+{
+    _nib_offl_entry_t **bucket;
+    ipv6_addr_t key;
+    unsigned i;
+
+    _init_pfx_key(&key, &dst->pfx, dst->pfx_len);
+    bucket = _offl_bucket(&key, dst->pfx_len);
+    dst->idx_next = *bucket;
+    *bucket = dst;
+    for (i = 0; (i < _dsts_pfx_lens_numof) &&
+                (_dsts_pfx_lens[i].len > dst->pfx_len); i++) {}
+    if ((i < _dsts_pfx_lens_numof) && (_dsts_pfx_lens[i].len == dst->pfx_len)) {
+        _dsts_pfx_lens[i].numof++;
+        return;
+    }
+    /* there is at most one prefix length per entry */
+    assert(_dsts_pfx_lens_numof < GNRC_IPV6_NIB_OFFL_NUMOF);
+    memmove(&_dsts_pfx_lens[i + 1], &_dsts_pfx_lens[i],
+            (_dsts_pfx_lens_numof - i) * sizeof(_dsts_pfx_lens[0]));
+    _dsts_pfx_lens[i].len = dst->pfx_len;
+    _dsts_pfx_lens[i].numof = 1;
+    _dsts_pfx_lens_numof++;
+}
+
+static void _offl_unindex(_nib_offl_entry_t *dst)
+{
+    ipv6_addr_t key;
+
+    _init_pfx_key(&key, &dst->pfx, dst->pfx_len);
+    for (_nib_offl_entry_t **ptr = _offl_bucket(&key, dst->pfx_len);
+         *ptr != NULL; ptr = &(*ptr)->idx_next) {
+        if (*ptr == dst) {
+            *ptr = dst->idx_next;
+            dst->idx_next = NULL;
+            break;
+        }
+    }
+    for (unsigned i = 0; i < _dsts_pfx_lens_numof; i++) {
+        if (_dsts_pfx_lens[i].len == dst->pfx_len) {
+            if (--_dsts_pfx_lens[i].numof == 0) {
+                _dsts_pfx_lens_numof--;
+                memmove(&_dsts_pfx_lens[i], &_dsts_pfx_lens[i + 1],
+                        (_dsts_pfx_lens_numof - i) * sizeof(_dsts_pfx_lens[0]));
+            }
+            break;
+        }
+    }
+}
+
+/* longest-prefix match over the entries that have any of the bits in mode
+ * and all bits in flags set */
+static _nib_offl_entry_t *_offl_match(const ipv6_addr_t *addr, uint8_t mode,
+                                      uint16_t flags)
+{
+    for (unsigned i = 0; i < _dsts_pfx_lens_numof; i++) {
+        unsigned pfx_len = _dsts_pfx_lens[i].len;
+        _nib_offl_entry_t *res = NULL;
+        ipv6_addr_t key;
+
+        _init_pfx_key(&key, addr, pfx_len);
+        for (_nib_offl_entry_t *entry = *_offl_bucket(&key, pfx_len);
+             entry != NULL; entry = entry->idx_next) {
+            if ((entry->mode & mode) && ((entry->flags & flags) == flags) &&
+                (entry->pfx_len == pfx_len) &&
+                (ipv6_addr_match_prefix(&entry->pfx, &key) >= pfx_len) &&
+                ((res == NULL) || (entry < res))) {
+                res = entry;
+            }
+        }
+        if (res != NULL) {
+            DEBUG("nib: %s matches ",
+                  ipv6_addr_to_str(addr_str, addr, sizeof(addr_str)));
+            DEBUG("%s/%u\n",
+                  ipv6_addr_to_str(addr_str, &res->pfx, sizeof(addr_str)),
+                  res->pfx_len);
+            return res;
+        }
+    }
+    return NULL;
+}
+
 _nib_offl_entry_t *_nib_offl_alloc(const ipv6_addr_t *next_hop, unsigned iface,
                                    const ipv6_addr_t *pfx, unsigned pfx_len)
 {
     _nib_offl_entry_t *dst = NULL;
+    ipv6_addr_t key;
 
     assert((pfx != NULL) && (!ipv6_addr_is_unspecified(pfx)) &&
            (pfx_len > 0) && (pfx_len <= 128));
@@ -451,27 +668,36 @@ _nib_offl_entry_t *_nib_offl_alloc(const ipv6_addr_t *next_hop, unsigned iface,
           iface);
     DEBUG("pfx = %s/%u)\n", ipv6_addr_to_str(addr_str, pfx,
                                              sizeof(addr_str)), pfx_len);
-    for (unsigned i = 0; i < GNRC_IPV6_NIB_OFFL_NUMOF; i++) {
-        _nib_offl_entry_t *tmp = &_dsts[i];
+    _init_pfx_key(&key, pfx, pfx_len);
+    for (_nib_offl_entry_t *tmp = *_offl_bucket(&key, pfx_len); tmp != NULL;
+         tmp = tmp->idx_next) {
         _nib_onl_entry_t *tmp_node = tmp->next_hop;
 
+        /* only allocated entries (with a next hop) are indexed */
+        assert(tmp_node != NULL);
         if ((tmp->pfx_len == pfx_len) &&                /* prefix length matches and */
-            (tmp_node != NULL) &&                       /* there is a next hop that */
-            (_nib_onl_get_if(tmp_node) == iface) &&     /* has a matching interface and */
+            (_nib_onl_get_if(tmp_node) == iface) &&     /* the next hop has a matching interface and */
             _addr_equals(next_hop, tmp_node) &&         /* equal address to next_hop, also */
-            (ipv6_addr_match_prefix(&tmp->pfx, pfx) >= pfx_len)) {  /* the prefix matches */
-            /* exact match (or next hop address was previously unset) */
-            DEBUG("  %p is an exact match\n", (void *)tmp);
-            if (next_hop != NULL) {
-                memcpy(&tmp_node->ipv6, next_hop, sizeof(tmp_node->ipv6));
-            }
-            tmp->next_hop->mode |= _DST;
-            return tmp;
-        }
-        if ((dst == NULL) && (tmp_node == NULL)) {
+            (ipv6_addr_match_prefix(&tmp->pfx, &key) >= pfx_len) &&   /* the prefix matches */
+            ((dst == NULL) || (tmp < dst))) {
             dst = tmp;
         }
     }
+    if (dst != NULL) {
+        /* exact match (or next hop address was previously unset) */
+        DEBUG("  %p is an exact match\n", (void *)dst);
+        if (next_hop != NULL) {
+            _onl_set_addr(dst->next_hop, next_hop);
+        }
+        dst->next_hop->mode |= _DST;
+        return dst;
+    }
+    for (unsigned i = 0; i < GNRC_IPV6_NIB_OFFL_NUMOF; i++) {
+        if (_dsts[i].next_hop == NULL) {
+            dst = &_dsts[i];
+            break;
+        }
+    }
     if (dst != NULL) {
         DEBUG("  using %p\n", (void *)dst);
         dst->next_hop = _nib_onl_alloc(next_hop, iface);
@@ -484,6 +710,7 @@ _nib_offl_entry_t *_nib_offl_alloc(const ipv6_addr_t *next_hop, unsigned iface,
         dst->next_hop->mode |= _DST;
         ipv6_addr_init_prefix(&dst->pfx, pfx, pfx_len);
         dst->pfx_len = pfx_len;
+        _offl_index(dst);
     }
     return dst;
 }
@@ -515,6 +742,7 @@ void _nib_offl_clear(_nib_offl_entry_t *dst)
             dst->next_hop->mode &= ~(_DST);
             _nib_onl_clear(dst->next_hop);
         }
+        _offl_unindex(dst);
         memset(dst, 0, sizeof(_nib_offl_entry_t));
     }
 }
@@ -538,33 +766,12 @@ bool _nib_offl_is_entry(const _nib_offl_entry_t *entry)
     return (entry >= _dsts) && _in_dsts(entry);
 }
 
-static _nib_offl_entry_t *_nib_offl_get_match(const ipv6_addr_t *dst)
+static inline _nib_offl_entry_t *_nib_offl_get_match(const ipv6_addr_t *dst)
 {
-    _nib_offl_entry_t *res = NULL;
-    uint8_t best_match = 0;
-
     DEBUG("nib: get match for destination %s from NIB\n",
           ipv6_addr_to_str(addr_str, dst, sizeof(addr_str)));
-    for (_nib_offl_entry_t *entry = _dsts; _in_dsts(entry); entry++) {
-        if (entry->mode != _EMPTY) {
-            uint8_t match = ipv6_addr_match_prefix(&entry->pfx, dst);
-
-            DEBUG("nib: %s/%u => ",
-                  ipv6_addr_to_str(addr_str, &entry->pfx, sizeof(addr_str)),
-                  entry->pfx_len);
-            DEBUG("%s%%%u matches with %u bits\n",
-                  (entry->mode == _PL) ? "(nil)" :
-                  ipv6_addr_to_str(addr_str, &entry->next_hop->ipv6,
-                                   sizeof(addr_str)),
-                  _nib_onl_get_if(entry->next_hop), match);
-            if ((match > best_match) && (match >= entry->pfx_len)) {
-                DEBUG("nib: best match (%u bits)\n", match);
-                res = entry;
-                best_match = match;
-            }
-        }
-    }
-    return res;
+    /* any mode but _EMPTY */
+    return _offl_match(dst, UINT8_MAX, 0);
 }
 
 void _nib_ft_get(const _nib_offl_entry_t *dst, gnrc_ipv6_nib_ft_t *fte)
@@ -622,6 +829,11 @@ int _nib_get_route(const ipv6_addr_t *dst, gnrc_pktsnip_t *pkt,
     return 0;
 }
 
+_nib_offl_entry_t *_nib_pl_get_on_link(const ipv6_addr_t *dst)
+{
+    return _offl_match(dst, _PL, _PFX_ON_LINK);
+}
+
 void _nib_pl_remove(_nib_offl_entry_t *nib_offl)
 {
     _nib_offl_remove(nib_offl, _PL);
@@ -792,7 +1004,7 @@ static void _override_node(const ipv6_addr_t *addr, unsigned iface,
 {
     _nib_onl_clear(node);
     if (addr != NULL) {
-        memcpy(&node->ipv6, addr, sizeof(node->ipv6));
+        _onl_set_addr(node, addr);
     }
     _nib_onl_set_if(node, iface);
 }
@@ -91,6 +91,8 @@ extern "C" {
  */
 typedef struct _nib_onl_entry {
     struct _nib_onl_entry *next;        /**< next removable entry */
+    struct _nib_onl_entry *idx_next;    /**< next entry in the same bucket
+                                         *   of the address index */
 #if GNRC_IPV6_NIB_CONF_QUEUE_PKT || defined(DOXYGEN)
     /**
      * @brief   queue for packets currently in address resolution
@@ -194,7 +196,9 @@ typedef struct {
 /**
  * @brief   Off-link NIB entry
  */
-typedef struct {
+typedef struct _nib_offl_entry {
+    struct _nib_offl_entry *idx_next;   /**< next entry in the same bucket
+                                         *   of the prefix index */
     _nib_onl_entry_t *next_hop; /**< next hop to destination */
     ipv6_addr_t pfx;            /**< prefix to the destination */
     /**
@@ -312,14 +316,7 @@ _nib_onl_entry_t *_nib_onl_alloc(const ipv6_addr_t *addr, unsigned iface);
  * @return  true, if entry was cleared.
  * @return  false, if entry was not cleared.
  */
-static inline bool _nib_onl_clear(_nib_onl_entry_t *node)
-{
-    if (node->mode == _EMPTY) {
-        memset(node, 0, sizeof(_nib_onl_entry_t));
-        return true;
-    }
-    return false;
-}
+bool _nib_onl_clear(_nib_onl_entry_t *node);
 
 /**
  * @brief   Iterates over on-link entries
@@ -655,6 +652,18 @@ _nib_offl_entry_t *_nib_pl_add(unsigned iface,
  */
 void _nib_pl_remove(_nib_offl_entry_t *nib_offl);
 
+/**
+ * @brief   Gets the on-link prefix list entry with the longest prefix
+ *          matching an address
+ *
+ * @param[in] dst   An IPv6 address.
+ *
+ * @return  The prefix list entry with the longest on-link prefix matching
+ *          @p dst.
+ * @return  NULL, if @p dst does not match any on-link prefix.
+ */
+_nib_offl_entry_t *_nib_pl_get_on_link(const ipv6_addr_t *dst);
+
 #if GNRC_IPV6_NIB_CONF_ROUTER || DOXYGEN
 /**
  * @brief   Creates or gets an existing forwarding table entry by its prefix
@@ -23,10 +23,21 @@
 #include "net/gnrc/sixlowpan/frag.h"
 #include "net/gnrc/sixlowpan/internal.h"
 #include "net/gnrc/netif.h"
+#include "net/gnrc/pktqueue.h"
 #include "net/sixlowpan.h"
 #include "utlist.h"
 
 #include "rbuf.h"
+#ifdef MODULE_GNRC_SIXLOWPAN_FRAG_VRB
+#include "net/gnrc/ipv6/nib.h"
+#include "net/gnrc/netif/internal.h"
+#include "net/gnrc/sixlowpan/iphc.h"
+#include "net/ipv6/hdr.h"
+#include "net/protnum.h"
+#include "xtimer.h"
+
+#include "vrb.h"
+#endif
 
 #define ENABLE_DEBUG    (0)
 #include "debug.h"
@@ -86,8 +97,9 @@ static gnrc_pktsnip_t *_build_frag_pkt(gnrc_pktsnip_t *pkt, size_t payload_len,
     return frag;
 }
 
-static uint16_t _send_1st_fragment(gnrc_netif_t *iface, gnrc_pktsnip_t *pkt,
-                                   size_t payload_len, size_t datagram_size)
+static uint16_t _build_1st_fragment(gnrc_netif_t *iface, gnrc_pktsnip_t *pkt,
+                                    size_t payload_len, size_t datagram_size,
+                                    gnrc_pktsnip_t **out)
 {
     gnrc_pktsnip_t *frag;
     uint16_t local_offset = 0;
@@ -136,16 +148,16 @@ static uint16_t _send_1st_fragment(gnrc_netif_t *iface, gnrc_pktsnip_t *pkt,
         pkt = pkt->next;
     }
 
-    DEBUG("6lo frag: send first fragment (datagram size: %u, "
+    DEBUG("6lo frag: built first fragment (datagram size: %u, "
           "datagram tag: %" PRIu16 ", fragment size: %" PRIu16 ")\n",
           (unsigned int)datagram_size, _tag, local_offset);
-    gnrc_sixlowpan_dispatch_send(frag, NULL, 0);
+    *out = frag;
     return local_offset;
 }
 
-static uint16_t _send_nth_fragment(gnrc_netif_t *iface, gnrc_pktsnip_t *pkt,
-                                   size_t payload_len, size_t datagram_size,
-                                   uint16_t offset)
+static uint16_t _build_nth_fragment(gnrc_netif_t *iface, gnrc_pktsnip_t *pkt,
+                                    size_t payload_len, size_t datagram_size,
+                                    uint16_t offset, gnrc_pktsnip_t **out)
 {
     gnrc_pktsnip_t *frag;
     /* since dispatches aren't supposed to go into subsequent fragments, we need not account
@@ -220,12 +232,12 @@ static uint16_t _send_nth_fragment(gnrc_netif_t *iface, gnrc_pktsnip_t *pkt,
         }
     }
 
-    DEBUG("6lo frag: send subsequent fragment (datagram size: %u, "
+    DEBUG("6lo frag: built subsequent fragment (datagram size: %u, "
           "datagram tag: %" PRIu16 ", offset: %" PRIu8 " (%u bytes), "
           "fragment size: %" PRIu16 ")\n",
           (unsigned int)datagram_size, _tag, hdr->offset, hdr->offset << 3,
           local_offset);
-    gnrc_sixlowpan_dispatch_send(frag, NULL, 0);
+    *out = frag;
     return local_offset;
 }
 
@@ -234,12 +246,32 @@ gnrc_sixlowpan_msg_frag_t *gnrc_sixlowpan_msg_frag_get(void)
     return (_fragment_msg.pkt == NULL) ? &_fragment_msg : NULL;
 }
 
+/* hands the fragments in train to the interface, releases those it did not
+ * take. Returns false if it did not take all of them */
+static bool _send_train(gnrc_netif_t *iface, gnrc_pktqueue_t *train)
+{
+    int res = gnrc_netapi_send_train(iface->pid, &train);
+
+    if (train != NULL) {
+        DEBUG("6lo frag: interface %" PRIkernel_pid " did not take all "
+              "fragments (%d)\n", iface->pid, res);
+        (void)res;
+        while (train != NULL) {
+            gnrc_pktbuf_release(gnrc_pktqueue_remove_head(&train)->pkt);
+        }
+        return false;
+    }
+    return true;
+}
+
 void gnrc_sixlowpan_frag_send(gnrc_pktsnip_t *pkt, void *ctx, unsigned page)
 {
     assert(ctx != NULL);
     gnrc_sixlowpan_msg_frag_t *fragment_msg = ctx;
     gnrc_netif_t *iface = gnrc_netif_get_by_pid(fragment_msg->pid);
-    uint16_t res;
+    gnrc_pktqueue_t nodes[GNRC_SIXLOWPAN_FRAG_TRAIN_LEN];
+    gnrc_pktqueue_t *train = NULL;
+    uint16_t res = 1;
     /* payload_len: actual size of the packet vs
      * datagram_size: size of the uncompressed IPv6 packet */
     size_t payload_len = gnrc_pkt_len(fragment_msg->pkt->next);
@@ -259,51 +291,270 @@ void gnrc_sixlowpan_frag_send(gnrc_pktsnip_t *pkt, void *ctx, unsigned page)
     }
 #endif
 
-    /* Check whether to send the first or an Nth fragment */
     if (fragment_msg->offset == 0) {
         /* increment tag for successive, fragmented datagrams */
         _tag++;
-        if ((res = _send_1st_fragment(iface, fragment_msg->pkt, payload_len, fragment_msg->datagram_size)) == 0) {
-            /* error sending first fragment */
-            DEBUG("6lo frag: error sending 1st fragment\n");
-            gnrc_pktbuf_release(fragment_msg->pkt);
-            fragment_msg->pkt = NULL;
-            return;
+    }
+    /* build up to GNRC_SIXLOWPAN_FRAG_TRAIN_LEN fragments, so the interface
+     * can send them with a single message.
+     * (offset + (datagram_size - payload_len) < datagram_size) simplified */
+    for (unsigned i = 0; (i < GNRC_SIXLOWPAN_FRAG_TRAIN_LEN) &&
+                         (fragment_msg->offset < payload_len); i++) {
+        /* Check whether to build the first or an Nth fragment */
+        if (fragment_msg->offset == 0) {
+            res = _build_1st_fragment(iface, fragment_msg->pkt, payload_len,
+                                      fragment_msg->datagram_size,
+                                      &nodes[i].pkt);
+        }
+        else {
+            res = _build_nth_fragment(iface, fragment_msg->pkt, payload_len,
+                                      fragment_msg->datagram_size,
+                                      fragment_msg->offset, &nodes[i].pkt);
         }
+        if (res == 0) {
+            DEBUG("6lo frag: error building fragment (offset = %" PRIu16
+                  ")\n", fragment_msg->offset);
+            break;
+        }
+        nodes[i].next = NULL;
+        gnrc_pktqueue_add(&train, &nodes[i]);
         fragment_msg->offset += res;
-
-        /* send message to self*/
+    }
+    if (res == 0) {
+        /* the datagram can't be completed, so don't bother sending the
+         * fragments built so far */
+        while (train != NULL) {
+            gnrc_pktbuf_release(gnrc_pktqueue_remove_head(&train)->pkt);
+        }
+        gnrc_pktbuf_release(fragment_msg->pkt);
+        fragment_msg->pkt = NULL;
+        return;
+    }
+    if (!_send_train(iface, train)) {
+        /* the receiver can't reassemble the datagram with fragments missing,
+         * so don't bother sending the rest */
+        gnrc_pktbuf_release(fragment_msg->pkt);
+        fragment_msg->pkt = NULL;
+        return;
+    }
+    if (fragment_msg->offset < payload_len) {
+        /* send message to self to send the next train, so other messages
+         * can be handled in between */
         msg.type = GNRC_SIXLOWPAN_MSG_FRAG_SND;
         msg.content.ptr = (void *)fragment_msg;
         msg_send_to_self(&msg);
         thread_yield();
     }
     else {
-        /* (offset + (datagram_size - payload_len) < datagram_size) simplified */
-        if (fragment_msg->offset < payload_len) {
-            if ((res = _send_nth_fragment(iface, fragment_msg->pkt, payload_len, fragment_msg->datagram_size,
-                                          fragment_msg->offset)) == 0) {
-                /* error sending subsequent fragment */
-                DEBUG("6lo frag: error sending subsequent fragment (offset = %" PRIu16
-                      ")\n", fragment_msg->offset);
-                gnrc_pktbuf_release(fragment_msg->pkt);
-                fragment_msg->pkt = NULL;
-                return;
-                }
-            fragment_msg->offset += res;
+        gnrc_pktbuf_release(fragment_msg->pkt);
+        fragment_msg->pkt = NULL;
+    }
+}
+
+#ifdef MODULE_GNRC_SIXLOWPAN_FRAG_VRB
+/* forwards a subsequent fragment of a datagram in the virtual reassembly
+ * buffer to its next hop. Returns false if the datagram is not forwarded
+ * that way and the fragment needs to be reassembled instead */
+static bool _vrb_forward_nth(gnrc_netif_hdr_t *hdr, gnrc_pktsnip_t *pkt,
+                             uint16_t offset)
+{
+    sixlowpan_frag_n_t *frag = pkt->data;
+    gnrc_netif_hdr_t *new_hdr;
+    gnrc_pktsnip_t *netif;
+    vrb_t *vrb = vrb_get(gnrc_netif_hdr_get_src_addr(hdr), hdr->src_l2addr_len,
+                         byteorder_ntohs(frag->disp_size) & SIXLOWPAN_FRAG_SIZE_MASK,
+                         byteorder_ntohs(frag->tag));
+
+    if (vrb == NULL) {
+        return false;
+    }
+    if (offset == 0) {
+        /* the tag was reused for a new datagram, so it needs to be routed
+         * again */
+        DEBUG("6lo vrb: first fragment for existing entry, remove it\n");
+        vrb_rm(vrb);
+        return false;
+    }
+    switch (vrb_update_coverage(vrb, offset,
+                                pkt->size - sizeof(sixlowpan_frag_n_t))) {
+        case 0:
+            DEBUG("6lo vrb: fragment (offset: %u) forwarded before\n",
+                  (unsigned)offset);
+            gnrc_pktbuf_release(pkt);
+            return true;
+        case -1:
+            /* the datagram can't be reassembled at its destination anymore
+             * https://tools.ietf.org/html/rfc4944#section-5.3 */
+            DEBUG("6lo vrb: overlapping fragment, discard datagram\n");
+            vrb_rm(vrb);
+            gnrc_pktbuf_release(pkt);
+            return true;
+        default:
+            break;
+    }
+    vrb->arrival = xtimer_now_usec();
+    netif = gnrc_netif_hdr_build(NULL, 0, vrb->out_dst, vrb->out_dst_len);
+    if (netif == NULL) {
+        DEBUG("6lo vrb: error allocating link-layer header\n");
+        gnrc_pktbuf_release(pkt);
+        return true;
+    }
+    new_hdr = netif->data;
+    new_hdr->if_pid = vrb->out_pid;
+    frag->tag = byteorder_htons(vrb->out_tag);
+    if (vrb->fwd_size < vrb->datagram_size) {
+        /* Tell the link layer that we will send more fragments */
+        new_hdr->flags |= GNRC_NETIF_HDR_FLAGS_MORE_DATA;
+    }
+    else {
+        DEBUG("6lo vrb: forwarded datagram completely, remove entry\n");
+        vrb_rm(vrb);
+    }
+    DEBUG("6lo vrb: forward fragment (offset: %u, tag: %u => %u)\n",
+          (unsigned)offset, vrb->tag, vrb->out_tag);
+    /* exchange link-layer header of the received fragment */
+    pkt = gnrc_pktbuf_remove_snip(pkt, pkt->next);
+    netif->next = pkt;
+    gnrc_sixlowpan_dispatch_send(netif, NULL, 0);
+    return true;
+}
+
+/* checks if the IPv6 header is directly followed by an upper-layer header.
+ * Extension headers (e.g. hop-by-hop options) may need to be processed by
+ * the router, which needs the reassembled datagram */
+static bool _is_upper_layer(uint8_t nh)
+{
+    switch (nh) {
+        case PROTNUM_ICMPV6:
+        case PROTNUM_TCP:
+        case PROTNUM_UDP:
+            return true;
+        default:
+            return false;
+    }
+}
+
+/* routes a datagram by its first fragment in rbuf and forwards that fragment
+ * to the next hop right away. Returns false if the datagram needs to be
+ * reassembled instead */
+static bool _vrb_forward_1st(gnrc_sixlowpan_rbuf_t *rbuf)
+{
+    rbuf_t *entry = (rbuf_t *)rbuf;
+    ipv6_hdr_t *ipv6_hdr = rbuf->pkt->data;
+    gnrc_ipv6_nib_nc_t nce;
+    gnrc_netif_t *out;
+    gnrc_pktsnip_t *netif, *ipv6, *payload, *frag;
+    gnrc_netif_hdr_t *new_hdr;
+    sixlowpan_frag_t *frag_hdr;
+
+    /* nothing but the first fragment may have arrived yet, so it is all that
+     * needs forwarding. It also must contain the first 8 byte of the IPv6
+     * payload, so a UDP header can be compressed */
+    if ((entry->frags != 1) || !bf_isset(entry->received, 0) ||
+        (rbuf->current_size < (sizeof(ipv6_hdr_t) + 8U))) {
+        return false;
+    }
+    /* leave local delivery, multicast, extension headers, and errors (e.g.
+     * hop limit exceeded) to IPv6 */
+    if (!ipv6_hdr_is(ipv6_hdr) || (ipv6_hdr->hl <= 1) ||
+        !_is_upper_layer(ipv6_hdr->nh) ||
+        ipv6_addr_is_multicast(&ipv6_hdr->dst) ||
+        ipv6_addr_is_link_local(&ipv6_hdr->src) ||
+        ipv6_addr_is_link_local(&ipv6_hdr->dst) ||
+        (gnrc_netif_get_by_ipv6_addr(&ipv6_hdr->dst) != NULL)) {
+        return false;
+    }
+    if ((gnrc_ipv6_nib_get_next_hop_l2addr(&ipv6_hdr->dst, NULL, NULL,
+                                           &nce) < 0) ||
+        (nce.l2addr_len > IEEE802154_LONG_ADDRESS_LEN)) {
+        DEBUG("6lo vrb: no next hop known, reassemble datagram\n");
+        return false;
+    }
+    out = gnrc_netif_get_by_pid(gnrc_ipv6_nib_nc_get_iface(&nce));
+    if ((out == NULL) || (out->sixlo.max_frag_size == 0)) {
+        DEBUG("6lo vrb: next hop not reachable via 6LoWPAN\n");
+        return false;
+    }
 
-            /* send message to self*/
-            msg.type = GNRC_SIXLOWPAN_MSG_FRAG_SND;
-            msg.content.ptr = (void *)fragment_msg;
-            msg_send_to_self(&msg);
-            thread_yield();
+    payload = gnrc_pktbuf_add(NULL, ((uint8_t *)rbuf->pkt->data) +
+                                    sizeof(ipv6_hdr_t),
+                              rbuf->current_size - sizeof(ipv6_hdr_t),
+                              GNRC_NETTYPE_UNDEF);
+    if (payload == NULL) {
+        DEBUG("6lo vrb: error allocating first fragment\n");
+        return false;
+    }
+    ipv6 = gnrc_pktbuf_add(payload, ipv6_hdr, sizeof(ipv6_hdr_t),
+                           GNRC_NETTYPE_IPV6);
+    if (ipv6 == NULL) {
+        DEBUG("6lo vrb: error allocating first fragment\n");
+        gnrc_pktbuf_release(payload);
+        return false;
+    }
+    ((ipv6_hdr_t *)ipv6->data)->hl--;
+    /* give IPHC the source address, so it does not need to ask the
+     * interface */
+    netif = gnrc_netif_hdr_build(out->l2addr, out->l2addr_len,
+                                 nce.l2addr, nce.l2addr_len);
+    if (netif == NULL) {
+        DEBUG("6lo vrb: error allocating link-layer header\n");
+        gnrc_pktbuf_release(ipv6);
+        return false;
+    }
+    new_hdr = netif->data;
+    new_hdr->if_pid = out->pid;
+    /* Tell the link layer that we will send more fragments */
+    new_hdr->flags = GNRC_NETIF_HDR_FLAGS_MORE_DATA;
+    netif->next = ipv6;
+    /* the first fragment can be compressed differently on the next link, but
+     * since the offsets of the subsequent fragments refer to the
+     * uncompressed datagram, they stay the same */
+#ifdef MODULE_GNRC_SIXLOWPAN_IPHC
+    if (out->flags & GNRC_NETIF_FLAGS_6LO_HC) {
+        if (!gnrc_sixlowpan_iphc_encode(netif)) {
+            DEBUG("6lo vrb: error compressing first fragment\n");
+            return false;
         }
-        else {
-            gnrc_pktbuf_release(fragment_msg->pkt);
-            fragment_msg->pkt = NULL;
+    }
+    else
+#endif
+    {
+        gnrc_pktsnip_t *disp = gnrc_pktbuf_add(ipv6, NULL, sizeof(uint8_t),
+                                               GNRC_NETTYPE_SIXLOWPAN);
+
+        if (disp == NULL) {
+            DEBUG("6lo vrb: error allocating dispatch\n");
+            gnrc_pktbuf_release(netif);
+            return false;
         }
+        *((uint8_t *)disp->data) = SIXLOWPAN_UNCOMP;
+        netif->next = disp;
+    }
+    frag = gnrc_pktbuf_add(netif->next, NULL, sizeof(sixlowpan_frag_t),
+                           GNRC_NETTYPE_SIXLOWPAN);
+    if (frag == NULL) {
+        DEBUG("6lo vrb: error allocating fragment header\n");
+        gnrc_pktbuf_release(netif);
+        return false;
+    }
+    netif->next = frag;
+    if (gnrc_pkt_len(frag) > out->sixlo.max_frag_size) {
+        DEBUG("6lo vrb: first fragment too big for next link\n");
+        gnrc_pktbuf_release(netif);
+        return false;
     }
+    _tag++;
+    frag_hdr = frag->data;
+    frag_hdr->disp_size = byteorder_htons((uint16_t)rbuf->pkt->size);
+    frag_hdr->disp_size.u8[0] |= SIXLOWPAN_FRAG_1_DISP;
+    frag_hdr->tag = byteorder_htons(_tag);
+    vrb_add(rbuf, out->pid, nce.l2addr, nce.l2addr_len, _tag);
+    DEBUG("6lo vrb: forward first fragment (tag: %u => %u)\n", rbuf->tag,
+          _tag);
+    gnrc_sixlowpan_dispatch_send(netif, NULL, 0);
+    return true;
 }
+#endif  /* MODULE_GNRC_SIXLOWPAN_FRAG_VRB */
 
 void gnrc_sixlowpan_frag_recv(gnrc_pktsnip_t *pkt, void *ctx, unsigned page)
 {
@@ -327,12 +578,25 @@ void gnrc_sixlowpan_frag_recv(gnrc_pktsnip_t *pkt, void *ctx, unsigned page)
             return;
     }
 
+#ifdef MODULE_GNRC_SIXLOWPAN_FRAG_VRB
+    if (_vrb_forward_nth(hdr, pkt, offset)) {
+        return;
+    }
+#endif
     rbuf_add(hdr, pkt, offset, page);
 }
 
+void gnrc_sixlowpan_frag_rbuf_set_gc_pid(kernel_pid_t pid)
+{
+    rbuf_set_gc_pid(pid);
+}
+
 void gnrc_sixlowpan_frag_rbuf_gc(void)
 {
     rbuf_gc();
+#ifdef MODULE_GNRC_SIXLOWPAN_FRAG_VRB
+    vrb_gc();
+#endif
 }
 
 void gnrc_sixlowpan_frag_rbuf_remove(gnrc_sixlowpan_rbuf_t *rbuf)
@@ -372,6 +636,13 @@ void gnrc_sixlowpan_frag_rbuf_dispatch_when_complete(gnrc_sixlowpan_rbuf_t *rbuf
         gnrc_sixlowpan_dispatch_recv(rbuf->pkt, NULL, 0);
         gnrc_sixlowpan_frag_rbuf_remove(rbuf);
     }
+#ifdef MODULE_GNRC_SIXLOWPAN_FRAG_VRB
+    else if (_vrb_forward_1st(rbuf)) {
+        /* the remaining fragments are forwarded without reassembly */
+        gnrc_pktbuf_release(rbuf->pkt);
+        gnrc_sixlowpan_frag_rbuf_remove(rbuf);
+    }
+#endif
 }
 
 /** @} */
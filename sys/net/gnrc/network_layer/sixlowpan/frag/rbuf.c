@@ -12,8 +12,10 @@
  * @file
  */
 
+#include <assert.h>
 #include <inttypes.h>
 #include <stdbool.h>
+#include <string.h>
 
 #include "rbuf.h"
 #include "net/ipv6.h"
@@ -24,42 +26,37 @@
 #include "net/sixlowpan.h"
 #include "thread.h"
 #include "xtimer.h"
-#include "utlist.h"
 
 #define ENABLE_DEBUG    (0)
 #include "debug.h"
 
-/* estimated fragment payload size to determinate RBUF_INT_SIZE, default to
- * MAC payload size - fragment header. */
-#ifndef GNRC_SIXLOWPAN_FRAG_SIZE
-/* assuming 64-bit source/destination address, source PAN ID omitted */
-#define GNRC_SIXLOWPAN_FRAG_SIZE (104 - 5)
-#endif
-
-#ifndef RBUF_INT_SIZE
-/* same as ((int) ceil((double) N / D)) */
-#define DIV_CEIL(N, D) (((N) + (D) - 1) / (D))
-#define RBUF_INT_SIZE (DIV_CEIL(IPV6_MIN_MTU, GNRC_SIXLOWPAN_FRAG_SIZE) * RBUF_SIZE)
-#endif
-
-static rbuf_int_t rbuf_int[RBUF_INT_SIZE];
-
 static rbuf_t rbuf[RBUF_SIZE];
 
+/* index + 1 of the first entry in each hash bucket, 0 for none */
+static uint8_t _rbuf_buckets[RBUF_HASH_SIZE];
+/* index + 1 of the first entry in the list of unused entries, 0 for none */
+static uint8_t _rbuf_free;
+/* entries starting at this index were never used, so they are in no list */
+static uint8_t _rbuf_fresh;
+
 static char l2addr_str[3 * IEEE802154_LONG_ADDRESS_LEN];
 
 static xtimer_t _gc_timer;
 static msg_t _gc_timer_msg = { .type = GNRC_SIXLOWPAN_MSG_FRAG_GC_RBUF };
+static uint32_t _gc_deadline;
+static bool _gc_pending;
+static kernel_pid_t _gc_pid = KERNEL_PID_UNDEF;
 
 /* ------------------------------------
  * internal function definitions
  * ------------------------------------*/
-/* checks whether start and end overlaps, but not identical to, given interval i */
-static inline bool _rbuf_int_overlap_partially(rbuf_int_t *i, uint16_t start, uint16_t end);
-/* gets a free entry from interval buffer */
-static rbuf_int_t *_rbuf_int_get_free(void);
-/* update interval buffer of entry */
-static bool _rbuf_update_ints(rbuf_t *entry, uint16_t offset, size_t frag_size);
+/* checks if a fragment covering exactly the units [start, end) was received
+ * before, given that all of them were */
+static bool _rbuf_was_received(rbuf_t *entry, unsigned start,
+                               unsigned end);
+/* marks the units of the datagram covered by a fragment as received */
+static int _rbuf_update_coverage(rbuf_t *entry, uint16_t offset,
+                                 size_t frag_size);
 /* gets an entry identified by its tupel */
 static rbuf_t *_rbuf_get(const void *src, size_t src_len,
                          const void *dst, size_t dst_len,
@@ -70,11 +67,10 @@ void rbuf_add(gnrc_netif_hdr_t *netif_hdr, gnrc_pktsnip_t *pkt,
 {
     rbuf_t *entry;
     sixlowpan_frag_t *frag = pkt->data;
-    rbuf_int_t *ptr;
     uint8_t *data = ((uint8_t *)pkt->data) + sizeof(sixlowpan_frag_t);
     size_t frag_size;
+    int res;
 
-    rbuf_gc();
     entry = _rbuf_get(gnrc_netif_hdr_get_src_addr(netif_hdr), netif_hdr->src_l2addr_len,
                       gnrc_netif_hdr_get_dst_addr(netif_hdr), netif_hdr->dst_l2addr_len,
                       byteorder_ntohs(frag->disp_size) & SIXLOWPAN_FRAG_SIZE_MASK,
@@ -82,11 +78,10 @@ void rbuf_add(gnrc_netif_hdr_t *netif_hdr, gnrc_pktsnip_t *pkt,
 
     if (entry == NULL) {
         DEBUG("6lo rbuf: reassembly buffer full.\n");
+        gnrc_pktbuf_release(pkt);
         return;
     }
 
-    ptr = entry->ints;
-
     /* dispatches in the first fragment are ignored */
     if (offset == 0) {
         frag_size = pkt->size - sizeof(sixlowpan_frag_t);
@@ -103,32 +98,31 @@ void rbuf_add(gnrc_netif_hdr_t *netif_hdr, gnrc_pktsnip_t *pkt,
         DEBUG("6lo rfrag: fragment too big for resulting datagram, discarding datagram\n");
         gnrc_pktbuf_release(entry->super.pkt);
         rbuf_rm(entry);
+        gnrc_pktbuf_release(pkt);
         return;
     }
 
+    res = _rbuf_update_coverage(entry, offset, frag_size);
     /* If the fragment overlaps another fragment and differs in either the size
      * or the offset of the overlapped fragment, discards the datagram
      * https://tools.ietf.org/html/rfc4944#section-5.3 */
-    while (ptr != NULL) {
-        if (_rbuf_int_overlap_partially(ptr, offset, offset + frag_size - 1)) {
-            DEBUG("6lo rfrag: overlapping intervals, discarding datagram\n");
-            gnrc_pktbuf_release(entry->super.pkt);
-            rbuf_rm(entry);
-
-            /* "A fresh reassembly may be commenced with the most recently
-             * received link fragment"
-             * https://tools.ietf.org/html/rfc4944#section-5.3 */
-            rbuf_add(netif_hdr, pkt, offset, page);
-
-            return;
-        }
+    if (res < 0) {
+        DEBUG("6lo rfrag: overlapping fragments, discarding datagram\n");
+        gnrc_pktbuf_release(entry->super.pkt);
+        rbuf_rm(entry);
+
+        /* "A fresh reassembly may be commenced with the most recently
+         * received link fragment"
+         * https://tools.ietf.org/html/rfc4944#section-5.3 */
+        rbuf_add(netif_hdr, pkt, offset, page);
 
-        ptr = ptr->next;
+        return;
     }
 
-    if (_rbuf_update_ints(entry, offset, frag_size)) {
+    if (res > 0) {
         DEBUG("6lo rbuf: add fragment data\n");
         entry->super.current_size += (uint16_t)frag_size;
+        entry->frags++;
         if (offset == 0) {
 #ifdef MODULE_GNRC_SIXLOWPAN_IPHC
             if (sixlowpan_iphc_is(data)) {
@@ -137,8 +131,10 @@ void rbuf_add(gnrc_netif_hdr_t *netif_hdr, gnrc_pktsnip_t *pkt,
                 if (frag_hdr == NULL) {
                     gnrc_pktbuf_release(entry->super.pkt);
                     rbuf_rm(entry);
+                    gnrc_pktbuf_release(pkt);
                     return;
                 }
+                /* decompresses the header right into the datagram */
                 gnrc_sixlowpan_iphc_recv(pkt, &entry->super, 0);
                 return;
             }
@@ -148,6 +144,8 @@ void rbuf_add(gnrc_netif_hdr_t *netif_hdr, gnrc_pktsnip_t *pkt,
                 data++;
             }
         }
+        /* the fragment's data goes straight to its final position in the
+         * datagram */
         memcpy(((uint8_t *)entry->super.pkt->data) + offset, data,
                frag_size);
     }
@@ -155,76 +153,114 @@ void rbuf_add(gnrc_netif_hdr_t *netif_hdr, gnrc_pktsnip_t *pkt,
     gnrc_pktbuf_release(pkt);
 }
 
-static inline bool _rbuf_int_overlap_partially(rbuf_int_t *i, uint16_t start, uint16_t end)
+static int _rbuf_update_coverage(rbuf_t *entry, uint16_t offset,
+                                 size_t frag_size)
 {
-    /* start and ends are both inclusive, so using <= for both */
-    return ((i->start <= end) && (start <= i->end)) && /* overlaps */
-        ((start != i->start) || (end != i->end)); /* not identical */
+    /* offsets are a multiple of 8, only the last unit of the last fragment
+     * may be covered partially */
+    unsigned start = offset / 8U;
+    unsigned end = (offset + frag_size + 7U) / 8U;
+    unsigned received = 0;
+
+    for (unsigned i = start; i < end; i++) {
+        if (bf_isset(entry->received, i)) {
+            received++;
+        }
+    }
+    /* a fragment that only covers units received before is a duplicate,
+     * unless it differs in offset or size from the ones received */
+    if ((received == (end - start)) && _rbuf_was_received(entry, start, end)) {
+        DEBUG("6lo rfrag: fragment (%u, %u) received before\n", start, end);
+        return 0;
+    }
+    if (received > 0) {
+        return -1;
+    }
+    for (unsigned i = start; i < end; i++) {
+        bf_set(entry->received, i);
+    }
+    bf_set(entry->starts, start);
+
+    DEBUG("6lo rfrag: add units [%u, %u) to entry (%s, ", start, end,
+          gnrc_netif_addr_to_str(entry->super.src, entry->super.src_len,
+                                 l2addr_str));
+    DEBUG("%s, %u, %u)\n", gnrc_netif_addr_to_str(entry->super.dst,
+                                                  entry->super.dst_len,
+                                                  l2addr_str),
+          (unsigned)entry->super.pkt->size, entry->super.tag);
+    return 1;
 }
 
-static rbuf_int_t *_rbuf_int_get_free(void)
+static bool _rbuf_was_received(rbuf_t *entry, unsigned start,
+                               unsigned end)
 {
-    for (unsigned int i = 0; i < RBUF_INT_SIZE; i++) {
-        if (rbuf_int[i].end == 0) { /* start must be smaller than end anyways*/
-            return rbuf_int + i;
+    /* received fragments don't overlap, so the one starting at start covers
+     * [start, end) if no other one starts in between, and it ends at end if
+     * the unit there was not received or belongs to another fragment */
+    if (!bf_isset(entry->starts, start)) {
+        return false;
+    }
+    for (unsigned i = start + 1; i < end; i++) {
+        if (bf_isset(entry->starts, i)) {
+            return false;
         }
     }
-
-    return NULL;
+    return (end >= RBUF_UNITS) || !bf_isset(entry->received, end) ||
+           bf_isset(entry->starts, end);
 }
 
-void rbuf_rm(rbuf_t *entry)
+uint32_t rbuf_hash(const uint8_t *src, size_t src_len, uint16_t tag)
 {
-    while (entry->ints != NULL) {
-        rbuf_int_t *next = entry->ints->next;
+    uint32_t hash = 2166136261U;
 
-        entry->ints->start = 0;
-        entry->ints->end = 0;
-        entry->ints->next = NULL;
-        entry->ints = next;
+    for (unsigned i = 0; i < src_len; i++) {
+        hash = (hash ^ src[i]) * 16777619U;
     }
-
-    entry->super.pkt = NULL;
+    hash = (hash ^ (tag >> 8)) * 16777619U;
+    hash = (hash ^ (tag & 0xff)) * 16777619U;
+    return hash;
 }
 
-static bool _rbuf_update_ints(rbuf_t *entry, uint16_t offset, size_t frag_size)
+/* returns the hash bucket of a datagram */
+static uint8_t *_rbuf_bucket(const uint8_t *src, size_t src_len, uint16_t tag)
 {
-    rbuf_int_t *new;
-    uint16_t end = (uint16_t)(offset + frag_size - 1);
+    return &_rbuf_buckets[rbuf_hash(src, src_len, tag) % RBUF_HASH_SIZE];
+}
 
-    new = _rbuf_int_get_free();
+void rbuf_rm(rbuf_t *entry)
+{
+    uint8_t idx = (uint8_t)(entry - rbuf) + 1;
+    uint8_t *ptr;
 
-    if (new == NULL) {
-        DEBUG("6lo rfrag: no space left in rbuf interval buffer.\n");
-        return false;
+    if (entry->super.pkt == NULL) {
+        /* already removed */
+        return;
     }
-
-    new->start = offset;
-    new->end = end;
-
-    DEBUG("6lo rfrag: add interval (%" PRIu16 ", %" PRIu16 ") to entry (%s, ",
-          new->start, new->end, gnrc_netif_addr_to_str(entry->super.src,
-                                                       entry->super.src_len,
-                                                       l2addr_str));
-    DEBUG("%s, %u, %u)\n", gnrc_netif_addr_to_str(entry->super.dst,
-                                                  entry->super.dst_len,
-                                                  l2addr_str),
-          (unsigned)entry->super.pkt->size, entry->super.tag);
-
-    LL_PREPEND(entry->ints, new);
-
-    return true;
+    ptr = _rbuf_bucket(entry->super.src, entry->super.src_len,
+                       entry->super.tag);
+    while ((*ptr != 0) && (*ptr != idx)) {
+        ptr = &rbuf[*ptr - 1].next;
+    }
+    if (*ptr == idx) {
+        *ptr = entry->next;
+    }
+    entry->next = _rbuf_free;
+    _rbuf_free = idx;
+    entry->super.pkt = NULL;
 }
 
 void rbuf_gc(void)
 {
     uint32_t now_usec = xtimer_now_usec();
+    bool active = false;
     unsigned int i;
 
-    for (i = 0; i < RBUF_SIZE; i++) {
-        /* since pkt occupies pktbuf, aggressivly collect garbage */
-        if ((rbuf[i].super.pkt != NULL) &&
-              ((now_usec - rbuf[i].arrival) > RBUF_TIMEOUT)) {
+    _gc_pending = false;
+    for (i = 0; i < _rbuf_fresh; i++) {
+        if (rbuf[i].super.pkt == NULL) {
+            continue;
+        }
+        if ((now_usec - rbuf[i].arrival) > RBUF_TIMEOUT) {
             DEBUG("6lo rfrag: entry (%s, ",
                   gnrc_netif_addr_to_str(rbuf[i].super.src,
                                          rbuf[i].super.src_len,
@@ -238,66 +274,102 @@ void rbuf_gc(void)
             gnrc_pktbuf_release(rbuf[i].super.pkt);
             rbuf_rm(&(rbuf[i]));
         }
+        else {
+            active = true;
+        }
+    }
+    if (active) {
+        rbuf_set_gc_timeout();
     }
 }
 
-static inline void _set_rbuf_timeout(void)
+void rbuf_set_gc_pid(kernel_pid_t pid)
 {
-    xtimer_set_msg(&_gc_timer, RBUF_TIMEOUT, &_gc_timer_msg, sched_active_pid);
+    _gc_pid = pid;
 }
 
-static rbuf_t *_rbuf_get(const void *src, size_t src_len,
-                         const void *dst, size_t dst_len,
-                         size_t size, uint16_t tag, unsigned page)
+void rbuf_set_gc_timeout(void)
 {
-    rbuf_t *res = NULL, *oldest = NULL;
-    uint32_t now_usec = xtimer_now_usec();
+    uint32_t now_usec;
 
-    for (unsigned int i = 0; i < RBUF_SIZE; i++) {
-        /* check first if entry already available */
-        if ((rbuf[i].super.pkt != NULL) && (rbuf[i].super.pkt->size == size) &&
-            (rbuf[i].super.tag == tag) && (rbuf[i].super.src_len == src_len) &&
-            (rbuf[i].super.dst_len == dst_len) &&
-            (memcmp(rbuf[i].super.src, src, src_len) == 0) &&
-            (memcmp(rbuf[i].super.dst, dst, dst_len) == 0)) {
-            DEBUG("6lo rfrag: entry %p (%s, ", (void *)(&rbuf[i]),
-                  gnrc_netif_addr_to_str(rbuf[i].super.src,
-                                         rbuf[i].super.src_len,
-                                         l2addr_str));
-            DEBUG("%s, %u, %u) found\n",
-                  gnrc_netif_addr_to_str(rbuf[i].super.dst,
-                                         rbuf[i].super.dst_len,
-                                         l2addr_str),
-                  (unsigned)rbuf[i].super.pkt->size, rbuf[i].super.tag);
-            rbuf[i].arrival = now_usec;
-            _set_rbuf_timeout();
-            return &(rbuf[i]);
-        }
+    if (_gc_pid == KERNEL_PID_UNDEF) {
+        return;
+    }
+    now_usec = xtimer_now_usec();
 
-        /* if there is a free spot: remember it */
-        if ((res == NULL) && (rbuf[i].super.pkt == NULL)) {
-            res = &(rbuf[i]);
-        }
+    /* a pending collection suffices, unless it is overdue (e.g. because its
+     * message was lost) */
+    if (_gc_pending && ((now_usec - _gc_deadline) > (UINT32_MAX / 2))) {
+        return;
+    }
+    _gc_pending = true;
+    _gc_deadline = now_usec + RBUF_TIMEOUT;
+    /* with gnrc_netapi_rtc this may run in the interface's thread, so
+     * address the collecting thread explicitly */
+    xtimer_set_msg(&_gc_timer, RBUF_TIMEOUT, &_gc_timer_msg, _gc_pid);
+}
 
-        /* remember oldest slot */
+/* gets an unused entry, replacing the oldest one if there is none */
+static rbuf_t *_rbuf_alloc(void)
+{
+    rbuf_t *res, *oldest = NULL;
+
+    if (_rbuf_free != 0) {
+        res = &rbuf[_rbuf_free - 1];
+        _rbuf_free = res->next;
+        return res;
+    }
+    if (_rbuf_fresh < RBUF_SIZE) {
+        return &rbuf[_rbuf_fresh++];
+    }
+    for (unsigned int i = 0; i < RBUF_SIZE; i++) {
         /* note that xtimer_now will overflow in ~1.2 hours */
         if ((oldest == NULL) || (oldest->arrival - rbuf[i].arrival < UINT32_MAX / 2)) {
             oldest = &(rbuf[i]);
         }
     }
+    assert(oldest != NULL);
+    /* if there were an unused entry, it would be in the list */
+    assert(oldest->super.pkt != NULL);
+    DEBUG("6lo rfrag: reassembly buffer full, remove oldest entry\n");
+    gnrc_pktbuf_release(oldest->super.pkt);
+    rbuf_rm(oldest);
+    /* oldest is now the head of the list of unused entries */
+    _rbuf_free = oldest->next;
+    return oldest;
+}
 
-    /* entry not in buffer and no empty spot found */
-    if (res == NULL) {
-        assert(oldest != NULL);
-        /* if oldest->pkt == NULL, res must not be NULL */
-        assert(oldest->super.pkt != NULL);
-        DEBUG("6lo rfrag: reassembly buffer full, remove oldest entry\n");
-        gnrc_pktbuf_release(oldest->super.pkt);
-        rbuf_rm(oldest);
-        res = oldest;
+static rbuf_t *_rbuf_get(const void *src, size_t src_len,
+                         const void *dst, size_t dst_len,
+                         size_t size, uint16_t tag, unsigned page)
+{
+    rbuf_t *res;
+    uint8_t *bucket = _rbuf_bucket(src, src_len, tag);
+    uint32_t now_usec = xtimer_now_usec();
+
+    /* check first if entry already available */
+    for (uint8_t i = *bucket; i != 0; i = rbuf[i - 1].next) {
+        res = &rbuf[i - 1];
+        if ((res->super.pkt->size == size) &&
+            (res->super.tag == tag) && (res->super.src_len == src_len) &&
+            (res->super.dst_len == dst_len) &&
+            (memcmp(res->super.src, src, src_len) == 0) &&
+            (memcmp(res->super.dst, dst, dst_len) == 0)) {
+            DEBUG("6lo rfrag: entry %p (%s, ", (void *)res,
+                  gnrc_netif_addr_to_str(res->super.src,
+                                         res->super.src_len,
+                                         l2addr_str));
+            DEBUG("%s, %u, %u) found\n",
+                  gnrc_netif_addr_to_str(res->super.dst,
+                                         res->super.dst_len,
+                                         l2addr_str),
+                  (unsigned)res->super.pkt->size, res->super.tag);
+            res->arrival = now_usec;
+            return res;
+        }
     }
 
-    /* now we have an empty spot */
+    res = _rbuf_alloc();
 
     gnrc_nettype_t reass_type;
     switch (page) {
@@ -313,6 +385,8 @@ static rbuf_t *_rbuf_get(const void *src, size_t src_len,
     res->super.pkt = gnrc_pktbuf_add(NULL, NULL, size, reass_type);
     if (res->super.pkt == NULL) {
         DEBUG("6lo rfrag: can not allocate reassembly buffer space.\n");
+        res->next = _rbuf_free;
+        _rbuf_free = (uint8_t)(res - rbuf) + 1;
         return NULL;
     }
 
@@ -325,6 +399,11 @@ static rbuf_t *_rbuf_get(const void *src, size_t src_len,
     res->super.dst_len = dst_len;
     res->super.tag = tag;
     res->super.current_size = 0;
+    memset(res->received, 0, sizeof(res->received));
+    memset(res->starts, 0, sizeof(res->starts));
+    res->frags = 0;
+    res->next = *bucket;
+    *bucket = (uint8_t)(res - rbuf) + 1;
 
     DEBUG("6lo rfrag: entry %p (%s, ", (void *)res,
           gnrc_netif_addr_to_str(res->super.src, res->super.src_len,
@@ -334,7 +413,7 @@ static rbuf_t *_rbuf_get(const void *src, size_t src_len,
                                  l2addr_str), (unsigned)res->super.pkt->size,
           res->super.tag);
 
-    _set_rbuf_timeout();
+    rbuf_set_gc_timeout();
 
     return res;
 }
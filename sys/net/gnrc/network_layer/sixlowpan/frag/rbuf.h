@@ -21,8 +21,10 @@
 
 #include <inttypes.h>
 
+#include "bitfield.h"
 #include "net/gnrc/netif/hdr.h"
 #include "net/gnrc/pkt.h"
+#include "net/sixlowpan.h"
 
 #include "net/gnrc/sixlowpan/frag.h"
 #ifdef __cplusplus
@@ -30,41 +32,55 @@
 extern "C" {
 #endif
 
+#ifndef RBUF_SIZE
 #define RBUF_SIZE           (4U)               /**< size of the reassembly buffer */
+#endif
+#ifndef RBUF_HASH_SIZE
+#define RBUF_HASH_SIZE      (RBUF_SIZE)        /**< number of hash buckets of the
+                                                *   reassembly buffer */
+#endif
 #define RBUF_TIMEOUT        (3U * US_PER_SEC) /**< timeout for reassembly in microseconds */
 
 /**
- * @brief   Fragment intervals to identify limits of fragments.
- *
- * @note    Fragments MUST NOT overlap and overlapping fragments are to be
- *          discarded
+ * @brief   Number of 8-byte units in the largest datagram
  *
- * @see <a href="https://tools.ietf.org/html/rfc4944#section-5.3">
- *          RFC 4944, section 5.3
- *      </a>
- *
- * @internal
+ * Fragment offsets are a multiple of 8 byte, so a datagram's coverage is
+ * tracked in units of that size.
  */
-typedef struct rbuf_int {
-    struct rbuf_int *next;  /**< next element in interval list */
-    uint16_t start;         /**< start byte of interval */
-    uint16_t end;           /**< end byte of interval */
-} rbuf_int_t;
+#define RBUF_UNITS          ((SIXLOWPAN_FRAG_MAX_LEN + 7U) / 8U)
+
+#if RBUF_SIZE > UINT8_MAX
+#error "RBUF_SIZE must not be larger than 255"
+#endif
 
 /**
  * @brief   Internal representation of the 6LoWPAN reassembly buffer.
  *
  * Additional members help with correct reassembly of the buffer.
  *
+ * @note    Fragments MUST NOT overlap and overlapping fragments are to be
+ *          discarded
+ *
+ * @see <a href="https://tools.ietf.org/html/rfc4944#section-5.3">
+ *          RFC 4944, section 5.3
+ *      </a>
+ *
  * @internal
  *
  * @extends gnrc_sixlowpan_rbuf_t
  */
 typedef struct {
     gnrc_sixlowpan_rbuf_t super;        /**< exposed part of the reassembly buffer */
-    rbuf_int_t *ints;                   /**< intervals of the fragment */
+    BITFIELD(received, RBUF_UNITS);     /**< 8-byte units of the datagram that
+                                         *   were received */
+    BITFIELD(starts, RBUF_UNITS);       /**< 8-byte units of the datagram a
+                                         *   received fragment starts at */
     uint32_t arrival;                   /**< time in microseconds of arrival of
                                          *   last received fragment */
+    uint16_t frags;                     /**< number of fragments received */
+    uint8_t next;                       /**< index + 1 of the next entry in the
+                                         *   same hash bucket or in the list of
+                                         *   unused entries, 0 for none */
 } rbuf_t;
 
 /**
@@ -86,9 +102,52 @@ void rbuf_add(gnrc_netif_hdr_t *netif_hdr, gnrc_pktsnip_t *frag,
 
 /**
  * @brief   Checks timeouts and removes entries if necessary
+ *
+ * Called when the @ref GNRC_SIXLOWPAN_MSG_FRAG_GC_RBUF timer fires, which is
+ * kept running as long as there are entries in the reassembly buffer.
  */
 void rbuf_gc(void);
 
+/**
+ * @brief   Sets the thread the @ref GNRC_SIXLOWPAN_MSG_FRAG_GC_RBUF timer
+ *          is sent to
+ *
+ * @param[in] pid   PID of the thread that calls rbuf_gc()
+ */
+void rbuf_set_gc_pid(kernel_pid_t pid);
+
+/**
+ * @brief   Schedules the @ref GNRC_SIXLOWPAN_MSG_FRAG_GC_RBUF timer, unless
+ *          it already is
+ *
+ * Buffers with entries that need to time out, other than the reassembly
+ * buffer itself, call this when they add an entry or still have some after
+ * their garbage collection. Does nothing before rbuf_set_gc_pid() was
+ * called.
+ */
+void rbuf_set_gc_timeout(void);
+
+/**
+ * @brief   Hashes the source address and tag of a datagram (FNV-1a)
+ *
+ * The datagram size is left out, so the hash of an entry can still be
+ * found after rbuf_t::super::pkt was released.
+ *
+ * @param[in] src       Link-layer source address of the datagram.
+ * @param[in] src_len   Length of @p src.
+ * @param[in] tag       Tag of the datagram.
+ *
+ * @return  The hash of the datagram, to be reduced to a bucket index.
+ */
+uint32_t rbuf_hash(const uint8_t *src, size_t src_len, uint16_t tag);
+
+/**
+ * @brief   Removes an entry from the reassembly buffer
+ *
+ * @note    Does not release rbuf_t::super::pkt.
+ *
+ * @param[in] rbuf  An entry of the reassembly buffer.
+ */
 void rbuf_rm(rbuf_t *rbuf);
 
 #ifdef __cplusplus
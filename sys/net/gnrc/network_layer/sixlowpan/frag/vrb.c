@@ -0,0 +1,174 @@
+/*
+ * Copyright (C) 2026 agent <agent@local>
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @{
+ *
+ * @file
+ * @author  agent <agent@local>
+ */
+
+#ifdef MODULE_GNRC_SIXLOWPAN_FRAG_VRB
+
+#include <assert.h>
+#include <stdbool.h>
+#include <string.h>
+
+#include "xtimer.h"
+
+#include "vrb.h"
+
+#define ENABLE_DEBUG    (0)
+#include "debug.h"
+
+static vrb_t _vrb[GNRC_SIXLOWPAN_FRAG_VRB_SIZE];
+/* index + 1 of the first entry in each hash bucket, 0 for none */
+static uint8_t _vrb_buckets[GNRC_SIXLOWPAN_FRAG_VRB_HASH_SIZE];
+
+/* returns the hash bucket of a datagram */
+static uint8_t *_vrb_bucket(const uint8_t *src, size_t src_len, uint16_t tag)
+{
+    return &_vrb_buckets[rbuf_hash(src, src_len, tag) %
+                         GNRC_SIXLOWPAN_FRAG_VRB_HASH_SIZE];
+}
+
+vrb_t *vrb_add(const gnrc_sixlowpan_rbuf_t *rbuf, kernel_pid_t out_pid,
+               const uint8_t *out_dst, size_t out_dst_len, uint16_t out_tag)
+{
+    vrb_t *res = NULL;
+    uint8_t *bucket;
+    uint32_t now_usec = xtimer_now_usec();
+
+    assert(out_dst_len <= sizeof(res->out_dst));
+    for (unsigned i = 0; i < GNRC_SIXLOWPAN_FRAG_VRB_SIZE; i++) {
+        if (_vrb[i].datagram_size == 0) {
+            res = &_vrb[i];
+            break;
+        }
+        /* remember least recently used entry */
+        /* note that xtimer_now will overflow in ~1.2 hours */
+        if ((res == NULL) || (res->arrival - _vrb[i].arrival < UINT32_MAX / 2)) {
+            res = &_vrb[i];
+        }
+    }
+    DEBUG("6lo vrb: %s entry %p for datagram tag %u\n",
+          (res->datagram_size == 0) ? "use" : "buffer full, replace",
+          (void *)res, rbuf->tag);
+    vrb_rm(res);
+    memcpy(res->src, rbuf->src, rbuf->src_len);
+    memcpy(res->out_dst, out_dst, out_dst_len);
+    res->arrival = now_usec;
+    res->datagram_size = (uint16_t)rbuf->pkt->size;
+    res->tag = rbuf->tag;
+    res->out_tag = out_tag;
+    /* only the first fragment was received */
+    memcpy(res->forwarded, ((const rbuf_t *)rbuf)->received,
+           sizeof(res->forwarded));
+    res->fwd_size = rbuf->current_size;
+    res->out_pid = out_pid;
+    res->src_len = rbuf->src_len;
+    res->out_dst_len = (uint8_t)out_dst_len;
+    bucket = _vrb_bucket(res->src, res->src_len, res->tag);
+    res->next = *bucket;
+    *bucket = (uint8_t)(res - _vrb) + 1;
+    /* the entry needs to time out, even if the reassembly buffer is empty */
+    rbuf_set_gc_timeout();
+    return res;
+}
+
+vrb_t *vrb_get(const uint8_t *src, size_t src_len, size_t size, uint16_t tag)
+{
+    for (uint8_t i = *_vrb_bucket(src, src_len, tag); i != 0;
+         i = _vrb[i - 1].next) {
+        vrb_t *entry = &_vrb[i - 1];
+
+        if ((entry->datagram_size == size) && (entry->tag == tag) &&
+            (entry->src_len == src_len) &&
+            (memcmp(entry->src, src, src_len) == 0)) {
+            return entry;
+        }
+    }
+    return NULL;
+}
+
+void vrb_rm(vrb_t *entry)
+{
+    uint8_t idx = (uint8_t)(entry - _vrb) + 1;
+    uint8_t *ptr;
+
+    if (entry->datagram_size == 0) {
+        /* already removed */
+        return;
+    }
+    ptr = _vrb_bucket(entry->src, entry->src_len, entry->tag);
+    while ((*ptr != 0) && (*ptr != idx)) {
+        ptr = &_vrb[*ptr - 1].next;
+    }
+    if (*ptr == idx) {
+        *ptr = entry->next;
+    }
+    entry->datagram_size = 0;
+}
+
+int vrb_update_coverage(vrb_t *entry, uint16_t offset, size_t frag_size)
+{
+    /* offsets are a multiple of 8, only the last unit of the last fragment
+     * may be covered partially */
+    unsigned start = offset / 8U;
+    unsigned end = (offset + frag_size + 7U) / 8U;
+    unsigned forwarded = 0;
+
+    if ((offset + frag_size) > entry->datagram_size) {
+        return -1;
+    }
+    for (unsigned i = start; i < end; i++) {
+        if (bf_isset(entry->forwarded, i)) {
+            forwarded++;
+        }
+    }
+    if (forwarded == (end - start)) {
+        return 0;
+    }
+    if (forwarded > 0) {
+        return -1;
+    }
+    for (unsigned i = start; i < end; i++) {
+        bf_set(entry->forwarded, i);
+    }
+    entry->fwd_size += (uint16_t)frag_size;
+    return 1;
+}
+
+void vrb_gc(void)
+{
+    uint32_t now_usec = xtimer_now_usec();
+    bool active = false;
+
+    for (unsigned i = 0; i < GNRC_SIXLOWPAN_FRAG_VRB_SIZE; i++) {
+        if (_vrb[i].datagram_size == 0) {
+            continue;
+        }
+        if ((now_usec - _vrb[i].arrival) > VRB_TIMEOUT) {
+            DEBUG("6lo vrb: entry %p for datagram tag %u timed out\n",
+                  (void *)&_vrb[i], _vrb[i].tag);
+            vrb_rm(&_vrb[i]);
+        }
+        else {
+            active = true;
+        }
+    }
+    if (active) {
+        rbuf_set_gc_timeout();
+    }
+}
+
+#else   /* MODULE_GNRC_SIXLOWPAN_FRAG_VRB */
+typedef int dont_be_pedantic;
+#endif  /* MODULE_GNRC_SIXLOWPAN_FRAG_VRB */
+
+/** @} */
@@ -0,0 +1,161 @@
+/*
+ * Copyright (C) 2026 agent <agent@local>
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     net_gnrc_sixlowpan_frag
+ * @{
+ *
+ * @file
+ * @internal
+ * @brief   6LoWPAN virtual reassembly buffer
+ *
+ * A router that uses the virtual reassembly buffer (VRB) only reassembles the
+ * first fragment of a datagram to route it. The remaining fragments are
+ * forwarded as soon as they arrive, using the entry for the datagram to
+ * switch them from their incoming to their outgoing link.
+ *
+ * @see [Virtual reassembly buffers in 6LoWPAN](https://tools.ietf.org/html/draft-ietf-lwig-6lowpan-virtual-reassembly-00)
+ *
+ * @author  agent <agent@local>
+ */
+#ifndef VRB_H
+#define VRB_H
+
+#include <inttypes.h>
+
+#include "bitfield.h"
+#include "kernel_types.h"
+#include "net/gnrc/sixlowpan/frag.h"
+#include "net/ieee802154.h"
+
+#include "rbuf.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief   Number of datagrams that can be forwarded at the same time
+ */
+#ifndef GNRC_SIXLOWPAN_FRAG_VRB_SIZE
+#define GNRC_SIXLOWPAN_FRAG_VRB_SIZE    (16U)
+#endif
+
+/**
+ * @brief   Number of hash buckets entries are looked up in
+ */
+#ifndef GNRC_SIXLOWPAN_FRAG_VRB_HASH_SIZE
+#define GNRC_SIXLOWPAN_FRAG_VRB_HASH_SIZE   (GNRC_SIXLOWPAN_FRAG_VRB_SIZE)
+#endif
+
+#if GNRC_SIXLOWPAN_FRAG_VRB_SIZE > UINT8_MAX
+#error "GNRC_SIXLOWPAN_FRAG_VRB_SIZE must not be larger than 255"
+#endif
+
+/**
+ * @brief   Timeout for an entry in microseconds, reset with every forwarded
+ *          fragment
+ */
+#define VRB_TIMEOUT                     (RBUF_TIMEOUT)
+
+/**
+ * @brief   An entry in the virtual reassembly buffer
+ *
+ * Fragments received from vrb_t::src with tag vrb_t::tag for a
+ * datagram of vrb_t::datagram_size bytes are sent to
+ * vrb_t::out_dst via vrb_t::out_pid with tag vrb_t::out_tag.
+ *
+ * @internal
+ */
+typedef struct {
+    uint8_t src[IEEE802154_LONG_ADDRESS_LEN];       /**< source address */
+    uint8_t out_dst[IEEE802154_LONG_ADDRESS_LEN];   /**< next hop's address */
+    uint32_t arrival;           /**< time in microseconds of arrival of
+                                 *   last received fragment */
+    uint16_t datagram_size;     /**< size of the datagram, 0 if entry is free */
+    uint16_t tag;               /**< the datagram's tag on the incoming link */
+    uint16_t out_tag;           /**< the datagram's tag on the outgoing link */
+    BITFIELD(forwarded, RBUF_UNITS);    /**< 8-byte units of the datagram
+                                         *   forwarded so far */
+    uint16_t fwd_size;          /**< number of bytes of the datagram
+                                 *   forwarded so far */
+    kernel_pid_t out_pid;       /**< outgoing interface */
+    uint8_t src_len;            /**< length of vrb_t::src */
+    uint8_t out_dst_len;        /**< length of vrb_t::out_dst */
+    uint8_t next;               /**< index + 1 of the next entry in the same
+                                 *   hash bucket, 0 for none */
+} vrb_t;
+
+/**
+ * @brief   Adds an entry for a datagram from its reassembly buffer entry
+ *
+ * If the buffer is full, the entry that was used least recently is
+ * replaced.
+ *
+ * @param[in] rbuf          Reassembly buffer entry of the datagram, holding
+ *                          its (uncompressed) first fragment.
+ * @param[in] out_pid       Outgoing interface.
+ * @param[in] out_dst       Link-layer address of the next hop.
+ * @param[in] out_dst_len   Length of @p out_dst.
+ * @param[in] out_tag       Tag for the datagram on the outgoing link.
+ *
+ * @return  The new entry.
+ */
+vrb_t *vrb_add(const gnrc_sixlowpan_rbuf_t *rbuf, kernel_pid_t out_pid,
+               const uint8_t *out_dst, size_t out_dst_len, uint16_t out_tag);
+
+/**
+ * @brief   Gets the entry of a datagram
+ *
+ * @param[in] src       Link-layer source address of the fragment.
+ * @param[in] src_len   Length of @p src.
+ * @param[in] size      Datagram size from the fragment header.
+ * @param[in] tag       Datagram tag from the fragment header.
+ *
+ * @return  The entry for the datagram.
+ * @return  NULL, if the datagram is not forwarded with the virtual
+ *          reassembly buffer.
+ */
+vrb_t *vrb_get(const uint8_t *src, size_t src_len, size_t size, uint16_t tag);
+
+/**
+ * @brief   Marks the part of the datagram a subsequent fragment covers as
+ *          forwarded
+ *
+ * @param[in] entry     An entry of the virtual reassembly buffer.
+ * @param[in] offset    The fragment's offset.
+ * @param[in] frag_size Size of the fragment's payload.
+ *
+ * @return  1, if no part of the fragment was forwarded before.
+ * @return  0, if all of it was, i.e. the fragment is a duplicate.
+ * @return  -1, if it overlaps fragments forwarded before or the end of the
+ *          datagram.
+ */
+int vrb_update_coverage(vrb_t *entry, uint16_t offset, size_t frag_size);
+
+/**
+ * @brief   Removes an entry
+ *
+ * @param[in] entry An entry of the virtual reassembly buffer.
+ */
+void vrb_rm(vrb_t *entry);
+
+/**
+ * @brief   Removes entries that timed out
+ *
+ * Called with rbuf_gc(). Keeps the garbage collection timer running as long
+ * as there are entries left.
+ */
+void vrb_gc(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* VRB_H */
+/** @} */
@@ -13,6 +13,7 @@
  */
 
 #include "kernel_types.h"
+#include "mutex.h"
 #include "net/gnrc.h"
 #include "thread.h"
 #include "utlist.h"
@@ -40,11 +41,17 @@ static char _stack[GNRC_SIXLOWPAN_STACK_SIZE + THREAD_EXTRA_STACKSIZE_PRINTF];
 static char _stack[GNRC_SIXLOWPAN_STACK_SIZE];
 #endif
 
+#ifdef MODULE_GNRC_NETAPI_RTC
+/* held while the 6LoWPAN state (e.g. the reassembly buffer) is in use */
+static mutex_t _rtc_lock = MUTEX_INIT;
+#endif
 
 /* handles GNRC_NETAPI_MSG_TYPE_RCV commands */
 static void _receive(gnrc_pktsnip_t *pkt);
 /* handles GNRC_NETAPI_MSG_TYPE_SND commands */
 static void _send(gnrc_pktsnip_t *pkt);
+/* handles GNRC_NETAPI_MSG_TYPE_SND_TRAIN commands */
+static unsigned _send_train(gnrc_pktqueue_t *train);
 /* Main event loop for 6LoWPAN */
 static void *_event_loop(void *args);
 
@@ -297,14 +304,70 @@ static void _send(gnrc_pktsnip_t *pkt)
     gnrc_sixlowpan_multiplex_by_size(pkt, datagram_size, netif, 0);
 }
 
+static unsigned _send_train(gnrc_pktqueue_t *train)
+{
+    unsigned num = 0;
+
+    for (; train != NULL; train = train->next) {
+#ifdef MODULE_GNRC_SIXLOWPAN_FRAG
+        if (gnrc_sixlowpan_msg_frag_get() == NULL) {
+            /* a datagram is still being fragmented: rather than dropping the
+             * next one if it is too large, hand the rest back to the sender */
+            break;
+        }
+#endif
+        _send(train->pkt);
+        num++;
+    }
+    return num;
+}
+
+#ifdef MODULE_GNRC_NETAPI_RTC
+static void _rtc_cb(uint16_t cmd, gnrc_pktsnip_t *pkt, void *ctx)
+{
+    msg_t msg;
+
+    (void)ctx;
+    if ((cmd == GNRC_NETAPI_MSG_TYPE_RCV) && mutex_trylock(&_rtc_lock)) {
+        /* packets queued before must not be overtaken */
+        if (msg_avail_thread(_pid) == 0) {
+            DEBUG("6lo: handle received packet in thread %" PRIkernel_pid "\n",
+                  sched_active_pid);
+            _receive(pkt);
+            mutex_unlock(&_rtc_lock);
+            return;
+        }
+        mutex_unlock(&_rtc_lock);
+    }
+    /* 6LoWPAN thread is busy or packet is to be sent: queue it */
+    msg.type = cmd;
+    msg.content.ptr = pkt;
+    if (msg_try_send(&msg, _pid) < 1) {
+        DEBUG("6lo: unable to queue packet to 6LoWPAN thread\n");
+        gnrc_pktbuf_release(pkt);
+    }
+}
+#endif
+
 static void *_event_loop(void *args)
 {
     msg_t msg, reply, msg_q[GNRC_SIXLOWPAN_MSG_QUEUE_SIZE];
+#ifdef MODULE_GNRC_NETAPI_RTC
+    gnrc_netreg_entry_cbd_t me_cbd = { .cb = _rtc_cb, .ctx = NULL };
+    gnrc_netreg_entry_t me_reg;
+
+    /* receive packets in the dispatching thread */
+    gnrc_netreg_entry_init_cb(&me_reg, GNRC_NETREG_DEMUX_CTX_ALL, &me_cbd);
+#else
     gnrc_netreg_entry_t me_reg = GNRC_NETREG_ENTRY_INIT_PID(GNRC_NETREG_DEMUX_CTX_ALL,
                                                             sched_active_pid);
+#endif
 
     (void)args;
     msg_init_queue(msg_q, GNRC_SIXLOWPAN_MSG_QUEUE_SIZE);
+#ifdef MODULE_GNRC_SIXLOWPAN_FRAG
+    gnrc_sixlowpan_frag_rbuf_set_gc_pid(sched_active_pid);
+#endif
 
     /* register interest in all 6LoWPAN packets */
     gnrc_netreg_register(GNRC_NETTYPE_SIXLOWPAN, &me_reg);
@@ -316,6 +379,9 @@ static void *_event_loop(void *args)
     while (1) {
         DEBUG("6lo: waiting for incoming message.\n");
         msg_receive(&msg);
+#ifdef MODULE_GNRC_NETAPI_RTC
+        mutex_lock(&_rtc_lock);
+#endif
 
         switch (msg.type) {
             case GNRC_NETAPI_MSG_TYPE_RCV:
@@ -328,6 +394,12 @@ static void *_event_loop(void *args)
                 _send(msg.content.ptr);
                 break;
 
+            case GNRC_NETAPI_MSG_TYPE_SND_TRAIN:
+                DEBUG("6lo: GNRC_NETAPI_MSG_TYPE_SND_TRAIN received\n");
+                reply.content.value = _send_train(msg.content.ptr);
+                msg_reply(&msg, &reply);
+                break;
+
             case GNRC_NETAPI_MSG_TYPE_GET:
             case GNRC_NETAPI_MSG_TYPE_SET:
                 DEBUG("6lo: reply to unsupported get/set\n");
@@ -349,6 +421,9 @@ static void *_event_loop(void *args)
                 DEBUG("6lo: operation not supported\n");
                 break;
         }
+#ifdef MODULE_GNRC_NETAPI_RTC
+        mutex_unlock(&_rtc_lock);
+#endif
     }
 
     return NULL;
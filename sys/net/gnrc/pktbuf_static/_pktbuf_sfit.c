@@ -0,0 +1,306 @@
+/*
+ * Copyright (C) 2026 agent <agent@local>
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup net_gnrc_pktbuf
+ * @{
+ *
+ * @file
+ *
+ * @author  agent <agent@local>
+ */
+
+#ifdef MODULE_GNRC_PKTBUF_STATIC_SFIT
+
+#include <assert.h>
+#include <string.h>
+
+#include "bitarithm.h"
+
+#include "_pktbuf_sfit.h"
+
+#define ENABLE_DEBUG (0)
+#include "debug.h"
+
+/* all chunk sizes and positions are in granules */
+#define SFIT_NUMOF          (GNRC_PKTBUF_SIZE / SFIT_GRANULE)
+#define SFIT_NIL            (UINT16_MAX)
+
+/* header of a free chunk, its size is repeated in its last two bytes */
+typedef struct {
+    uint16_t next;      /* next free chunk in the same bin */
+    uint16_t prev;      /* previous free chunk in the same bin */
+    uint16_t size;
+} _chunk_t;
+
+static uint8_t *_arena;
+static uint16_t _bins[SFIT_FL_NUMOF][SFIT_SL_NUMOF];
+static uint16_t _fl_map;
+static uint8_t _sl_map[SFIT_FL_NUMOF];
+/* marks first and last granule of every free chunk */
+static uint8_t _bounds[(SFIT_NUMOF + 7) / 8];
+
+static inline _chunk_t *_chunk(unsigned idx)
+{
+    return (_chunk_t *)&_arena[idx * SFIT_GRANULE];
+}
+
+static inline uint16_t *_footer(unsigned idx, unsigned size)
+{
+    return (uint16_t *)&_arena[((idx + size) * SFIT_GRANULE) -
+                               sizeof(uint16_t)];
+}
+
+static inline bool _is_bound(unsigned idx)
+{
+    return _bounds[idx / 8] & (1U << (idx % 8));
+}
+
+static inline void _set_bounds(unsigned idx, unsigned size)
+{
+    _bounds[idx / 8] |= (1U << (idx % 8));
+    idx += size - 1;
+    _bounds[idx / 8] |= (1U << (idx % 8));
+}
+
+static inline void _clear_bounds(unsigned idx, unsigned size)
+{
+    _bounds[idx / 8] &= ~(1U << (idx % 8));
+    idx += size - 1;
+    _bounds[idx / 8] &= ~(1U << (idx % 8));
+}
+
+static void _mapping(unsigned size, unsigned *fl, unsigned *sl)
+{
+    if (size < SFIT_SL_NUMOF) {
+        *fl = 0;
+        *sl = size;
+    }
+    else {
+        unsigned msb = bitarithm_msb(size);
+
+        *fl = msb - SFIT_SL_SHIFT + 1;
+        *sl = (size >> (msb - SFIT_SL_SHIFT)) - SFIT_SL_NUMOF;
+    }
+}
+
+static void _insert(unsigned idx, unsigned size)
+{
+    _chunk_t *chunk = _chunk(idx);
+    unsigned fl, sl;
+
+    _mapping(size, &fl, &sl);
+    chunk->size = size;
+    *_footer(idx, size) = size;
+    chunk->prev = SFIT_NIL;
+    chunk->next = _bins[fl][sl];
+    if (chunk->next != SFIT_NIL) {
+        _chunk(chunk->next)->prev = idx;
+    }
+    _bins[fl][sl] = idx;
+    _fl_map |= (1U << fl);
+    _sl_map[fl] |= (1U << sl);
+    _set_bounds(idx, size);
+}
+
+static void _remove(unsigned idx)
+{
+    _chunk_t *chunk = _chunk(idx);
+    unsigned fl, sl;
+
+    _mapping(chunk->size, &fl, &sl);
+    if (chunk->next != SFIT_NIL) {
+        _chunk(chunk->next)->prev = chunk->prev;
+    }
+    if (chunk->prev != SFIT_NIL) {
+        _chunk(chunk->prev)->next = chunk->next;
+    }
+    else {
+        _bins[fl][sl] = chunk->next;
+        if (chunk->next == SFIT_NIL) {
+            _sl_map[fl] &= ~(1U << sl);
+            if (_sl_map[fl] == 0) {
+                _fl_map &= ~(1U << fl);
+            }
+        }
+    }
+    _clear_bounds(idx, chunk->size);
+}
+
+static unsigned _find(unsigned size)
+{
+    unsigned fl, sl, map;
+
+    /* round up to the next class, so every chunk in the bin fits */
+    if (size >= SFIT_SL_NUMOF) {
+        _mapping(size + (1U << (bitarithm_msb(size) - SFIT_SL_SHIFT)) - 1,
+                 &fl, &sl);
+    }
+    else {
+        _mapping(size, &fl, &sl);
+    }
+    if (fl < SFIT_FL_NUMOF) {
+        map = _sl_map[fl] & (~0U << sl);
+        if (map == 0) {
+            map = _fl_map & (~0U << (fl + 1));
+            if (map != 0) {
+                fl = bitarithm_lsb(map);
+                map = _sl_map[fl];
+            }
+        }
+        if (map != 0) {
+            return _bins[fl][bitarithm_lsb(map)];
+        }
+    }
+    /* only chunks of the request's own class are left */
+    _mapping(size, &fl, &sl);
+    for (unsigned idx = _bins[fl][sl]; idx != SFIT_NIL;
+         idx = _chunk(idx)->next) {
+        if (_chunk(idx)->size >= size) {
+            return idx;
+        }
+    }
+    return SFIT_NIL;
+}
+
+void _sfit_init(uint8_t *arena)
+{
+    assert(((uintptr_t)arena % SFIT_GRANULE) == 0);
+    _arena = arena;
+    memset(_bins, 0xff, sizeof(_bins));
+    memset(_sl_map, 0, sizeof(_sl_map));
+    memset(_bounds, 0, sizeof(_bounds));
+    _fl_map = 0;
+    _insert(0, SFIT_NUMOF);
+}
+
+void *_sfit_alloc(size_t size)
+{
+    unsigned granules = (size + SFIT_GRANULE - 1) / SFIT_GRANULE;
+    unsigned idx, chunk_size;
+
+    if (granules == 0) {
+        granules = 1;
+    }
+    if (granules > SFIT_NUMOF) {
+        return NULL;
+    }
+    idx = _find(granules);
+    if (idx == SFIT_NIL) {
+        DEBUG("pktbuf: no chunk of %u bytes left\n",
+              granules * SFIT_GRANULE);
+        return NULL;
+    }
+    chunk_size = _chunk(idx)->size;
+    _remove(idx);
+    if (chunk_size > granules) {
+        _insert(idx + granules, chunk_size - granules);
+    }
+    return _chunk(idx);
+}
+
+void _sfit_free(void *ptr, size_t size)
+{
+    unsigned idx = ((uint8_t *)ptr - _arena) / SFIT_GRANULE;
+    unsigned granules = (size + SFIT_GRANULE - 1) / SFIT_GRANULE;
+
+    assert((((uint8_t *)ptr - _arena) % SFIT_GRANULE) == 0);
+    if (granules == 0) {
+        return;
+    }
+    /* the freed part is in use, so a free neighbor can only be the last
+     * granule of the chunk before or the first granule of the chunk after */
+    if ((idx > 0) && _is_bound(idx - 1)) {
+        unsigned prev_size = *_footer(idx, 0);
+
+        idx -= prev_size;
+        granules += prev_size;
+        _remove(idx);
+    }
+    if (((idx + granules) < SFIT_NUMOF) && _is_bound(idx + granules)) {
+        unsigned next = idx + granules;
+
+        granules += _chunk(next)->size;
+        _remove(next);
+    }
+    _insert(idx, granules);
+}
+
+void _sfit_usage(_sfit_usage_t *usage)
+{
+    memset(usage, 0, sizeof(*usage));
+    for (unsigned fl = 0; fl < SFIT_FL_NUMOF; fl++) {
+        for (unsigned sl = 0; sl < SFIT_SL_NUMOF; sl++) {
+            for (unsigned idx = _bins[fl][sl]; idx != SFIT_NIL;
+                 idx = _chunk(idx)->next) {
+                unsigned bytes = _chunk(idx)->size * SFIT_GRANULE;
+
+                usage->free += bytes;
+                usage->chunks++;
+                if (bytes > usage->largest) {
+                    usage->largest = bytes;
+                }
+            }
+        }
+    }
+}
+
+bool _sfit_is_empty(void)
+{
+    return _is_bound(0) && (_chunk(0)->size == SFIT_NUMOF);
+}
+
+bool _sfit_is_sane(void)
+{
+    unsigned bounds = 0;
+
+    for (unsigned fl = 0; fl < SFIT_FL_NUMOF; fl++) {
+        for (unsigned sl = 0; sl < SFIT_SL_NUMOF; sl++) {
+            unsigned prev = SFIT_NIL;
+            bool nonempty = (_bins[fl][sl] != SFIT_NIL);
+
+            if ((((_sl_map[fl] >> sl) & 1) != nonempty) ||
+                (nonempty && !(_fl_map & (1U << fl)))) {
+                return false;
+            }
+            for (unsigned idx = _bins[fl][sl]; idx != SFIT_NIL;
+                 idx = _chunk(idx)->next) {
+                _chunk_t *chunk = _chunk(idx);
+                unsigned chunk_fl, chunk_sl;
+
+                if ((chunk->size == 0) || ((idx + chunk->size) > SFIT_NUMOF) ||
+                    (chunk->prev != prev) ||
+                    (*_footer(idx, chunk->size) != chunk->size) ||
+                    !_is_bound(idx) || !_is_bound(idx + chunk->size - 1)) {
+                    return false;
+                }
+                _mapping(chunk->size, &chunk_fl, &chunk_sl);
+                if ((chunk_fl != fl) || (chunk_sl != sl)) {
+                    return false;
+                }
+                /* free chunks are always merged with free neighbors */
+                if (((idx + chunk->size) < SFIT_NUMOF) &&
+                    _is_bound(idx + chunk->size)) {
+                    return false;
+                }
+                bounds += (chunk->size == 1) ? 1 : 2;
+                prev = idx;
+            }
+        }
+    }
+    /* no stray marks */
+    for (unsigned i = 0; i < sizeof(_bounds); i++) {
+        bounds -= bitarithm_bits_set(_bounds[i]);
+    }
+    return bounds == 0;
+}
+
+/** @} */
+#else
+typedef int dont_be_pedantic;
+#endif /* MODULE_GNRC_PKTBUF_STATIC_SFIT */
@@ -0,0 +1,138 @@
+/*
+ * Copyright (C) 2026 agent <agent@local>
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup net_gnrc_pktbuf
+ * @internal
+ * @{
+ *
+ * @file
+ * @brief   Segregated-fit allocator for the static packet buffer
+ *
+ * Free chunks are kept in size-class bins: the first level is the power of
+ * two of the chunk size, the second level splits it into
+ * @ref SFIT_SL_NUMOF linear classes. Bitmaps of the non-empty bins let both
+ * allocation and free run in constant time. A chunk is taken from the first
+ * non-empty bin whose smallest chunk fits the request, so every chunk in it
+ * fits and no list is walked. Only if none exists, the bin the request maps
+ * to is searched for a chunk that is large enough.
+ *
+ * Like the first-fit allocator, data can be freed in parts, so allocated
+ * chunks carry no header. Free chunks store their list links and size at
+ * their start and their size again at their end, and a bitmap marks the
+ * first and last granule of every free chunk. This way, free chunks are
+ * merged with their neighbors immediately.
+ *
+ * @author  agent <agent@local>
+ */
+#ifndef PRIV_PKTBUF_SFIT_H
+#define PRIV_PKTBUF_SFIT_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include "net/gnrc/pktbuf.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#if GNRC_PKTBUF_SIZE > 65535
+#error "gnrc_pktbuf_static_sfit: GNRC_PKTBUF_SIZE must not exceed 65535"
+#endif
+
+/**
+ * @brief   Allocation granularity in bytes
+ *
+ * Must fit the header of a free chunk.
+ */
+#define SFIT_GRANULE        (8U)
+
+/**
+ * @brief   log2 of the number of second level classes
+ */
+#define SFIT_SL_SHIFT       (2U)
+
+/**
+ * @brief   Number of second level classes per first level class
+ */
+#define SFIT_SL_NUMOF       (1U << SFIT_SL_SHIFT)
+
+/**
+ * @brief   Number of first level classes
+ *
+ * Covers all sizes up to 65535 bytes.
+ */
+#define SFIT_FL_NUMOF       (12U)
+
+/**
+ * @brief   Usage of the packet buffer
+ */
+typedef struct {
+    unsigned free;          /**< free bytes */
+    unsigned chunks;        /**< number of free chunks */
+    unsigned largest;       /**< size of the largest free chunk in bytes */
+} _sfit_usage_t;
+
+/**
+ * @brief   Initializes the allocator
+ *
+ * @param[in] arena     The packet buffer of size @ref GNRC_PKTBUF_SIZE,
+ *                      aligned to @ref SFIT_GRANULE.
+ */
+void _sfit_init(uint8_t *arena);
+
+/**
+ * @brief   Allocates a chunk
+ *
+ * @param[in] size  Size in bytes
+ *
+ * @return  The chunk
+ * @return  NULL, if no free chunk is large enough
+ */
+void *_sfit_alloc(size_t size);
+
+/**
+ * @brief   Frees (a part of) a chunk
+ *
+ * @pre @p ptr and @p ptr + @p size are within the same allocated chunk and
+ *      @p ptr is aligned to @ref SFIT_GRANULE.
+ *
+ * @param[in] ptr   Start of the part to free
+ * @param[in] size  Size of the part in bytes
+ */
+void _sfit_free(void *ptr, size_t size);
+
+/**
+ * @brief   Gets the usage of the packet buffer
+ *
+ * @param[out] usage    Usage of the packet buffer
+ */
+void _sfit_usage(_sfit_usage_t *usage);
+
+/**
+ * @brief   Checks if nothing is allocated
+ *
+ * @return  true, if the whole packet buffer is one free chunk
+ */
+bool _sfit_is_empty(void);
+
+/**
+ * @brief   Checks the invariants of the free chunk bins
+ *
+ * @return  true, if the bins are consistent
+ */
+bool _sfit_is_sane(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* PRIV_PKTBUF_SFIT_H */
+/** @} */
@@ -30,30 +30,54 @@
 #include "net/gnrc/nettype.h"
 #include "net/gnrc/pkt.h"
 
+#ifdef MODULE_GNRC_PKTBUF_STATIC_SFIT
+#include "_pktbuf_sfit.h"
+#endif
+
 #define ENABLE_DEBUG (0)
 #include "debug.h"
 
-#define _ALIGNMENT_MASK    (sizeof(_unused_t) - 1)
-
 typedef struct _unused {
     struct _unused *next;
     unsigned int size;
 } _unused_t;
 
 static mutex_t _mutex = MUTEX_INIT;
+
+#ifdef MODULE_GNRC_PKTBUF_STATIC_SFIT
+#define _ALIGNMENT_MASK    (SFIT_GRANULE - 1)
+
+static uint8_t _pktbuf[GNRC_PKTBUF_SIZE] __attribute__((aligned(SFIT_GRANULE)));
+#else
+#define _ALIGNMENT_MASK    (sizeof(_unused_t) - 1)
+
 static uint8_t _pktbuf[GNRC_PKTBUF_SIZE];
 static _unused_t *_first_unused;
+#endif
 
-#ifdef DEVELHELP
+#if defined(DEVELHELP) && !defined(MODULE_GNRC_PKTBUF_STATIC_SFIT)
 /* maximum number of bytes allocated */
 static uint16_t max_byte_count = 0;
 #endif
 
+#ifdef DEVELHELP
+/* bytes currently allocated and their maximum */
+static size_t _used = 0;
+static size_t _max_used = 0;
+/* failed allocations, and those of them with enough free bytes in total */
+static unsigned _failed = 0;
+static unsigned _failed_fragmented = 0;
+#endif
+
 /* internal gnrc_pktbuf functions */
 static gnrc_pktsnip_t *_create_snip(gnrc_pktsnip_t *next, const void *data, size_t size,
                                     gnrc_nettype_t type);
 static void *_pktbuf_alloc(size_t size);
 static void _pktbuf_free(void *data, size_t size);
+#ifndef MODULE_GNRC_PKTBUF_STATIC_SFIT
+static void *_first_fit_alloc(size_t size);
+static void _first_fit_free(void *data, size_t size);
+#endif
 
 static inline bool _pktbuf_contains(void *ptr)
 {
@@ -82,9 +106,19 @@ static inline void _set_pktsnip(gnrc_pktsnip_t *pkt, gnrc_pktsnip_t *next,
 void gnrc_pktbuf_init(void)
 {
     mutex_lock(&_mutex);
+#ifdef MODULE_GNRC_PKTBUF_STATIC_SFIT
+    _sfit_init(_pktbuf);
+#else
     _first_unused = (_unused_t *)_pktbuf;
     _first_unused->next = NULL;
     _first_unused->size = sizeof(_pktbuf);
+#endif
+#ifdef DEVELHELP
+    _used = 0;
+    _max_used = 0;
+    _failed = 0;
+    _failed_fragmented = 0;
+#endif
     mutex_unlock(&_mutex);
 }
 
@@ -267,7 +301,7 @@ gnrc_pktsnip_t *gnrc_pktbuf_start_write(gnrc_pktsnip_t *pkt)
 }
 
 #ifdef DEVELHELP
-#ifdef MODULE_OD
+#if defined(MODULE_OD) && !defined(MODULE_GNRC_PKTBUF_STATIC_SFIT)
 static inline void _print_chunk(void *chunk, size_t size, int num)
 {
     printf("=========== chunk %3d (%-10p size: %4u) ===========\n", num, chunk,
@@ -282,15 +316,48 @@ static inline void _print_unused(_unused_t *ptr)
 }
 #endif
 
+static void _print_usage(void)
+{
+    unsigned free_bytes = 0, chunks = 0, largest = 0;
+
+#ifdef MODULE_GNRC_PKTBUF_STATIC_SFIT
+    _sfit_usage_t usage;
+
+    _sfit_usage(&usage);
+    free_bytes = usage.free;
+    chunks = usage.chunks;
+    largest = usage.largest;
+#else
+    for (_unused_t *ptr = _first_unused; ptr != NULL; ptr = ptr->next) {
+        free_bytes += ptr->size;
+        chunks++;
+        if (ptr->size > largest) {
+            largest = ptr->size;
+        }
+    }
+#endif
+    printf("  used: %u bytes, high watermark: %u bytes\n", (unsigned)_used,
+           (unsigned)_max_used);
+    /* share of free bytes that are not part of the largest free chunk */
+    printf("  free: %u bytes in %u chunks, largest: %u bytes, "
+           "fragmentation: %u%%\n", free_bytes, chunks, largest,
+           free_bytes ? (100U - ((100U * largest) / free_bytes)) : 0);
+    printf("  failed allocations: %u, with enough free bytes: %u\n",
+           _failed, _failed_fragmented);
+}
+
 void gnrc_pktbuf_stats(void)
 {
-#ifdef MODULE_OD
+    printf("packet buffer: first byte: %p, last byte: %p (size: %u)\n",
+           (void *)&_pktbuf[0], (void *)&_pktbuf[GNRC_PKTBUF_SIZE], GNRC_PKTBUF_SIZE);
+    mutex_lock(&_mutex);
+    _print_usage();
+    mutex_unlock(&_mutex);
+#if defined(MODULE_OD) && !defined(MODULE_GNRC_PKTBUF_STATIC_SFIT)
     _unused_t *ptr = _first_unused;
     uint8_t *chunk = &_pktbuf[0];
     int count = 0;
 
-    printf("packet buffer: first byte: %p, last byte: %p (size: %u)\n",
-           (void *)&_pktbuf[0], (void *)&_pktbuf[GNRC_PKTBUF_SIZE], GNRC_PKTBUF_SIZE);
     printf("  position of last byte used: %" PRIu16 "\n", max_byte_count);
     if (ptr == NULL) {  /* packet buffer is completely full */
         _print_chunk(chunk, GNRC_PKTBUF_SIZE, count++);
@@ -318,13 +385,22 @@ void gnrc_pktbuf_stats(void)
     if (chunk <= &_pktbuf[GNRC_PKTBUF_SIZE - 1]) {
         _print_chunk(chunk, &_pktbuf[GNRC_PKTBUF_SIZE] - chunk, count);
     }
-#else
-    DEBUG("pktbuf: needs od module\n");
 #endif
 }
 #endif
 
 #ifdef TEST_SUITES
+#ifdef MODULE_GNRC_PKTBUF_STATIC_SFIT
+bool gnrc_pktbuf_is_empty(void)
+{
+    return _sfit_is_empty();
+}
+
+bool gnrc_pktbuf_is_sane(void)
+{
+    return _sfit_is_sane();
+}
+#else
 bool gnrc_pktbuf_is_empty(void)
 {
     return (_first_unused == (_unused_t *)_pktbuf) &&
@@ -362,6 +438,7 @@ bool gnrc_pktbuf_is_sane(void)
     return true;
 }
 #endif
+#endif
 
 static gnrc_pktsnip_t *_create_snip(gnrc_pktsnip_t *next, const void *data, size_t size,
                                     gnrc_nettype_t type)
@@ -389,6 +466,46 @@ static gnrc_pktsnip_t *_create_snip(gnrc_pktsnip_t *next, const void *data, size
 }
 
 static void *_pktbuf_alloc(size_t size)
+{
+#ifdef MODULE_GNRC_PKTBUF_STATIC_SFIT
+    void *ptr = _sfit_alloc(size);
+#else
+    void *ptr = _first_fit_alloc(size);
+#endif
+#ifdef DEVELHELP
+    if (ptr == NULL) {
+        _failed++;
+        if ((size_t)(GNRC_PKTBUF_SIZE - _used) >= _align(size)) {
+            _failed_fragmented++;
+        }
+    }
+    else {
+        _used += _align(size);
+        if (_used > _max_used) {
+            _max_used = _used;
+        }
+    }
+#endif
+    return ptr;
+}
+
+static void _pktbuf_free(void *data, size_t size)
+{
+    if (!_pktbuf_contains(data)) {
+        return;
+    }
+#ifdef DEVELHELP
+    _used -= _align(size);
+#endif
+#ifdef MODULE_GNRC_PKTBUF_STATIC_SFIT
+    _sfit_free(data, size);
+#else
+    _first_fit_free(data, size);
+#endif
+}
+
+#ifndef MODULE_GNRC_PKTBUF_STATIC_SFIT
+static void *_first_fit_alloc(size_t size)
 {
     _unused_t *prev = NULL, *ptr = _first_unused;
 
@@ -449,14 +566,11 @@ static inline _unused_t *_merge(_unused_t *a, _unused_t *b)
     return a;
 }
 
-static void _pktbuf_free(void *data, size_t size)
+static void _first_fit_free(void *data, size_t size)
 {
     size_t bytes_at_end;
     _unused_t *new = (_unused_t *)data, *prev = NULL, *ptr = _first_unused;
 
-    if (!_pktbuf_contains(data)) {
-        return;
-    }
     while (ptr && (((void *)ptr) < data)) {
         prev = ptr;
         ptr = ptr->next;
@@ -484,6 +598,7 @@ static void _pktbuf_free(void *data, size_t size)
         _merge(new, new->next);
     }
 }
+#endif /* MODULE_GNRC_PKTBUF_STATIC_SFIT */
 
 
 gnrc_pktsnip_t *gnrc_pktbuf_duplicate_upto(gnrc_pktsnip_t *pkt, gnrc_nettype_t type)
@@ -0,0 +1,457 @@
+/*
+ * Copyright (C) 2026 agent <agent@local>
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup net_gnrc_pktbuf
+ * @{
+ *
+ * @file
+ * @brief   Packet buffer on a dedicated TLSF pool
+ *
+ * Works like `gnrc_pktbuf_malloc`, but allocates from a pool of its own that
+ * is managed by TLSF, so allocation and free take constant time and the
+ * packet buffer can't exhaust (or be exhausted by) the heap.
+ *
+ * @author  agent <agent@local>
+ */
+
+#include <assert.h>
+#include <errno.h>
+#include <inttypes.h>
+#include <stdbool.h>
+#include <string.h>
+#include <stdio.h>
+#include <sys/types.h>
+#include <sys/uio.h>
+
+#include "mutex.h"
+#include "tlsf.h"
+#include "utlist.h"
+#include "net/gnrc/pktbuf.h"
+#include "net/gnrc/nettype.h"
+#include "net/gnrc/pkt.h"
+
+#define ENABLE_DEBUG (0)
+#include "debug.h"
+
+static mutex_t _mutex = MUTEX_INIT;
+static tlsf_t _tlsf;
+/* TLSF puts its control structure at the start of the pool */
+static uint8_t _pool[GNRC_PKTBUF_SIZE + GNRC_PKTBUF_TLSF_OVERHEAD]
+    __attribute__((aligned(__BIGGEST_ALIGNMENT__)));
+
+#ifdef TEST_SUITES
+static unsigned _allocs;
+#endif
+
+#ifdef DEVELHELP
+/* bytes in allocated blocks and their maximum */
+static unsigned _used;
+static unsigned _max_used;
+/* failed allocations, and those of them with enough free bytes in total */
+static unsigned _failed;
+static unsigned _failed_fragmented;
+
+static inline void _account(size_t freed, void *allocated, size_t size)
+{
+    _used -= freed;
+    if (allocated == NULL) {
+        _failed++;
+        /* block headers may take _used slightly beyond GNRC_PKTBUF_SIZE */
+        if ((_used < GNRC_PKTBUF_SIZE) &&
+            ((size_t)(GNRC_PKTBUF_SIZE - _used) >= size)) {
+            _failed_fragmented++;
+        }
+        return;
+    }
+    _used += tlsf_block_size(allocated);
+    if (_used > _max_used) {
+        _max_used = _used;
+    }
+}
+#endif
+
+static void *_malloc(size_t size)
+{
+    void *ptr = tlsf_malloc(_tlsf, size);
+
+#ifdef TEST_SUITES
+    if (ptr != NULL) {
+        _allocs++;
+    }
+#endif
+#ifdef DEVELHELP
+    _account(0, ptr, size);
+#endif
+    return ptr;
+}
+
+static void *_realloc(void *ptr, size_t size)
+{
+    assert((ptr != NULL) && (size > 0));
+#ifdef DEVELHELP
+    size_t old_size = tlsf_block_size(ptr);
+#endif
+    void *new = tlsf_realloc(_tlsf, ptr, size);
+
+#ifdef DEVELHELP
+    /* the old block stays allocated if reallocation fails */
+    _account((new == NULL) ? 0 : old_size, new, size);
+#endif
+    return new;
+}
+
+static void _free(void *ptr)
+{
+    if (ptr != NULL) {
+#ifdef TEST_SUITES
+        _allocs--;
+#endif
+#ifdef DEVELHELP
+        _used -= tlsf_block_size(ptr);
+#endif
+        tlsf_free(_tlsf, ptr);
+    }
+}
+
+/* internal gnrc_pktbuf functions */
+static gnrc_pktsnip_t *_create_snip(gnrc_pktsnip_t *next, const void *data, size_t size,
+                                    gnrc_nettype_t type);
+
+static inline void _set_pktsnip(gnrc_pktsnip_t *pkt, gnrc_pktsnip_t *next,
+                                void *data, size_t size, gnrc_nettype_t type)
+{
+    pkt->next = next;
+    pkt->data = data;
+    pkt->size = size;
+    pkt->type = type;
+    pkt->users = 1;
+#ifdef MODULE_GNRC_NETERR
+    pkt->err_sub = KERNEL_PID_UNDEF;
+#endif
+}
+
+void gnrc_pktbuf_init(void)
+{
+    mutex_lock(&_mutex);
+    assert((tlsf_size() + tlsf_pool_overhead()) <= GNRC_PKTBUF_TLSF_OVERHEAD);
+    _tlsf = tlsf_create_with_pool(_pool, sizeof(_pool));
+    assert(_tlsf != NULL);
+#ifdef TEST_SUITES
+    _allocs = 0;
+#endif
+#ifdef DEVELHELP
+    _used = 0;
+    _max_used = 0;
+    _failed = 0;
+    _failed_fragmented = 0;
+#endif
+    mutex_unlock(&_mutex);
+}
+
+gnrc_pktsnip_t *gnrc_pktbuf_add(gnrc_pktsnip_t *next, const void *data, size_t size,
+                                gnrc_nettype_t type)
+{
+    gnrc_pktsnip_t *pkt;
+
+    if (size > GNRC_PKTBUF_SIZE) {
+        DEBUG("pktbuf: size (%u) > GNRC_PKTBUF_SIZE (%u)\n",
+              (unsigned)size, GNRC_PKTBUF_SIZE);
+        return NULL;
+    }
+    mutex_lock(&_mutex);
+    pkt = _create_snip(next, data, size, type);
+    mutex_unlock(&_mutex);
+    return pkt;
+}
+
+static gnrc_pktsnip_t *_mark(gnrc_pktsnip_t *pkt, size_t size, gnrc_nettype_t type)
+{
+    gnrc_pktsnip_t *header;
+    void *payload;
+
+    if ((size == 0) || (pkt == NULL) || (size > pkt->size) || (pkt->data == NULL)) {
+        DEBUG("pktbuf: size == 0 (was %u) or pkt == NULL (was %p) or "
+              "size > pkt->size (was %u) or pkt->data == NULL (was %p)\n",
+              (unsigned)size, (void *)pkt, (pkt ? (unsigned)pkt->size : 0),
+              (pkt ? pkt->data : NULL));
+        return NULL;
+    }
+    /* create new snip descriptor for marked data */
+    header = _malloc(sizeof(gnrc_pktsnip_t));
+    if (header == NULL) {
+        DEBUG("pktbuf: could not reallocate marked section.\n");
+        return NULL;
+    }
+    if (pkt->size == size) {
+        _set_pktsnip(header, pkt->next, pkt->data, size, type);
+        _set_pktsnip(pkt, header, NULL, 0, pkt->type);
+        return header;
+    }
+    /* the payload is copied to a block of its own, so the block of the
+     * header can be shrunk in place */
+    payload = _malloc(pkt->size - size);
+    if (payload == NULL) {
+        DEBUG("pktbuf: could not reallocate marked section.\n");
+        _free(header);
+        return NULL;
+    }
+    memcpy(payload, ((uint8_t *)pkt->data) + size, pkt->size - size);
+    /* shrinking never fails nor moves the block */
+    _set_pktsnip(header, pkt->next, _realloc(pkt->data, size), size, type);
+    pkt->data = payload;
+    pkt->size -= size;
+    pkt->next = header;
+    return header;
+}
+
+gnrc_pktsnip_t *gnrc_pktbuf_mark(gnrc_pktsnip_t *pkt, size_t size, gnrc_nettype_t type)
+{
+    gnrc_pktsnip_t *new;
+
+    mutex_lock(&_mutex);
+    new = _mark(pkt, size, type);
+    mutex_unlock(&_mutex);
+    return new;
+}
+
+static int _realloc_data(gnrc_pktsnip_t *pkt, size_t size)
+{
+    assert(pkt != NULL);
+    assert(((pkt->size == 0) && (pkt->data == NULL)) ||
+           ((pkt->size > 0) && (pkt->data != NULL)));
+    if (size > GNRC_PKTBUF_SIZE) {
+        DEBUG("pktbuf: size (%u) > GNRC_PKTBUF_SIZE (%u)\n",
+              (unsigned)size, GNRC_PKTBUF_SIZE);
+        return ENOMEM;
+    }
+    /* new size and old size are equal */
+    if (size == pkt->size) {
+        /* nothing to do */
+        return 0;
+    }
+    /* new size is 0 and data pointer isn't already NULL */
+    if ((size == 0) && (pkt->data != NULL)) {
+        /* set data pointer to NULL */
+        _free(pkt->data);
+        pkt->data = NULL;
+    }
+    else {
+        void *data = (pkt->data) ? _realloc(pkt->data, size) : _malloc(size);
+        if (data == NULL) {
+            DEBUG("pktbuf: error allocating new data section\n");
+            return ENOMEM;
+        }
+        pkt->data = data;
+    }
+    pkt->size = size;
+    return 0;
+}
+
+int gnrc_pktbuf_realloc_data(gnrc_pktsnip_t *pkt, size_t size)
+{
+    int res;
+
+    mutex_lock(&_mutex);
+    res = _realloc_data(pkt, size);
+    mutex_unlock(&_mutex);
+    return res;
+}
+
+void gnrc_pktbuf_hold(gnrc_pktsnip_t *pkt, unsigned int num)
+{
+    mutex_lock(&_mutex);
+    while (pkt) {
+        pkt->users += num;
+        pkt = pkt->next;
+    }
+    mutex_unlock(&_mutex);
+}
+
+static void _release_error_locked(gnrc_pktsnip_t *pkt, uint32_t err)
+{
+    while (pkt) {
+        gnrc_pktsnip_t *tmp;
+        tmp = pkt->next;
+        /* report before the snip is freed, it is read for the subscriber */
+        DEBUG("pktbuf: report status code %" PRIu32 "\n", err);
+        gnrc_neterr_report(pkt, err);
+        if (pkt->users == 1) {
+            pkt->users = 0; /* not necessary but to be on the safe side */
+            _free(pkt->data);
+            _free(pkt);
+        }
+        else {
+            pkt->users--;
+        }
+        pkt = tmp;
+    }
+}
+
+void gnrc_pktbuf_release_error(gnrc_pktsnip_t *pkt, uint32_t err)
+{
+    mutex_lock(&_mutex);
+    _release_error_locked(pkt, err);
+    mutex_unlock(&_mutex);
+}
+
+gnrc_pktsnip_t *gnrc_pktbuf_start_write(gnrc_pktsnip_t *pkt)
+{
+    mutex_lock(&_mutex);
+    if ((pkt == NULL) || (pkt->size == 0)) {
+        mutex_unlock(&_mutex);
+        return NULL;
+    }
+    if (pkt->users > 1) {
+        gnrc_pktsnip_t *new;
+        new = _create_snip(pkt->next, pkt->data, pkt->size, pkt->type);
+        if (new != NULL) {
+            pkt->users--;
+        }
+        mutex_unlock(&_mutex);
+        return new;
+    }
+    mutex_unlock(&_mutex);
+    return pkt;
+}
+
+#ifdef DEVELHELP
+typedef struct {
+    unsigned free;
+    unsigned chunks;
+    unsigned largest;
+} _usage_t;
+
+static void _usage_walker(void *ptr, size_t size, int used, void *user)
+{
+    _usage_t *usage = user;
+
+    (void)ptr;
+    if (!used) {
+        usage->free += size;
+        usage->chunks++;
+        if (size > usage->largest) {
+            usage->largest = size;
+        }
+    }
+}
+
+void gnrc_pktbuf_stats(void)
+{
+    _usage_t usage = { 0, 0, 0 };
+
+    printf("packet buffer: first byte: %p, last byte: %p (size: %u)\n",
+           (void *)&_pool[0], (void *)&_pool[sizeof(_pool)],
+           (unsigned)sizeof(_pool));
+    mutex_lock(&_mutex);
+    tlsf_walk_pool(tlsf_get_pool(_tlsf), _usage_walker, &usage);
+    printf("  used: %u bytes, high watermark: %u bytes\n", _used, _max_used);
+    /* share of free bytes that are not part of the largest free chunk */
+    printf("  free: %u bytes in %u chunks, largest: %u bytes, "
+           "fragmentation: %u%%\n", usage.free, usage.chunks, usage.largest,
+           usage.free ? (100U - ((100U * usage.largest) / usage.free)) : 0);
+    printf("  failed allocations: %u, with enough free bytes: %u\n",
+           _failed, _failed_fragmented);
+    mutex_unlock(&_mutex);
+}
+#endif
+
+#ifdef TEST_SUITES
+bool gnrc_pktbuf_is_empty(void)
+{
+    return (_allocs == 0);
+}
+
+bool gnrc_pktbuf_is_sane(void)
+{
+    bool res;
+
+    mutex_lock(&_mutex);
+    res = (tlsf_check(_tlsf) == 0) &&
+          (tlsf_check_pool(tlsf_get_pool(_tlsf)) == 0);
+    mutex_unlock(&_mutex);
+    return res;
+}
+#endif
+
+static gnrc_pktsnip_t *_create_snip(gnrc_pktsnip_t *next, const void *data, size_t size,
+                                    gnrc_nettype_t type)
+{
+    gnrc_pktsnip_t *pkt = _malloc(sizeof(gnrc_pktsnip_t));
+    void *_data = NULL;
+
+    if (pkt == NULL) {
+        DEBUG("pktbuf: error allocating new packet snip\n");
+        return NULL;
+    }
+    if (size > 0) {
+        _data = _malloc(size);
+        if (_data == NULL) {
+            DEBUG("pktbuf: error allocating data for new packet snip\n");
+            _free(pkt);
+            return NULL;
+        }
+    }
+    _set_pktsnip(pkt, next, _data, size, type);
+    if (data != NULL) {
+        memcpy(_data, data, size);
+    }
+    return pkt;
+}
+
+gnrc_pktsnip_t *gnrc_pktbuf_duplicate_upto(gnrc_pktsnip_t *pkt, gnrc_nettype_t type)
+{
+    mutex_lock(&_mutex);
+
+    bool is_shared = pkt->users > 1;
+    size_t size = gnrc_pkt_len_upto(pkt, type);
+
+    DEBUG("ipv6_ext: duplicating %d octets\n", (int) size);
+
+    gnrc_pktsnip_t *tmp;
+    gnrc_pktsnip_t *target = gnrc_pktsnip_search_type(pkt, type);
+    gnrc_pktsnip_t *next = (target == NULL) ? NULL : target->next;
+    gnrc_pktsnip_t *new = _create_snip(next, NULL, size, type);
+
+    if (new == NULL) {
+        mutex_unlock(&_mutex);
+
+        return NULL;
+    }
+
+    /* copy payloads */
+    for (tmp = pkt; tmp != NULL; tmp = tmp->next) {
+        uint8_t *dest = ((uint8_t *)new->data) + (size - tmp->size);
+
+        memcpy(dest, tmp->data, tmp->size);
+
+        size -= tmp->size;
+
+        if (tmp->type == type) {
+            break;
+        }
+    }
+
+    /* decrements reference counters */
+
+    if (target != NULL) {
+        target->next = NULL;
+    }
+
+    _release_error_locked(pkt, GNRC_NETERR_SUCCESS);
+
+    if (is_shared && (target != NULL)) {
+        target->next = next;
+    }
+
+    mutex_unlock(&_mutex);
+
+    return new;
+}
+
+/** @} */
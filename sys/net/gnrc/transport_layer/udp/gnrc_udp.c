@@ -217,13 +217,46 @@ static void _send(gnrc_pktsnip_t *pkt)
     }
 }
 
+#ifdef MODULE_GNRC_NETAPI_RTC
+/**
+ * @brief   Handles received packets in the dispatching thread
+ *
+ * Receiving only uses the packet itself and the registry, so no lock is
+ * needed to do that outside of the UDP thread.
+ */
+static void _rtc_cb(uint16_t cmd, gnrc_pktsnip_t *pkt, void *ctx)
+{
+    msg_t msg;
+
+    (void)ctx;
+    /* packets queued before must not be overtaken */
+    if ((cmd == GNRC_NETAPI_MSG_TYPE_RCV) && (msg_avail_thread(_pid) == 0)) {
+        _receive(pkt);
+        return;
+    }
+    msg.type = cmd;
+    msg.content.ptr = pkt;
+    if (msg_try_send(&msg, _pid) < 1) {
+        DEBUG("udp: unable to queue packet to UDP thread\n");
+        gnrc_pktbuf_release(pkt);
+    }
+}
+#endif
+
 static void *_event_loop(void *arg)
 {
     (void)arg;
     msg_t msg, reply;
     msg_t msg_queue[GNRC_UDP_MSG_QUEUE_SIZE];
+#ifdef MODULE_GNRC_NETAPI_RTC
+    gnrc_netreg_entry_cbd_t cbd = { .cb = _rtc_cb, .ctx = NULL };
+    gnrc_netreg_entry_t netreg;
+
+    gnrc_netreg_entry_init_cb(&netreg, GNRC_NETREG_DEMUX_CTX_ALL, &cbd);
+#else
     gnrc_netreg_entry_t netreg = GNRC_NETREG_ENTRY_INIT_PID(GNRC_NETREG_DEMUX_CTX_ALL,
                                                             sched_active_pid);
+#endif
     /* preset reply message */
     reply.type = GNRC_NETAPI_MSG_TYPE_ACK;
     reply.content.value = (uint32_t)-ENOTSUP;
@@ -19,6 +19,7 @@
  * @}
  */
 
+#include <assert.h>
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
@@ -65,6 +66,376 @@ static void fib_lifetime_to_absolute(uint32_t ms, uint64_t *target)
     *target = xtimer_now_usec64() + (ms * US_PER_MS);
 }
 
+/**
+ * @brief number of bits of the trie key for an address of @p size bytes,
+ *        i.e. the size byte followed by the address
+ */
+#define FIB_TRIE_KEY_BITS(size)     (8U + ((unsigned)(size) << 3))
+
+/**
+ * @brief returns the byte @p i of the trie key for the given address
+ */
+static inline uint8_t _key_byte(const uint8_t *addr, size_t size, unsigned i)
+{
+    return (i == 0) ? (uint8_t)size : addr[i - 1];
+}
+
+/**
+ * @brief returns the bit @p pos of the trie key for the given address
+ */
+static inline unsigned _key_bit(const uint8_t *addr, size_t size, unsigned pos)
+{
+    return (_key_byte(addr, size, pos >> 3) >> (7 - (pos & 0x07))) & 0x01;
+}
+
+/**
+ * @brief returns the first bit the trie keys of two addresses differ in,
+ *        or @p len if their first @p len bits are equal
+ */
+static unsigned _key_diff(const uint8_t *a, size_t a_size,
+                          const uint8_t *b, size_t b_size, unsigned len)
+{
+    for (unsigned i = 0; (i << 3) < len; i++) {
+        uint8_t xor = _key_byte(a, a_size, i) ^ _key_byte(b, b_size, i);
+
+        if (xor != 0) {
+            unsigned pos = i << 3;
+
+            while (!(xor & 0x80)) {
+                xor <<= 1;
+                pos++;
+            }
+            return (pos < len) ? pos : len;
+        }
+    }
+    return len;
+}
+
+/**
+ * @brief returns the length of the trie key an entry is indexed by
+ *
+ * The all-zero address is the default route, an entry without prefix length
+ * only matches its exact address. universal_address_compare() only
+ * guarantees the full bytes of a prefix to match, so prefixes are indexed by
+ * those and fib_find_entry() compares the entries on the path in full.
+ */
+static unsigned _entry_key_len(fib_entry_t *entry)
+{
+    size_t size = entry->global->address_size;
+    unsigned bits = size << 3;
+    unsigned prefix_len = (entry->global_flags & FIB_FLAG_NET_PREFIX_MASK)
+                          >> FIB_FLAG_NET_PREFIX_SHIFT;
+    bool is_all_zeros_addr = true;
+
+    for (size_t i = 0; i < size; ++i) {
+        if (entry->global->address[i] != 0) {
+            is_all_zeros_addr = false;
+            break;
+        }
+    }
+
+    if (is_all_zeros_addr) {
+        prefix_len = 0;
+    }
+    else if ((prefix_len == 0) || (prefix_len > bits)) {
+        prefix_len = bits;
+    }
+    else {
+        prefix_len &= ~0x07U;
+    }
+    return FIB_TRIE_KEY_BITS(0) + prefix_len;
+}
+
+/**
+ * @brief puts all trie nodes of the table back to its free list
+ */
+static void fib_trie_reset(fib_table_t *table)
+{
+    table->trie_root = NULL;
+    table->trie_free = NULL;
+
+    for (size_t i = table->size; i > 0; --i) {
+        for (int j = 1; j >= 0; --j) {
+            fib_trie_node_t *node = &table->data.entries[i - 1].trie_nodes[j];
+
+            node->child[0] = table->trie_free;
+            table->trie_free = node;
+        }
+    }
+}
+
+/**
+ * @brief takes a node from the free list of the table
+ *
+ * A trie with n prefixes has at most 2n - 1 nodes, so the two nodes stored
+ * with each entry always suffice.
+ */
+static fib_trie_node_t *fib_trie_node_alloc(fib_table_t *table, unsigned len)
+{
+    fib_trie_node_t *node = table->trie_free;
+
+    assert(node != NULL);
+    table->trie_free = node->child[0];
+    memset(node, 0, sizeof(fib_trie_node_t));
+    node->len = len;
+    return node;
+}
+
+static void fib_trie_node_free(fib_table_t *table, fib_trie_node_t *node)
+{
+    node->entries = NULL;
+    node->child[1] = NULL;
+    node->child[0] = table->trie_free;
+    table->trie_free = node;
+}
+
+/**
+ * @brief returns any entry in the sub-trie of @p node, all of them share
+ *        its prefix
+ */
+static fib_entry_t *fib_trie_any_entry(fib_trie_node_t *node)
+{
+    while (node->entries == NULL) {
+        node = (node->child[0] != NULL) ? node->child[0] : node->child[1];
+    }
+    return node->entries;
+}
+
+/**
+ * @brief adds an entry to the trie of the table
+ *
+ * @param[in] table the FIB table the entry belongs to
+ * @param[in] entry the entry with its global address and flags set
+ */
+static void fib_trie_insert(fib_table_t *table, fib_entry_t *entry)
+{
+    uint8_t *key = entry->global->address;
+    size_t size = entry->global->address_size;
+    unsigned len = _entry_key_len(entry);
+    fib_trie_node_t **slot = &table->trie_root;
+    fib_trie_node_t *node = table->trie_root;
+    fib_trie_node_t *new_node;
+    fib_entry_t *rep;
+    unsigned diff;
+
+    entry->next = NULL;
+
+    if (node == NULL) {
+        table->trie_root = fib_trie_node_alloc(table, len);
+        table->trie_root->entries = entry;
+        return;
+    }
+
+    /* find the deepest node on the path of the new prefix ... */
+    while ((node->len < len) &&
+           (node->child[_key_bit(key, size, node->len)] != NULL)) {
+        node = node->child[_key_bit(key, size, node->len)];
+    }
+
+    /* ... to get the bit the new prefix parts from the trie at */
+    rep = fib_trie_any_entry(node);
+    diff = _key_diff(key, size, rep->global->address,
+                     rep->global->address_size,
+                     (node->len < len) ? node->len : len);
+
+    node = table->trie_root;
+    while (node->len < diff) {
+        slot = &node->child[_key_bit(key, size, node->len)];
+        node = *slot;
+    }
+
+    if ((diff == len) && (node->len == len)) {
+        /* keep the entries of a node ordered as in the table */
+        fib_entry_t **pos = &node->entries;
+
+        while ((*pos != NULL) && (*pos < entry)) {
+            pos = &(*pos)->next;
+        }
+        entry->next = *pos;
+        *pos = entry;
+        return;
+    }
+
+    new_node = fib_trie_node_alloc(table, len);
+    new_node->entries = entry;
+
+    if (diff == len) {
+        /* the new prefix is a prefix of the node's one */
+        new_node->child[_key_bit(rep->global->address,
+                                 rep->global->address_size, len)] = node;
+        *slot = new_node;
+    }
+    else if (node->len == diff) {
+        /* the node's prefix is a prefix of the new one */
+        assert(node->child[_key_bit(key, size, diff)] == NULL);
+        node->child[_key_bit(key, size, diff)] = new_node;
+    }
+    else {
+        /* both prefixes part at bit diff, so we branch there */
+        fib_trie_node_t *branch = fib_trie_node_alloc(table, diff);
+
+        branch->child[_key_bit(key, size, diff)] = new_node;
+        branch->child[_key_bit(rep->global->address,
+                               rep->global->address_size, diff)] = node;
+        *slot = branch;
+    }
+}
+
+/**
+ * @brief removes an entry from the trie of the table
+ *
+ * @param[in] table the FIB table the entry belongs to
+ * @param[in] entry the entry, it is ignored if it is not in the trie
+ */
+static void fib_trie_remove(fib_table_t *table, fib_entry_t *entry)
+{
+    uint8_t *key = entry->global->address;
+    size_t size = entry->global->address_size;
+    unsigned len = _entry_key_len(entry);
+    fib_trie_node_t **parent = NULL;
+    fib_trie_node_t **slot = &table->trie_root;
+    fib_trie_node_t *node = table->trie_root;
+    fib_trie_node_t *child;
+    fib_entry_t **pos;
+
+    while ((node != NULL) && (node->len < len)) {
+        parent = slot;
+        slot = &node->child[_key_bit(key, size, node->len)];
+        node = *slot;
+    }
+
+    if ((node == NULL) || (node->len != len)) {
+        return;
+    }
+
+    for (pos = &node->entries; (*pos != NULL) && (*pos != entry);
+         pos = &(*pos)->next) {}
+    if (*pos == NULL) {
+        return;
+    }
+    *pos = entry->next;
+    entry->next = NULL;
+
+    if ((node->entries != NULL) ||
+        ((node->child[0] != NULL) && (node->child[1] != NULL))) {
+        /* the node still holds entries or branches */
+        return;
+    }
+
+    child = (node->child[0] != NULL) ? node->child[0] : node->child[1];
+    *slot = child;
+    fib_trie_node_free(table, node);
+
+    if ((child == NULL) && (parent != NULL) && ((*parent)->entries == NULL)) {
+        /* the parent branched to the removed node, so it has one child left */
+        node = *parent;
+        *parent = (node->child[0] != NULL) ? node->child[0] : node->child[1];
+        fib_trie_node_free(table, node);
+    }
+}
+
+/**
+ * @brief removes the given entry
+ *
+ * @param[in] table the FIB table the entry belongs to
+ * @param[in] entry the entry to be removed
+ *
+ * @return 0 on success
+ */
+static int fib_remove(fib_table_t *table, fib_entry_t *entry)
+{
+    if (entry->global != NULL) {
+        if (entry->lifetime != 0) {
+            fib_trie_remove(table, entry);
+        }
+        universal_address_rem(entry->global);
+    }
+
+    if (entry->next_hop) {
+        universal_address_rem(entry->next_hop);
+    }
+
+    entry->global = NULL;
+    entry->global_flags = 0;
+    entry->next_hop = NULL;
+    entry->next_hop_flags = 0;
+
+    entry->iface_id = KERNEL_PID_UNDEF;
+    entry->lifetime = 0;
+
+    return 0;
+}
+
+/**
+ * @brief sets the expiry timer of the table if @p lifetime is earlier than
+ *        the time it is currently set to
+ *
+ * @param[in] table     the FIB table
+ * @param[in] lifetime  absolute lifetime of an entry in us
+ */
+static void fib_expiry_set(fib_table_t *table, uint64_t lifetime)
+{
+    if (lifetime >= table->next_expiry) {
+        return;
+    }
+
+    uint64_t now = xtimer_now_usec64();
+
+    table->next_expiry = lifetime;
+    if (lifetime <= now) {
+        xtimer_remove(&table->expiry_timer);
+        table->expired = true;
+    }
+    else {
+        xtimer_set64(&table->expiry_timer, lifetime - now);
+    }
+}
+
+/**
+ * @brief removes all entries whose lifetime expired, if the expiry timer
+ *        fired since the last call
+ *
+ * @param[in] table     the FIB table
+ */
+static void fib_expire(fib_table_t *table)
+{
+    if (!table->expired) {
+        return;
+    }
+
+    uint64_t now = xtimer_now_usec64();
+    uint64_t next = FIB_LIFETIME_NO_EXPIRE;
+
+    table->expired = false;
+
+    for (size_t i = 0; i < table->size; ++i) {
+        fib_entry_t *entry = &table->data.entries[i];
+
+        if ((entry->lifetime == 0) || (entry->lifetime == FIB_LIFETIME_NO_EXPIRE)) {
+            continue;
+        }
+        if (entry->lifetime < now) {
+            /* remove this entry if its lifetime expired */
+            fib_remove(table, entry);
+        }
+        else if (entry->lifetime < next) {
+            next = entry->lifetime;
+        }
+    }
+
+    table->next_expiry = FIB_LIFETIME_NO_EXPIRE;
+    if (next != FIB_LIFETIME_NO_EXPIRE) {
+        fib_expiry_set(table, next);
+    }
+}
+
+static void _expiry_cb(void *arg)
+{
+    fib_table_t *table = arg;
+
+    table->expired = true;
+}
+
 /**
  * @brief returns pointer to the entry for the given destination address
  *
@@ -81,12 +452,10 @@ static void fib_lifetime_to_absolute(uint32_t ms, uint64_t *target)
  */
 static int fib_find_entry(fib_table_t *table, uint8_t *dst, size_t dst_size,
                           fib_entry_t **entry_arr, size_t *entry_arr_size) {
-    uint64_t now = xtimer_now_usec64();
-
-    size_t count = 0;
+    unsigned key_bits = FIB_TRIE_KEY_BITS(dst_size);
+    fib_trie_node_t *node = table->trie_root;
+    fib_entry_t *match = NULL;
     size_t prefix_size = 0;
-    size_t match_size = dst_size << 3;
-    int ret = -EHOSTUNREACH;
     bool is_all_zeros_addr = true;
 
 #if ENABLE_DEBUG
@@ -104,94 +473,86 @@ static int fib_find_entry(fib_table_t *table, uint8_t *dst, size_t dst_size,
         }
     }
 
-    for (size_t i = 0; i < table->size; ++i) {
-
-        /* autoinvalidate if the entry lifetime is not set to not expire */
-        if (table->data.entries[i].lifetime != FIB_LIFETIME_NO_EXPIRE) {
-
-            /* check if the lifetime expired */
-            if (table->data.entries[i].lifetime < now) {
-                /* remove this entry if its lifetime expired */
-                table->data.entries[i].lifetime = 0;
-                table->data.entries[i].global_flags = 0;
-                table->data.entries[i].next_hop_flags = 0;
-                table->data.entries[i].iface_id = KERNEL_PID_UNDEF;
+    fib_expire(table);
 
-                if (table->data.entries[i].global != NULL) {
-                    universal_address_rem(table->data.entries[i].global);
-                    table->data.entries[i].global = NULL;
-                }
+    /* all entries that may match dst are on its path through the trie, the
+     * branching nodes skip bits, so every key is compared in full */
+    while ((node != NULL) && (node->len <= key_bits)) {
+        if (node->entries != NULL) {
+            fib_entry_t *entry = node->entries;
 
-                if (table->data.entries[i].next_hop != NULL) {
-                    universal_address_rem(table->data.entries[i].next_hop);
-                    table->data.entries[i].next_hop = NULL;
-                }
+            if (_key_diff(entry->global->address, entry->global->address_size,
+                          dst, dst_size, node->len) < node->len) {
+                /* the keys below extend this one, so none of them match */
+                break;
             }
-        }
 
-        if ((prefix_size < (dst_size<<3)) && (table->data.entries[i].global != NULL)) {
-
-            int ret_comp = universal_address_compare(table->data.entries[i].global, dst, &match_size);
-            /* If we found an exact match */
-            if ((ret_comp == UNIVERSAL_ADDRESS_EQUAL)
-                || (is_all_zeros_addr && (ret_comp == UNIVERSAL_ADDRESS_IS_ALL_ZERO_ADDRESS))) {
-                entry_arr[0] = &(table->data.entries[i]);
-                *entry_arr_size = 1;
-                /* we will not find a better one so we return */
-                return 1;
-            }
-            else {
+            for (; entry != NULL; entry = entry->next) {
+                size_t match_size = dst_size << 3;
+                int ret_comp = universal_address_compare(entry->global, dst,
+                                                         &match_size);
+                /* If we found an exact match */
+                if ((ret_comp == UNIVERSAL_ADDRESS_EQUAL)
+                    || (is_all_zeros_addr && (ret_comp == UNIVERSAL_ADDRESS_IS_ALL_ZERO_ADDRESS))) {
+                    entry_arr[0] = entry;
+                    *entry_arr_size = 1;
+                    /* we will not find a better one so we return */
+                    return 1;
+                }
                 /* we try to find the most fitting prefix */
-                if (ret_comp == UNIVERSAL_ADDRESS_MATCHING_PREFIX) {
-                    if (table->data.entries[i].global_flags & FIB_FLAG_NET_PREFIX_MASK) {
-                        /* we shift the most upper flag byte back to get the number of prefix bits */
-                        size_t global_prefix_len = (table->data.entries[i].global_flags
-                                                    & FIB_FLAG_NET_PREFIX_MASK) >> FIB_FLAG_NET_PREFIX_SHIFT;
-
-                        if ((match_size >= global_prefix_len) &&
-                            ((prefix_size == 0) || (match_size > prefix_size))) {
-                            entry_arr[0] = &(table->data.entries[i]);
-                            /* we could find a better one so we move on */
-                            ret = 0;
-
-                            prefix_size = match_size;
-                            count = 1;
-                        }
+                if ((ret_comp == UNIVERSAL_ADDRESS_MATCHING_PREFIX) &&
+                    (entry->global_flags & FIB_FLAG_NET_PREFIX_MASK)) {
+                    /* we shift the most upper flag byte back to get the number of prefix bits */
+                    size_t global_prefix_len = (entry->global_flags
+                                                & FIB_FLAG_NET_PREFIX_MASK) >> FIB_FLAG_NET_PREFIX_SHIFT;
+
+                    /* on a tie the entry first in the table wins, as it did
+                     * when the table was scanned */
+                    if ((match_size >= global_prefix_len) &&
+                        ((prefix_size == 0) || (match_size > prefix_size) ||
+                         ((match_size == prefix_size) && (entry < match)))) {
+                        match = entry;
+                        prefix_size = match_size;
                     }
-                 }
-                 else if (ret_comp == UNIVERSAL_ADDRESS_IS_ALL_ZERO_ADDRESS) {
+                }
+                else if ((ret_comp == UNIVERSAL_ADDRESS_IS_ALL_ZERO_ADDRESS) &&
+                         (prefix_size == 0)) {
                     /* we found the default gateway entry, e.g. ::/0 for IPv6
                      * and we keep it only if there is no better one
                      */
-                    if (prefix_size == 0) {
-                        entry_arr[0] = &(table->data.entries[i]);
-                        /* we could find a better one so we move on */
-                        ret = 0;
-                        count = 1;
-                    }
+                    match = entry;
                 }
-                match_size = dst_size<<3;
             }
         }
+
+        if (node->len == key_bits) {
+            break;
+        }
+        node = node->child[_key_bit(dst, dst_size, node->len)];
+    }
+
+    if (match == NULL) {
+        *entry_arr_size = 0;
+        return -EHOSTUNREACH;
     }
 
 #if ENABLE_DEBUG
-    if (count > 0) {
-        DEBUG("[fib_find_entry] found prefix on interface %d:", entry_arr[0]->iface_id);
-        for (size_t i = 0; i < entry_arr[0]->global->address_size; i++) {
-            DEBUG(" %02x", entry_arr[0]->global->address[i]);
-        }
-        DEBUG("\n");
+    DEBUG("[fib_find_entry] found prefix on interface %d:", match->iface_id);
+    for (size_t i = 0; i < match->global->address_size; i++) {
+        DEBUG(" %02x", match->global->address[i]);
     }
+    DEBUG("\n");
 #endif
 
-    *entry_arr_size = count;
-    return ret;
+    entry_arr[0] = match;
+    *entry_arr_size = 1;
+    return 0;
 }
 
 /**
  * @brief updates the next hop the lifetime and the interface id for a given entry
  *
+ * @param[in] table          the FIB table the entry belongs to
  * @param[in] entry          the entry to be updated
  * @param[in] next_hop       the next hop address to be updated
  * @param[in] next_hop_size  the next hop address size
@@ -201,7 +562,7 @@ static int fib_find_entry(fib_table_t *table, uint8_t *dst, size_t dst_size,
  * @return 0 if the entry has been updated
  *         -ENOMEM if the entry cannot be updated due to insufficient RAM
  */
-static int fib_upd_entry(fib_entry_t *entry, uint8_t *next_hop,
+static int fib_upd_entry(fib_table_t *table, fib_entry_t *entry, uint8_t *next_hop,
                          size_t next_hop_size, uint32_t next_hop_flags,
                          uint32_t lifetime)
 {
@@ -217,6 +578,7 @@ static int fib_upd_entry(fib_entry_t *entry, uint8_t *next_hop,
 
     if (lifetime != (uint32_t)FIB_LIFETIME_NO_EXPIRE) {
         fib_lifetime_to_absolute(lifetime, &entry->lifetime);
+        fib_expiry_set(table, entry->lifetime);
     }
     else {
         entry->lifetime = FIB_LIFETIME_NO_EXPIRE;
@@ -263,47 +625,27 @@ static int fib_create_entry(fib_table_t *table, kernel_pid_t iface_id,
 
                 if (lifetime != (uint32_t) FIB_LIFETIME_NO_EXPIRE) {
                     fib_lifetime_to_absolute(lifetime, &table->data.entries[i].lifetime);
+                    fib_expiry_set(table, table->data.entries[i].lifetime);
                 }
                 else {
                     table->data.entries[i].lifetime = FIB_LIFETIME_NO_EXPIRE;
                 }
 
+                fib_trie_insert(table, &table->data.entries[i]);
                 return 0;
             }
+
+            /* don't leave a half set up entry behind */
+            universal_address_rem(table->data.entries[i].global);
+            table->data.entries[i].global = NULL;
+            table->data.entries[i].global_flags = 0;
+            return -ENOMEM;
         }
     }
 
     return -ENOMEM;
 }
 
-/**
- * @brief removes the given entry
- *
- * @param[in] entry the entry to be removed
- *
- * @return 0 on success
- */
-static int fib_remove(fib_entry_t *entry)
-{
-    if (entry->global != NULL) {
-        universal_address_rem(entry->global);
-    }
-
-    if (entry->next_hop) {
-        universal_address_rem(entry->next_hop);
-    }
-
-    entry->global = NULL;
-    entry->global_flags = 0;
-    entry->next_hop = NULL;
-    entry->next_hop_flags = 0;
-
-    entry->iface_id = KERNEL_PID_UNDEF;
-    entry->lifetime = 0;
-
-    return 0;
-}
-
 /**
  * @brief signals (sends a message to) all registered routing protocols
  *        registered with a matching prefix (usually this should be only one).
@@ -403,7 +745,7 @@ int fib_add_entry(fib_table_t *table,
 
     if (ret == 1) {
         /* we must take the according entry and update the values */
-        ret = fib_upd_entry(entry[0], next_hop, next_hop_size, next_hop_flags, lifetime);
+        ret = fib_upd_entry(table, entry[0], next_hop, next_hop_size, next_hop_flags, lifetime);
     }
     else {
         ret = fib_create_entry(table, iface_id, dst, dst_size, dst_flags,
@@ -433,7 +775,7 @@ int fib_update_entry(fib_table_t *table, uint8_t *dst, size_t dst_size,
     if (fib_find_entry(table, dst, dst_size, &(entry[0]), &count) == 1) {
         DEBUG("[fib_update_entry] found entry: %p\n", (void *)(entry[0]));
         /* we must take the according entry and update the values */
-        ret = fib_upd_entry(entry[0], next_hop, next_hop_size, next_hop_flags, lifetime);
+        ret = fib_upd_entry(table, entry[0], next_hop, next_hop_size, next_hop_flags, lifetime);
     }
     else {
         /* we have ambiguous entries, i.e. count > 1
@@ -457,7 +799,7 @@ void fib_remove_entry(fib_table_t *table, uint8_t *dst, size_t dst_size)
 
     if (ret == 1) {
         /* we must take the according entry and update the values */
-        fib_remove(entry[0]);
+        fib_remove(table, entry[0]);
     }
     else {
         /* we have ambiguous entries, i.e. count > 1
@@ -477,7 +819,7 @@ void fib_flush(fib_table_t *table, kernel_pid_t interface)
     for (size_t i = 0; i < table->size; ++i) {
         if ((interface == KERNEL_PID_UNDEF) ||
             (interface == table->data.entries[i].iface_id)) {
-            fib_remove(&table->data.entries[i]);
+            fib_remove(table, &table->data.entries[i]);
         }
     }
 
@@ -547,6 +889,8 @@ int fib_get_destination_set(fib_table_t *table, uint8_t *prefix,
     int ret = -EHOSTUNREACH;
     size_t found_entries = 0;
 
+    fib_expire(table);
+
     for (size_t i = 0; i < table->size; ++i) {
         if ((table->data.entries[i].global != NULL) &&
             (universal_address_compare_prefix(table->data.entries[i].global, prefix, prefix_size<<3) >= UNIVERSAL_ADDRESS_EQUAL)) {
@@ -596,6 +940,11 @@ void fib_init(fib_table_t *table)
     }
     else {
         memset(table->data.entries, 0, (table->size * sizeof(fib_entry_t)));
+        fib_trie_reset(table);
+        table->expiry_timer.callback = _expiry_cb;
+        table->expiry_timer.arg = table;
+        table->next_expiry = FIB_LIFETIME_NO_EXPIRE;
+        table->expired = false;
     }
     universal_address_init();
     mutex_unlock(&(table->mtx_access));
@@ -620,7 +969,11 @@ void fib_deinit(fib_table_t *table)
                sizeof(fib_sr_entry_t) * table->data.source_routes->entry_pool_size);
     }
     else {
+        xtimer_remove(&table->expiry_timer);
         memset(table->data.entries, 0, (table->size * sizeof(fib_entry_t)));
+        fib_trie_reset(table);
+        table->next_expiry = FIB_LIFETIME_NO_EXPIRE;
+        table->expired = false;
     }
     universal_address_reset();
     mutex_unlock(&(table->mtx_access));
@@ -657,6 +1010,10 @@ int fib_get_num_used_entries(fib_table_t *table)
     mutex_lock(&(table->mtx_access));
     size_t used_entries = 0;
 
+    if (table->table_type == FIB_TABLE_TYPE_SH) {
+        fib_expire(table);
+    }
+
     for (size_t i = 0; i < table->size; ++i) {
         used_entries += (size_t)(table->data.entries[i].global != NULL);
     }
@@ -46,6 +46,48 @@ static const char *state_names[] = {
     [STATUS_MBOX_BLOCKED] = "bl mbox",
 };
 
+#ifdef MODULE_SCHEDSTATISTICS_HIST
+static const char *hist_names[] = {
+    [SCHEDSTAT_HIST_WAKE_TO_RUN] = "wake",
+    [SCHEDSTAT_HIST_RUN_SLICE] = "slice",
+};
+
+/**
+ * @brief Prints the scheduler histograms of all threads
+ */
+static void _print_histograms(void)
+{
+    uint32_t buckets[SCHEDSTAT_HIST_BUCKETS];
+
+    puts("\n\tscheduler histograms, column n counts [2^n, 2^(n+1)) ticks");
+    printf("\tpid | hist  |");
+    for (unsigned n = 0; n < SCHEDSTAT_HIST_BUCKETS; n++) {
+        printf(" %6u", n);
+    }
+    puts("");
+
+    for (kernel_pid_t i = KERNEL_PID_FIRST; i <= KERNEL_PID_LAST; i++) {
+        if (sched_threads[i] == NULL) {
+            continue;
+        }
+        for (unsigned h = 0; h < SCHEDSTAT_HIST_NUMOF; h++) {
+            sched_stat_histogram(i, h, buckets);
+            if (h == 0) {
+                printf("\t%3" PRIkernel_pid, i);
+            }
+            else {
+                printf("\t   ");
+            }
+            printf(" | %-5s |", hist_names[h]);
+            for (unsigned n = 0; n < SCHEDSTAT_HIST_BUCKETS; n++) {
+                printf(" %6lu", (unsigned long)buckets[n]);
+            }
+            puts("");
+        }
+    }
+}
+#endif
+
 /**
  * @brief Prints a list of running threads including stack usage to stdout.
  */
@@ -153,4 +195,8 @@ void ps(void)
     printf("\tTotal used size: %u\n", sizes.used);
 #   endif
 #endif
+
+#ifdef MODULE_SCHEDSTATISTICS_HIST
+    _print_histograms();
+#endif
 }
@@ -0,0 +1,143 @@
+/*
+ * Copyright (C) 2026 agent <agent@local>
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     sys_trace_rec
+ * @{
+ *
+ * @file
+ * @brief       Trace recorder implementation
+ *
+ * @author      agent <agent@local>
+ *
+ * @}
+ */
+
+#include <stdbool.h>
+#include <stdio.h>
+
+#include "irq.h"
+#include "msg.h"
+#include "sched.h"
+#include "thread.h"
+#include "trace_rec.h"
+#include "xtimer.h"
+
+#if (TRACE_REC_NUMOF & (TRACE_REC_NUMOF - 1))
+#error "TRACE_REC_NUMOF must be a power of 2"
+#endif
+
+#if (KERNEL_PID_ISR > UINT8_MAX)
+#error "trace_rec stores pids as uint8_t"
+#endif
+
+/* fits "<time> <event> <pid> <peer> <arg> " plus a span name */
+#define LINE_LEN        (80U)
+
+static const char *_names[] = {
+    [TRACE_REC_SWITCH] = "switch",
+    [TRACE_REC_ISR_ENTER] = "isr_enter",
+    [TRACE_REC_ISR_EXIT] = "isr_exit",
+    [TRACE_REC_MSG_SEND] = "msg_send",
+    [TRACE_REC_MSG_RECV] = "msg_recv",
+    [TRACE_REC_SPAN_BEGIN] = "span_begin",
+    [TRACE_REC_SPAN_END] = "span_end",
+};
+
+static trace_rec_t _buf[TRACE_REC_NUMOF];
+static unsigned _next;
+static bool _wrapped;
+static bool _paused;
+
+static void _add(trace_rec_type_t type, kernel_pid_t pid, unsigned peer,
+                 uintptr_t arg)
+{
+    unsigned state = irq_disable();
+
+    if (!_paused) {
+        trace_rec_t *rec = &_buf[_next];
+
+        rec->time = xtimer_now().ticks32;
+        rec->arg = arg;
+        rec->type = type;
+        rec->pid = pid;
+        rec->peer = peer;
+        _next = (_next + 1) & (TRACE_REC_NUMOF - 1);
+        if (_next == 0) {
+            _wrapped = true;
+        }
+    }
+
+    irq_restore(state);
+}
+
+void trace_rec_add(trace_rec_type_t type, unsigned peer, uintptr_t arg)
+{
+    _add(type, irq_is_in() ? KERNEL_PID_ISR : sched_active_pid, peer, arg);
+}
+
+void trace_rec_switch(kernel_pid_t prev, kernel_pid_t next)
+{
+    _add(TRACE_REC_SWITCH, next, (prev == KERNEL_PID_UNDEF) ? 0 : prev, 0);
+}
+
+void trace_rec_dump(trace_rec_write_t write, void *arg)
+{
+    char line[LINE_LEN];
+    int len;
+
+    unsigned state = irq_disable();
+    _paused = true;
+    irq_restore(state);
+
+    len = snprintf(line, sizeof(line), "# trace_rec 1 %lu %u\n",
+                   (unsigned long)XTIMER_HZ, (unsigned)KERNEL_PID_ISR);
+    write(arg, line, len);
+
+    for (kernel_pid_t pid = KERNEL_PID_FIRST; pid <= KERNEL_PID_LAST; pid++) {
+        if (sched_threads[pid] == NULL) {
+            continue;
+        }
+        const char *name = thread_getname(pid);
+        len = snprintf(line, sizeof(line), "T %u %s\n", (unsigned)pid,
+                       name ? name : "-");
+        write(arg, line, len);
+    }
+
+    unsigned first = _wrapped ? _next : 0;
+    unsigned numof = _wrapped ? TRACE_REC_NUMOF : _next;
+    for (unsigned i = 0; i < numof; i++) {
+        const trace_rec_t *rec = &_buf[(first + i) & (TRACE_REC_NUMOF - 1)];
+        const char *span = "";
+
+        if ((rec->type == TRACE_REC_SPAN_BEGIN) ||
+            (rec->type == TRACE_REC_SPAN_END)) {
+            span = (const char *)rec->arg;
+        }
+        len = snprintf(line, sizeof(line), "%lu %s %u %u %lu %s\n",
+                       (unsigned long)rec->time, _names[rec->type],
+                       (unsigned)rec->pid, (unsigned)rec->peer,
+                       (unsigned long)rec->arg, span);
+        if (len >= (int)sizeof(line)) {
+            /* span name was cut */
+            line[sizeof(line) - 2] = '\n';
+            len = sizeof(line) - 1;
+        }
+        write(arg, line, len);
+    }
+
+    _paused = false;
+}
+
+void trace_rec_clear(void)
+{
+    unsigned state = irq_disable();
+    _next = 0;
+    _wrapped = false;
+    irq_restore(state);
+}
@@ -46,6 +46,21 @@
 #   define UNIVERSAL_ADDRESS_MAX_ENTRIES    (UA_ADD0)
 #endif
 
+/**
+ * @brief Number of hash buckets to find an entry by its address
+ *
+ * An address is found after comparing to
+ * (UNIVERSAL_ADDRESS_MAX_ENTRIES / UNIVERSAL_ADDRESS_HASH_SIZE) entries on
+ * average.
+ */
+#ifndef UNIVERSAL_ADDRESS_HASH_SIZE
+#   if UNIVERSAL_ADDRESS_MAX_ENTRIES > 0
+#       define UNIVERSAL_ADDRESS_HASH_SIZE  (UNIVERSAL_ADDRESS_MAX_ENTRIES)
+#   else
+#       define UNIVERSAL_ADDRESS_HASH_SIZE  (1)
+#   endif
+#endif
+
 /**
  * @brief counter indicating the number of entries allocated
  */
@@ -56,11 +71,68 @@ static size_t universal_address_table_filled = 0;
  */
 static universal_address_container_t universal_address_table[UNIVERSAL_ADDRESS_MAX_ENTRIES];
 
+/**
+ * @brief the entries in use, chained per hash of their address
+ */
+static universal_address_container_t *universal_address_buckets[UNIVERSAL_ADDRESS_HASH_SIZE];
+
+/**
+ * @brief the next entry in the same bucket, or in the free list, of the
+ *        entry at the same index in universal_address_table
+ */
+static universal_address_container_t *universal_address_next[UNIVERSAL_ADDRESS_MAX_ENTRIES];
+
+/**
+ * @brief the entries not in use
+ */
+static universal_address_container_t *universal_address_free;
+
+/**
+ * @brief memory usage statistics
+ */
+static universal_address_stats_t universal_address_stats;
+
 /**
  * @brief access mutex to control exclusive operations on calls
  */
 static mutex_t mtx_access = MUTEX_INIT;
 
+static inline universal_address_container_t **_next(universal_address_container_t *entry)
+{
+    return &universal_address_next[entry - universal_address_table];
+}
+
+/**
+ * @brief returns the hash bucket of the given address (FNV-1a)
+ */
+static universal_address_container_t **_bucket(uint8_t *addr, size_t addr_size)
+{
+    uint32_t hash = 2166136261U;
+
+    hash = (hash ^ addr_size) * 16777619U;
+    for (size_t i = 0; i < addr_size; ++i) {
+        hash = (hash ^ addr[i]) * 16777619U;
+    }
+    return &universal_address_buckets[hash % UNIVERSAL_ADDRESS_HASH_SIZE];
+}
+
+/**
+ * @brief puts all entries into the free list
+ */
+static void _clear_index(void)
+{
+    memset(universal_address_buckets, 0, sizeof(universal_address_buckets));
+    universal_address_free = NULL;
+
+    /* cppcheck-suppress unsignedLessThanZero
+     * (reason: UNIVERSAL_ADDRESS_MAX_ENTRIES may be zero in which case this
+     * code is optimized out) */
+    for (size_t i = UNIVERSAL_ADDRESS_MAX_ENTRIES; i > 0; --i) {
+        universal_address_next[i - 1] = universal_address_free;
+        universal_address_free = &universal_address_table[i - 1];
+    }
+}
+
 /**
  * @brief finds the universal address container for the given address
  *
@@ -72,14 +144,11 @@ static mutex_t mtx_access = MUTEX_INIT;
  */
 static universal_address_container_t *universal_address_find_entry(uint8_t *addr, size_t addr_size)
 {
-    /* cppcheck-suppress unsignedLessThanZero
-     * (reason: UNIVERSAL_ADDRESS_MAX_ENTRIES may be zero in which case this
-     * code is optimized out) */
-    for (size_t i = 0; i < UNIVERSAL_ADDRESS_MAX_ENTRIES; ++i) {
-        if (universal_address_table[i].address_size == addr_size) {
-            if (memcmp((universal_address_table[i].address), addr, addr_size) == 0) {
-                return &(universal_address_table[i]);
-            }
+    for (universal_address_container_t *entry = *_bucket(addr, addr_size);
+         entry != NULL; entry = *_next(entry)) {
+        if ((entry->address_size == addr_size) &&
+            (memcmp(entry->address, addr, addr_size) == 0)) {
+            return entry;
         }
     }
 
@@ -87,27 +156,50 @@ static universal_address_container_t *universal_address_find_entry(uint8_t *addr
 }
 
 /**
- * @brief finds the next empty or unused universal address containers
+ * @brief takes the next unused universal address container from the free list
+ *        and adds it to the bucket of the given address
  *
  * @return pointer to the next free/unused universal_address_container_t
  *         or NULL if no memory is left in universal_address_table
  */
-static universal_address_container_t *universal_address_get_next_unused_entry(void)
+static universal_address_container_t *universal_address_get_next_unused_entry(uint8_t *addr,
+                                                                              size_t addr_size)
 {
-    /* cppcheck-suppress unsignedLessThanZero
-     * (reason: UNIVERSAL_ADDRESS_MAX_ENTRIES may be zero in which case this
-     * code is optimized out) */
-    if (universal_address_table_filled < UNIVERSAL_ADDRESS_MAX_ENTRIES) {
-        /* cppcheck-suppress unsignedLessThanZero
-         * (reason: UNIVERSAL_ADDRESS_MAX_ENTRIES may be zero, see above) */
-        for (size_t i = 0; i < UNIVERSAL_ADDRESS_MAX_ENTRIES; ++i) {
-            if (universal_address_table[i].use_count == 0) {
-                return &(universal_address_table[i]);
-            }
-        }
+    universal_address_container_t *entry;
+
+    if ((universal_address_free == NULL) && (universal_address_table_filled == 0)) {
+        /* universal_address_init() was not called yet */
+        _clear_index();
     }
 
-    return NULL;
+    entry = universal_address_free;
+    if (entry != NULL) {
+        universal_address_container_t **bucket = _bucket(addr, addr_size);
+
+        universal_address_free = *_next(entry);
+        *_next(entry) = *bucket;
+        *bucket = entry;
+    }
+
+    return entry;
+}
+
+/**
+ * @brief removes an universal address container from its bucket and puts it
+ *        back to the free list
+ */
+static void universal_address_release_entry(universal_address_container_t *entry)
+{
+    universal_address_container_t **ptr = _bucket(entry->address, entry->address_size);
+
+    while ((*ptr != NULL) && (*ptr != entry)) {
+        ptr = _next(*ptr);
+    }
+    if (*ptr != NULL) {
+        *ptr = *_next(entry);
+    }
+    *_next(entry) = universal_address_free;
+    universal_address_free = entry;
 }
 
 universal_address_container_t *universal_address_add(uint8_t *addr, size_t addr_size)
@@ -116,35 +208,48 @@ universal_address_container_t *universal_address_add(uint8_t *addr, size_t addr_
     universal_address_container_t *pEntry = universal_address_find_entry(addr, addr_size);
 
     if (pEntry == NULL) {
+        if (addr_size > UNIVERSAL_ADDRESS_SIZE) {
+            mutex_unlock(&mtx_access);
+            return NULL;
+        }
+
         /* look for a free entry */
-        pEntry = universal_address_get_next_unused_entry();
+        pEntry = universal_address_get_next_unused_entry(addr, addr_size);
 
         if (pEntry == NULL) {
+            universal_address_stats.failed++;
             mutex_unlock(&mtx_access);
             /* no free room */
             return NULL;
         }
 
-        /* look if the former memory has distinct size */
-        if (pEntry->address_size != addr_size) {
-            /* clean the address */
-            memset(pEntry->address, 0, UNIVERSAL_ADDRESS_SIZE);
+        /* clean the address */
+        memset(pEntry->address, 0, UNIVERSAL_ADDRESS_SIZE);
 
-            /* set the used bytes */
-            pEntry->address_size = addr_size;
-            pEntry->use_count = 0;
-        }
+        /* set the used bytes */
+        pEntry->address_size = addr_size;
+        pEntry->use_count = 0;
 
         /* copy the address */
         memcpy((pEntry->address), addr, addr_size);
     }
+    else if (pEntry->use_count == UINT16_MAX) {
+        /* the entry cannot count any more users */
+        universal_address_stats.failed++;
+        mutex_unlock(&mtx_access);
+        return NULL;
+    }
 
     pEntry->use_count++;
+    universal_address_stats.refs++;
 
     if (pEntry->use_count == 1) {
         DEBUG("[universal_address_add] universal_address_table_filled: %d\n", \
               (int)universal_address_table_filled);
         universal_address_table_filled++;
+        if (universal_address_table_filled > universal_address_stats.max_used) {
+            universal_address_stats.max_used = universal_address_table_filled;
+        }
     }
 
     mutex_unlock(&mtx_access);
@@ -156,12 +261,14 @@ void universal_address_rem(universal_address_container_t *entry)
     mutex_lock(&mtx_access);
     DEBUG("[universal_address_rem] entry: %p\n", (void *)entry);
 
-    /* we do not delete anything on remove */
+    /* the address stays in the entry until it is used for another one */
     if (entry != NULL) {
         if (entry->use_count != 0) {
             entry->use_count--;
+            universal_address_stats.refs--;
 
             if (entry->use_count == 0) {
+                universal_address_release_entry(entry);
                 universal_address_table_filled--;
             }
         }
@@ -311,6 +418,9 @@ void universal_address_init(void)
         memset(universal_address_table[i].address, 0, UNIVERSAL_ADDRESS_SIZE);
     }
 
+    _clear_index();
+    universal_address_table_filled = 0;
+    memset(&universal_address_stats, 0, sizeof(universal_address_stats));
     mutex_unlock(&mtx_access);
 }
 
@@ -325,7 +435,9 @@ void universal_address_reset(void)
         universal_address_table[i].use_count = 0;
     }
 
+    _clear_index();
     universal_address_table_filled = 0;
+    universal_address_stats.refs = 0;
     mutex_unlock(&mtx_access);
 }
 
@@ -357,6 +469,15 @@ int universal_address_get_num_used_entries(void)
     return ret;
 }
 
+void universal_address_get_stats(universal_address_stats_t *stats)
+{
+    mutex_lock(&mtx_access);
+    *stats = universal_address_stats;
+    stats->size = UNIVERSAL_ADDRESS_MAX_ENTRIES;
+    stats->used = universal_address_table_filled;
+    mutex_unlock(&mtx_access);
+}
+
 void universal_address_print_table(void)
 {
     printf("[universal_address_print_table] universal_address_table_filled: %d\n", \
@@ -34,6 +34,9 @@
 static volatile int _in_handler = 0;
 
 static volatile uint32_t _long_cnt = 0;
+/* sequence counter for lock-free readers of the period counters, odd while
+ * they are being updated */
+static volatile unsigned _now_seq = 0;
 #if XTIMER_MASK
 volatile uint32_t _xtimer_high_cnt = 0;
 #endif
@@ -81,17 +84,31 @@ void xtimer_init(void)
 
 static void _xtimer_now_internal(uint32_t *short_term, uint32_t *long_term)
 {
-    uint32_t before, after, long_value;
+    unsigned seq;
+    uint32_t before, short_value, long_value;
 
-    /* loop to cope with possible overflow of _xtimer_now() */
+    /* retry if the overflow handler advanced the period while reading */
     do {
+        seq = _now_seq;
         before = _xtimer_now();
         long_value = _long_cnt;
-        after = _xtimer_now();
+        short_value = _xtimer_now();
+    } while ((seq & 1) || (seq != _now_seq));
 
-    } while (before > after);
+    if (short_value < before) {
+        /* the low-level timer overflowed between both readings, but the
+         * overflow handler has not run yet */
+#if XTIMER_MASK
+        short_value += ~XTIMER_MASK + 1;
+        if (short_value < (~XTIMER_MASK + 1)) {
+            long_value++;
+        }
+#else
+        long_value++;
+#endif
+    }
 
-    *short_term = after;
+    *short_term = short_value;
     *long_term = long_value;
 }
 
@@ -413,6 +430,7 @@ static void _select_long_timers(void)
  */
 static void _next_period(void)
 {
+    _now_seq++;
 #if XTIMER_MASK
     /* advance <32bit mask register */
     _xtimer_high_cnt += ~XTIMER_MASK + 1;
@@ -424,6 +442,7 @@ static void _next_period(void)
     /* advance >32bit counter */
     _long_cnt++;
 #endif
+    _now_seq++;
 
     /* swap overflow list to current timer list */
     timer_list_head = overflow_list_head;
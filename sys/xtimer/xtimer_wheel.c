@@ -0,0 +1,533 @@
+/**
+ * Copyright (C) 2015 Kaspar Schleiser <kaspar@schleiser.de>
+ * Copyright (C) 2016 Eistec AB
+ * Copyright (C) 2026 agent <agent@local>
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup sys_xtimer
+ *
+ * @{
+ * @file
+ * @brief xtimer core functionality, hierarchical timing wheel backend
+ *
+ * Drop-in replacement for xtimer_core.c, selected by the `xtimer_wheel`
+ * module.
+ *
+ * Pending timers are kept in XTIMER_WHEEL_LEVELS wheels of
+ * 2^XTIMER_WHEEL_SLOT_BITS slots each. A timer is filed into the level of
+ * the most significant slot group in which its 64 bit target differs from
+ * the wheel's base time, and into the slot given by that group's bits of
+ * the target. Each slot is a doubly linked list, so insertion and removal
+ * are O(1). The occupancy of every level is tracked in a bitmap, so the next
+ * event is found with one bit scan per level.
+ *
+ * When the base time reaches the start of an occupied slot on a level > 0,
+ * the slot's timers are cascaded into the lower levels. Timers beyond the
+ * span of the wheel are kept in an unsorted list which is cascaded once
+ * per 2^(XTIMER_WHEEL_SLOT_BITS * XTIMER_WHEEL_LEVELS) ticks.
+ *
+ * @author Kaspar Schleiser <kaspar@schleiser.de>
+ * @author Joakim Nohlgård <joakim.nohlgard@eistec.se>
+ * @author agent <agent@local>
+ * @}
+ */
+
+#include <limits.h>
+#include <stdint.h>
+#include <string.h>
+#include "board.h"
+#include "periph/timer.h"
+#include "periph_conf.h"
+
+#include "bitarithm.h"
+#include "xtimer.h"
+#include "irq.h"
+
+/* WARNING! enabling this will have side effects and can lead to timer underflows. */
+#define ENABLE_DEBUG 0
+#include "debug.h"
+
+#if XTIMER_WHEEL_SLOT_BITS > 5
+#error "XTIMER_WHEEL_SLOT_BITS must be <= 5"
+#endif
+#if (XTIMER_WHEEL_SLOT_BITS * XTIMER_WHEEL_LEVELS) >= 64
+#error "the timing wheel must span less than 64 bits"
+#endif
+
+#define WHEEL_SLOTS         (1U << XTIMER_WHEEL_SLOT_BITS)
+#define WHEEL_SLOT_MASK     (WHEEL_SLOTS - 1)
+#define WHEEL_SPAN_BITS     (XTIMER_WHEEL_SLOT_BITS * XTIMER_WHEEL_LEVELS)
+
+static volatile int _in_handler = 0;
+
+static volatile uint32_t _long_cnt = 0;
+#if XTIMER_MASK
+volatile uint32_t _xtimer_high_cnt = 0;
+#endif
+
+/* low-level timer value seen by the last period update, used to detect
+ * overflows */
+static volatile uint32_t _last_lltimer = 0;
+/* sequence counter for lock-free readers of the period counters and
+ * _last_lltimer, odd while they are being updated */
+static volatile unsigned _now_seq = 0;
+
+/* time up to which the wheel has been processed */
+static uint64_t _wheel_base = 0;
+static uint32_t _wheel_map[XTIMER_WHEEL_LEVELS];
+static xtimer_t *_wheel[XTIMER_WHEEL_LEVELS][WHEEL_SLOTS];
+static xtimer_t *_far_list = NULL;
+
+static void _timer_callback(void);
+static void _periph_timer_callback(void *arg, int chan);
+
+static inline uint64_t _target64(xtimer_t *timer)
+{
+    return ((uint64_t)timer->long_target << 32) | timer->target;
+}
+
+static inline void _set_target64(xtimer_t *timer, uint64_t target)
+{
+    timer->target = (uint32_t)target;
+    timer->long_target = (uint32_t)(target >> 32);
+}
+
+static inline unsigned _lsb(uint32_t map)
+{
+#if UINT_MAX < UINT32_MAX
+    if (!(map & 0xffff)) {
+        return 16 + bitarithm_lsb(map >> 16);
+    }
+    return bitarithm_lsb(map & 0xffff);
+#else
+    return bitarithm_lsb(map);
+#endif
+}
+
+static inline unsigned _level(uint64_t target)
+{
+    uint64_t diff = (target ^ _wheel_base) >> XTIMER_WHEEL_SLOT_BITS;
+    unsigned level = 0;
+
+    while (diff && (level < XTIMER_WHEEL_LEVELS)) {
+        diff >>= XTIMER_WHEEL_SLOT_BITS;
+        level++;
+    }
+
+    return level;
+}
+
+static inline unsigned _slot(uint64_t target, unsigned level)
+{
+    return (target >> (level * XTIMER_WHEEL_SLOT_BITS)) & WHEEL_SLOT_MASK;
+}
+
+/* returns the list a timer with the given target is filed into */
+static inline xtimer_t **_head(uint64_t target)
+{
+    unsigned level = _level(target);
+
+    if (level < XTIMER_WHEEL_LEVELS) {
+        return &_wheel[level][_slot(target, level)];
+    }
+    return &_far_list;
+}
+
+static inline uintptr_t _pprev_check(xtimer_t *timer, xtimer_t **pprev)
+{
+    return ~((uintptr_t)pprev ^ (uintptr_t)timer);
+}
+
+static inline void _set_pprev(xtimer_t *timer, xtimer_t **pprev)
+{
+    timer->pprev = pprev;
+    timer->pprev_check = _pprev_check(timer, pprev);
+}
+
+/**
+ * @brief   check whether a timer is pending
+ *
+ * Timers that were never set may hold garbage, as xtimer_t only needs its
+ * callback and argument to be initialized. So xtimer_t::pprev is only
+ * trusted if xtimer_t::pprev_check matches it. Both are cleared when the
+ * timer leaves the wheel.
+ */
+static inline int _is_set(xtimer_t *timer)
+{
+    return (timer->pprev != NULL) &&
+           (timer->pprev_check == _pprev_check(timer, timer->pprev));
+}
+
+static void _wheel_add(xtimer_t *timer)
+{
+    uint64_t target = _target64(timer);
+    xtimer_t **head;
+
+    if (target < _wheel_base) {
+        /* overdue, fire on the next pass of the handler */
+        target = _wheel_base;
+        _set_target64(timer, target);
+    }
+
+    unsigned level = _level(target);
+    head = _head(target);
+    if (level < XTIMER_WHEEL_LEVELS) {
+        _wheel_map[level] |= (1UL << _slot(target, level));
+    }
+
+    timer->next = *head;
+    if (timer->next) {
+        _set_pprev(timer->next, &timer->next);
+    }
+    _set_pprev(timer, head);
+    *head = timer;
+}
+
+static void _wheel_del(xtimer_t *timer)
+{
+    *timer->pprev = timer->next;
+    if (timer->next) {
+        _set_pprev(timer->next, timer->pprev);
+    }
+    timer->pprev = NULL;
+    timer->pprev_check = 0;
+    timer->next = NULL;
+
+    uint64_t target = _target64(timer);
+    unsigned level = _level(target);
+    if (level < XTIMER_WHEEL_LEVELS) {
+        unsigned slot = _slot(target, level);
+        if (!_wheel[level][slot]) {
+            _wheel_map[level] &= ~(1UL << slot);
+        }
+    }
+}
+
+/**
+ * @brief   find the next point in time the wheel needs attention
+ *
+ * All timers on a lower level expire before the first slot of any higher
+ * level starts, so the first occupied level holds the next event.
+ *
+ * @return  level of the next event (XTIMER_WHEEL_LEVELS for the far list),
+ *          or -1 if no timer is pending
+ */
+static int _next_event(uint64_t *time, unsigned *slot)
+{
+    for (unsigned level = 0; level < XTIMER_WHEEL_LEVELS; level++) {
+        if (_wheel_map[level]) {
+            unsigned shift = level * XTIMER_WHEEL_SLOT_BITS;
+            uint64_t mask = ((uint64_t)WHEEL_SLOTS << shift) - 1;
+            *slot = _lsb(_wheel_map[level]);
+            *time = (_wheel_base & ~mask) | ((uint64_t)*slot << shift);
+            return level;
+        }
+    }
+    if (_far_list) {
+        *time = (_wheel_base | ((1ULL << WHEEL_SPAN_BITS) - 1)) + 1;
+        *slot = 0;
+        return XTIMER_WHEEL_LEVELS;
+    }
+
+    return -1;
+}
+
+static void _cascade(xtimer_t **head)
+{
+    xtimer_t *timer = *head;
+
+    *head = NULL;
+    while (timer) {
+        xtimer_t *next = timer->next;
+        _wheel_add(timer);
+        timer = next;
+    }
+}
+
+/**
+ * @brief   check whether the low-level timer overflowed since the last call
+ *
+ * The low-level timer is always programmed to fire at least once in each
+ * half of its period (see _lltimer_update()), so two consecutive calls are
+ * less than one period apart and the timer went through an overflow exactly
+ * when its value decreased.
+ *
+ * Must be called with interrupts disabled.
+ */
+static void _update_period(void)
+{
+    uint32_t now = _xtimer_lltimer_now();
+
+    _now_seq++;
+    if (now < _last_lltimer) {
+#if XTIMER_MASK
+        /* advance <32bit mask register */
+        _xtimer_high_cnt += ~XTIMER_MASK + 1;
+        if (_xtimer_high_cnt == 0) {
+            /* high_cnt overflowed, so advance >32bit counter */
+            _long_cnt++;
+        }
+#else
+        /* advance >32bit counter */
+        _long_cnt++;
+#endif
+    }
+    _last_lltimer = now;
+    _now_seq++;
+}
+
+/**
+ * @brief   get the current 64 bit time, must be called with interrupts
+ *          disabled
+ */
+static uint64_t _now64(void)
+{
+    _update_period();
+
+#if XTIMER_MASK
+    return ((uint64_t)_long_cnt << 32) | _xtimer_high_cnt | _last_lltimer;
+#else
+    return ((uint64_t)_long_cnt << 32) | _last_lltimer;
+#endif
+}
+
+uint64_t _xtimer_now64(void)
+{
+    unsigned seq;
+    uint64_t period;
+    uint32_t last, now;
+
+    /* lock-free read: retry if the period was updated meanwhile */
+    do {
+        seq = _now_seq;
+#if XTIMER_MASK
+        period = ((uint64_t)_long_cnt << 32) | _xtimer_high_cnt;
+#else
+        period = (uint64_t)_long_cnt << 32;
+#endif
+        last = _last_lltimer;
+        now = _xtimer_lltimer_now();
+    } while ((seq & 1) || (seq != _now_seq));
+
+    if (now < last) {
+        /* overflowed, but not yet accounted for by _update_period() */
+        period += (uint64_t)_xtimer_lltimer_mask(0xFFFFFFFF) + 1;
+    }
+
+    return period + now;
+}
+
+/**
+ * @brief program the low-level timer for the next event, but at least for
+ *        the next half of the timer period
+ */
+static void _lltimer_update(void)
+{
+    uint64_t next;
+    unsigned slot;
+
+    if (_in_handler) {
+        return;
+    }
+
+    uint64_t now64 = _now64();
+    uint32_t now = _last_lltimer;
+    uint32_t period_end = _xtimer_lltimer_mask(0xFFFFFFFF);
+    uint32_t target = (now <= (period_end >> 1)) ? (period_end >> 1) + 1
+                                                 : period_end;
+    if ((target - now) < XTIMER_ISR_BACKOFF) {
+        /* too close to the boundary, fire shortly after it instead */
+        target = _xtimer_lltimer_mask(now + XTIMER_ISR_BACKOFF);
+    }
+
+    if (_next_event(&next, &slot) >= 0) {
+        next -= XTIMER_OVERHEAD;
+        if ((int64_t)(next - now64) < XTIMER_ISR_BACKOFF) {
+            /* e.g. cascade of a slot that started in the past, handle ASAP */
+            next = now64 + XTIMER_ISR_BACKOFF;
+        }
+        if ((next - now64) < _xtimer_lltimer_mask(target - now)) {
+            target = _xtimer_lltimer_mask((uint32_t)next);
+        }
+    }
+    DEBUG("_lltimer_update(): setting %" PRIu32 "\n", target);
+    timer_set_absolute(XTIMER_DEV, XTIMER_CHAN, target);
+}
+
+void xtimer_init(void)
+{
+    /* initialize low-level timer */
+    timer_init(XTIMER_DEV, XTIMER_HZ, _periph_timer_callback, NULL);
+
+    /* register initial period tick */
+    unsigned state = irq_disable();
+    _lltimer_update();
+    irq_restore(state);
+}
+
+static void _shoot(xtimer_t *timer)
+{
+    timer->callback(timer->arg);
+}
+
+static void _set_absolute64(xtimer_t *timer, uint64_t target)
+{
+    uint64_t before, after;
+    unsigned slot;
+    unsigned state = irq_disable();
+
+    if (_next_event(&before, &slot) < 0) {
+        /* wheel is empty, skip all cascades between the old base and now */
+        _wheel_base = _now64();
+        before = UINT64_MAX;
+    }
+    if (_is_set(timer)) {
+        _wheel_del(timer);
+    }
+
+    _set_target64(timer, target);
+    _wheel_add(timer);
+
+    _next_event(&after, &slot);
+    if (after != before) {
+        _lltimer_update();
+    }
+
+    irq_restore(state);
+}
+
+void _xtimer_set64(xtimer_t *timer, uint32_t offset, uint32_t long_offset)
+{
+    DEBUG(" _xtimer_set64() offset=%" PRIu32 " long_offset=%" PRIu32 "\n", offset, long_offset);
+    if (!long_offset) {
+        /* timer fits into the short timer */
+        _xtimer_set(timer, (uint32_t)offset);
+    }
+    else {
+        uint64_t target = _xtimer_now64();
+        target += ((uint64_t)long_offset << 32) | offset;
+        _set_absolute64(timer, target);
+    }
+}
+
+void _xtimer_set(xtimer_t *timer, uint32_t offset)
+{
+    DEBUG("timer_set(): offset=%" PRIu32 " now=%" PRIu32 " (%" PRIu32 ")\n",
+          offset, xtimer_now().ticks32, _xtimer_lltimer_now());
+    if (!timer->callback) {
+        DEBUG("timer_set(): timer has no callback.\n");
+        return;
+    }
+
+    xtimer_remove(timer);
+
+    if (offset < XTIMER_BACKOFF) {
+        _xtimer_spin(offset);
+        _shoot(timer);
+    }
+    else {
+        _set_absolute64(timer, _xtimer_now64() + offset);
+    }
+}
+
+int _xtimer_set_absolute(xtimer_t *timer, uint32_t target)
+{
+    uint64_t now = _xtimer_now64();
+    uint32_t offset = target - (uint32_t)now;
+
+    DEBUG("timer_set_absolute(): now=%" PRIu32 " target=%" PRIu32 "\n",
+          (uint32_t)now, target);
+
+    xtimer_remove(timer);
+
+    if (offset < XTIMER_BACKOFF) {
+        /* backoff */
+        _xtimer_spin(offset);
+        _shoot(timer);
+        return 0;
+    }
+
+    _set_absolute64(timer, now + offset);
+
+    return 0;
+}
+
+void xtimer_remove(xtimer_t *timer)
+{
+    int state = irq_disable();
+
+    if (_is_set(timer)) {
+        uint64_t before, after;
+        unsigned slot;
+
+        _next_event(&before, &slot);
+        _wheel_del(timer);
+        if ((_next_event(&after, &slot) < 0) || (after != before)) {
+            _lltimer_update();
+        }
+    }
+    irq_restore(state);
+}
+
+static void _periph_timer_callback(void *arg, int chan)
+{
+    (void)arg;
+    (void)chan;
+    _timer_callback();
+}
+
+/**
+ * @brief main xtimer callback function
+ */
+static void _timer_callback(void)
+{
+    uint64_t next;
+    unsigned slot;
+    int level;
+
+    _in_handler = 1;
+
+    while (1) {
+        uint64_t now = _now64();
+
+        level = _next_event(&next, &slot);
+        if ((level < 0) || (next > now + XTIMER_ISR_BACKOFF)) {
+            break;
+        }
+
+        /* make sure we don't fire too early */
+        while (now < next) {
+            now = _now64();
+        }
+
+        _wheel_base = next;
+
+        if (level == 0) {
+            xtimer_t *timer;
+            while ((timer = _wheel[0][slot])) {
+                _wheel_del(timer);
+                /* make sure timer is recognized as being already fired */
+                timer->target = 0;
+                timer->long_target = 0;
+                _shoot(timer);
+            }
+        }
+        else if (level < XTIMER_WHEEL_LEVELS) {
+            _wheel_map[level] &= ~(1UL << slot);
+            _cascade(&_wheel[level][slot]);
+        }
+        else {
+            _cascade(&_far_list);
+        }
+    }
+
+    _in_handler = 0;
+
+    /* set low level timer */
+    _lltimer_update();
+}
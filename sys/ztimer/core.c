@@ -0,0 +1,190 @@
+/*
+ * Copyright (C) 2026 agent <agent@local>
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     sys_ztimer
+ * @{
+ *
+ * @file
+ * @brief       ztimer core functionality
+ *
+ * @author      agent <agent@local>
+ *
+ * @}
+ */
+
+#include <stdint.h>
+
+#include "irq.h"
+#include "ztimer.h"
+
+#define ENABLE_DEBUG (0)
+#include "debug.h"
+
+static void _add_entry_to_list(ztimer_clock_t *clock, ztimer_base_t *entry)
+{
+    ztimer_base_t *list = &clock->list;
+
+    while (list->next) {
+        ztimer_base_t *list_entry = list->next;
+        /* Stop when new entry expires before next */
+        if (entry->offset < list_entry->offset) {
+            list_entry->offset -= entry->offset;
+            break;
+        }
+        /* Set entry offset relative to previous entry */
+        entry->offset -= list_entry->offset;
+        list = list_entry;
+    }
+
+    entry->next = list->next;
+    list->next = entry;
+}
+
+static int _del_entry_from_list(ztimer_clock_t *clock, ztimer_base_t *entry)
+{
+    ztimer_base_t *list = &clock->list;
+
+    while (list->next) {
+        ztimer_base_t *list_entry = list->next;
+        if (list_entry == entry) {
+            list->next = entry->next;
+            if (entry->next) {
+                /* give the removed entry's offset to its successor */
+                entry->next->offset += entry->offset;
+            }
+            entry->next = NULL;
+            return 1;
+        }
+        list = list_entry;
+    }
+
+    return 0;
+}
+
+/**
+ * @brief   Make the list's offsets relative to the current time
+ *
+ * Expired entries end up with an offset of 0.
+ */
+static void _update_head_offset(ztimer_clock_t *clock)
+{
+    uint32_t now = ztimer_now(clock);
+    uint32_t diff = now - clock->list.offset;
+    ztimer_base_t *entry = clock->list.next;
+
+    clock->list.offset = now;
+
+    while (entry && diff) {
+        if (entry->offset >= diff) {
+            entry->offset -= diff;
+            break;
+        }
+        diff -= entry->offset;
+        entry->offset = 0;
+        entry = entry->next;
+    }
+}
+
+/**
+ * @brief   Program the backend for the list head
+ *
+ * Must be called right after _update_head_offset().
+ */
+static void _ztimer_update(ztimer_clock_t *clock)
+{
+    if (clock->list.next) {
+        uint32_t val = clock->list.next->offset;
+        if ((clock->max_value < UINT32_MAX) && (val > (clock->max_value >> 1))) {
+            /* fire at least every half counter period to extend the
+             * counter */
+            val = clock->max_value >> 1;
+        }
+        val = (val > clock->adjust) ? (val - clock->adjust) : 0;
+        DEBUG("ztimer_update(): setting %" PRIu32 "\n", val);
+        clock->ops->set(clock, val);
+    }
+    else {
+        DEBUG("ztimer_update(): no timer left\n");
+        clock->ops->cancel(clock);
+    }
+}
+
+void ztimer_set(ztimer_clock_t *clock, ztimer_t *timer, uint32_t val)
+{
+    DEBUG("ztimer_set(): %p: set %" PRIu32 "\n", (void *)timer, val);
+
+    unsigned state = irq_disable();
+
+    _update_head_offset(clock);
+    _del_entry_from_list(clock, &timer->base);
+
+    timer->base.offset = val;
+    _add_entry_to_list(clock, &timer->base);
+    if (clock->list.next == &timer->base) {
+        _ztimer_update(clock);
+    }
+
+    irq_restore(state);
+}
+
+void ztimer_remove(ztimer_clock_t *clock, ztimer_t *timer)
+{
+    unsigned state = irq_disable();
+
+    if (clock->list.next == &timer->base) {
+        _update_head_offset(clock);
+        _del_entry_from_list(clock, &timer->base);
+        _ztimer_update(clock);
+    }
+    else {
+        _del_entry_from_list(clock, &timer->base);
+    }
+
+    irq_restore(state);
+}
+
+uint32_t ztimer_now(ztimer_clock_t *clock)
+{
+    if (clock->max_value == UINT32_MAX) {
+        return clock->ops->now(clock);
+    }
+
+    unsigned state = irq_disable();
+    uint32_t lower = clock->ops->now(clock);
+
+    clock->checkpoint += (lower - clock->lower_last) & clock->max_value;
+    clock->lower_last = lower;
+
+    uint32_t now = clock->checkpoint;
+
+    irq_restore(state);
+
+    return now;
+}
+
+void ztimer_handler(ztimer_clock_t *clock)
+{
+    DEBUG("ztimer_handler(): %p\n", (void *)clock);
+
+    _update_head_offset(clock);
+
+    while (clock->list.next && (clock->list.next->offset == 0)) {
+        ztimer_t *timer = (ztimer_t *)clock->list.next;
+
+        clock->list.next = timer->base.next;
+        timer->base.next = NULL;
+
+        timer->callback(timer->arg);
+
+        /* account for the time spent in the callback */
+        _update_head_offset(clock);
+    }
+
+    _ztimer_update(clock);
+}
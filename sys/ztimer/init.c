@@ -0,0 +1,67 @@
+/*
+ * Copyright (C) 2026 agent <agent@local>
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     sys_ztimer
+ * @{
+ *
+ * @file
+ * @brief       ztimer clock configuration and initialization
+ *
+ * @author      agent <agent@local>
+ *
+ * @}
+ */
+
+#include "assert.h"
+#include "board.h"
+#include "periph_conf.h"
+#include "ztimer.h"
+#include "ztimer/config.h"
+
+#ifdef MODULE_ZTIMER_USEC
+#include "ztimer/periph.h"
+#endif
+#ifdef MODULE_ZTIMER_MSEC
+#include "ztimer/rtt.h"
+#endif
+
+#define ENABLE_DEBUG (0)
+#include "debug.h"
+
+#ifdef MODULE_ZTIMER_USEC
+#ifdef MODULE_XTIMER
+static_assert(ZTIMER_USEC_DEV != XTIMER_DEV,
+              "ztimer_usec and xtimer can't share a periph_timer device");
+#endif
+static ztimer_periph_t _ztimer_periph_usec = { .min = ZTIMER_USEC_MIN };
+ztimer_clock_t *const ZTIMER_USEC = &_ztimer_periph_usec.super;
+#endif
+
+#ifdef MODULE_ZTIMER_MSEC
+#if RTT_FREQUENCY != 1000
+#error "ztimer_msec needs an RTT running at 1000 Hz"
+#endif
+static ztimer_rtt_t _ztimer_rtt_msec;
+ztimer_clock_t *const ZTIMER_MSEC = &_ztimer_rtt_msec;
+#endif
+
+void ztimer_init(void)
+{
+#ifdef MODULE_ZTIMER_USEC
+    DEBUG("ztimer_init(): ZTIMER_USEC using periph timer %u\n",
+          (unsigned)ZTIMER_USEC_DEV);
+    _ztimer_periph_usec.super.adjust = ZTIMER_USEC_ADJUST;
+    ztimer_periph_init(&_ztimer_periph_usec, ZTIMER_USEC_DEV, 1000000LU,
+                       ZTIMER_USEC_MAX_VALUE);
+#endif
+#ifdef MODULE_ZTIMER_MSEC
+    DEBUG("ztimer_init(): ZTIMER_MSEC using RTT\n");
+    ztimer_rtt_init(&_ztimer_rtt_msec);
+#endif
+}
@@ -0,0 +1,81 @@
+/*
+ * Copyright (C) 2026 agent <agent@local>
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     sys_ztimer_periph
+ * @{
+ *
+ * @file
+ * @brief       ztimer periph_timer backend implementation
+ *
+ * @author      agent <agent@local>
+ *
+ * @}
+ */
+
+#include "irq.h"
+#include "periph/timer.h"
+#include "ztimer/periph.h"
+
+#define ENABLE_DEBUG (0)
+#include "debug.h"
+
+static void _ztimer_periph_set(ztimer_clock_t *clock, uint32_t val)
+{
+    ztimer_periph_t *ztimer_periph = (ztimer_periph_t *)clock;
+
+    uint16_t min = ztimer_periph->min;
+    if (val < min) {
+        val = min;
+    }
+
+    timer_set(ztimer_periph->dev, 0, val);
+}
+
+static uint32_t _ztimer_periph_now(ztimer_clock_t *clock)
+{
+    ztimer_periph_t *ztimer_periph = (ztimer_periph_t *)clock;
+
+    return timer_read(ztimer_periph->dev);
+}
+
+static void _ztimer_periph_cancel(ztimer_clock_t *clock)
+{
+    ztimer_periph_t *ztimer_periph = (ztimer_periph_t *)clock;
+
+    timer_clear(ztimer_periph->dev, 0);
+}
+
+static void _ztimer_periph_callback(void *arg, int channel)
+{
+    (void)channel;
+    ztimer_handler((ztimer_clock_t *)arg);
+}
+
+static const ztimer_ops_t _ztimer_periph_ops = {
+    .set = _ztimer_periph_set,
+    .now = _ztimer_periph_now,
+    .cancel = _ztimer_periph_cancel,
+};
+
+void ztimer_periph_init(ztimer_periph_t *clock, tim_t dev, unsigned long freq,
+                        uint32_t max_val)
+{
+    clock->dev = dev;
+    clock->super.ops = &_ztimer_periph_ops;
+    clock->super.max_value = max_val;
+
+    int res = timer_init(dev, freq, _ztimer_periph_callback, clock);
+    (void)res;
+    DEBUG("ztimer_periph_init(): tim_t=%u freq=%lu max=%" PRIu32 " res=%i\n",
+          (unsigned)dev, freq, max_val, res);
+
+    /* start with a consistent view of the counter */
+    clock->super.lower_last = timer_read(dev);
+    clock->super.list.offset = ztimer_now(&clock->super);
+}
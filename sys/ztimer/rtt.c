@@ -0,0 +1,73 @@
+/*
+ * Copyright (C) 2026 agent <agent@local>
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     sys_ztimer_rtt
+ * @{
+ *
+ * @file
+ * @brief       ztimer RTT backend implementation
+ *
+ * @author      agent <agent@local>
+ *
+ * @}
+ */
+
+#include "irq.h"
+#include "periph/rtt.h"
+#include "ztimer/rtt.h"
+
+#define ENABLE_DEBUG (0)
+#include "debug.h"
+
+static void _ztimer_rtt_callback(void *arg)
+{
+    ztimer_handler((ztimer_clock_t *)arg);
+}
+
+static void _ztimer_rtt_set(ztimer_clock_t *clock, uint32_t val)
+{
+    if (val < ZTIMER_RTT_MIN) {
+        val = ZTIMER_RTT_MIN;
+    }
+
+    unsigned state = irq_disable();
+    rtt_set_alarm((rtt_get_counter() + val) & RTT_MAX_VALUE,
+                  _ztimer_rtt_callback, clock);
+    irq_restore(state);
+}
+
+static uint32_t _ztimer_rtt_now(ztimer_clock_t *clock)
+{
+    (void)clock;
+    return rtt_get_counter();
+}
+
+static void _ztimer_rtt_cancel(ztimer_clock_t *clock)
+{
+    (void)clock;
+    rtt_clear_alarm();
+}
+
+static const ztimer_ops_t _ztimer_rtt_ops = {
+    .set = _ztimer_rtt_set,
+    .now = _ztimer_rtt_now,
+    .cancel = _ztimer_rtt_cancel,
+};
+
+void ztimer_rtt_init(ztimer_rtt_t *clock)
+{
+    clock->ops = &_ztimer_rtt_ops;
+    clock->max_value = RTT_MAX_VALUE;
+
+    rtt_init();
+    rtt_poweron();
+
+    clock->lower_last = rtt_get_counter();
+    clock->list.offset = ztimer_now(clock);
+}
@@ -0,0 +1,83 @@
+/*
+ * Copyright (C) 2026 agent <agent@local>
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     sys_ztimer
+ * @{
+ *
+ * @file
+ * @brief       ztimer high-level utility function implementations
+ *
+ * @author      agent <agent@local>
+ *
+ * @}
+ */
+
+#include <assert.h>
+#include <stdint.h>
+
+#include "irq.h"
+#include "mutex.h"
+#include "thread.h"
+#include "ztimer.h"
+
+static void _callback_unlock_mutex(void* arg)
+{
+    mutex_t *mutex = (mutex_t *) arg;
+    mutex_unlock(mutex);
+}
+
+void ztimer_sleep(ztimer_clock_t *clock, uint32_t duration)
+{
+    assert(!irq_is_in());
+
+    mutex_t mutex = MUTEX_INIT_LOCKED;
+    ztimer_t timer = {
+        .callback = _callback_unlock_mutex,
+        .arg = (void*) &mutex,
+    };
+
+    ztimer_set(clock, &timer, duration);
+    mutex_lock(&mutex);
+}
+
+static void _callback_wakeup(void* arg)
+{
+    thread_wakeup((kernel_pid_t)((intptr_t)arg));
+}
+
+void ztimer_set_wakeup(ztimer_clock_t *clock, ztimer_t *timer, uint32_t offset,
+                       kernel_pid_t pid)
+{
+    ztimer_remove(clock, timer);
+
+    timer->callback = _callback_wakeup;
+    timer->arg = (void*) ((intptr_t)pid);
+
+    ztimer_set(clock, timer, offset);
+}
+
+static void _callback_msg(void* arg)
+{
+    msg_t *msg = (msg_t*)arg;
+    msg_send_int(msg, msg->sender_pid);
+}
+
+void ztimer_set_msg(ztimer_clock_t *clock, ztimer_t *timer, uint32_t offset,
+                    msg_t *msg, kernel_pid_t target_pid)
+{
+    ztimer_remove(clock, timer);
+
+    timer->callback = _callback_msg;
+    timer->arg = (void*) msg;
+
+    /* use sender_pid field to get target_pid into callback function */
+    msg->sender_pid = target_pid;
+
+    ztimer_set(clock, timer, offset);
+}
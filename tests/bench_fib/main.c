@@ -0,0 +1,131 @@
+/*
+ * Copyright (C) 2026 agent <agent@local>
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Measures the duration of next hop lookups in a FIB table with
+ *              many routes
+ *
+ * @author      agent <agent@local>
+ *
+ * @}
+ */
+
+#include <errno.h>
+#include <inttypes.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "net/fib.h"
+#include "net/fib/table.h"
+#include "xtimer.h"
+
+#ifndef TEST_ROUNDS
+#define TEST_ROUNDS         (10U)
+#endif
+
+#define ADDR_SIZE           (16U)
+#define IFACE               (6U)
+
+static fib_entry_t _entries[FIB_ROUTES];
+static fib_table_t _table = { .data.entries = _entries,
+                              .table_type = FIB_TABLE_TYPE_SH,
+                              .size = FIB_ROUTES,
+                              .mtx_access = MUTEX_INIT,
+                              .notify_rp_pos = 0 };
+
+/* 2001:db8:<i>::/48, /56, or /64 */
+static unsigned _route(uint8_t *pfx, unsigned i)
+{
+    memset(pfx, 0, ADDR_SIZE);
+    pfx[0] = 0x20;
+    pfx[1] = 0x01;
+    pfx[2] = 0x0d;
+    pfx[3] = 0xb8;
+    pfx[4] = (uint8_t)(i >> 8);
+    pfx[5] = (uint8_t)i;
+    return 48U + (8U * (i % 3));
+}
+
+/* fe80::1 to fe80::4 */
+static void _next_hop(uint8_t *addr, unsigned i)
+{
+    memset(addr, 0, ADDR_SIZE);
+    addr[0] = 0xfe;
+    addr[1] = 0x80;
+    addr[15] = (i % 4) + 1;
+}
+
+static void _fill(void)
+{
+    for (unsigned i = 0; i < FIB_ROUTES; i++) {
+        uint8_t pfx[ADDR_SIZE], next_hop[ADDR_SIZE];
+        uint32_t pfx_len = _route(pfx, i);
+
+        _next_hop(next_hop, i);
+        if (fib_add_entry(&_table, IFACE, pfx, ADDR_SIZE,
+                          pfx_len << FIB_FLAG_NET_PREFIX_SHIFT,
+                          next_hop, ADDR_SIZE, 0,
+                          (uint32_t)FIB_LIFETIME_NO_EXPIRE) != 0) {
+            printf("error: unable to add route %u\n", i);
+        }
+    }
+}
+
+static int _lookup(uint8_t *dst, uint8_t *next_hop)
+{
+    kernel_pid_t iface = KERNEL_PID_UNDEF;
+    size_t next_hop_size = ADDR_SIZE;
+    uint32_t next_hop_flags = 0;
+
+    return fib_get_next_hop(&_table, &iface, next_hop, &next_hop_size,
+                            &next_hop_flags, dst, ADDR_SIZE, 0);
+}
+
+int main(void)
+{
+    uint8_t dst[ADDR_SIZE], next_hop[ADDR_SIZE];
+    uint32_t start, duration;
+    unsigned found = 0;
+
+    fib_init(&_table);
+    _fill();
+
+    start = xtimer_now_usec();
+    for (unsigned r = 0; r < TEST_ROUNDS; r++) {
+        for (unsigned i = 0; i < FIB_ROUTES; i++) {
+            _route(dst, i);
+            dst[15] = 1;
+            if ((_lookup(dst, next_hop) == 0) &&
+                (next_hop[15] == (i % 4) + 1)) {
+                found++;
+            }
+        }
+    }
+    duration = xtimer_now_usec() - start;
+
+    /* 2001:db8:<FIB_ROUTES>::1 is not covered by any route */
+    _route(dst, FIB_ROUTES);
+    dst[15] = 1;
+    if (_lookup(dst, next_hop) != -EHOSTUNREACH) {
+        puts("error: found a route to an uncovered address");
+        found = 0;
+    }
+
+    printf("{ \"routes\" : %u, \"lookups\" : %u, \"found\" : %u, "
+           "\"us\" : %" PRIu32 " }\n", FIB_ROUTES, TEST_ROUNDS * FIB_ROUTES,
+           found, duration);
+    puts((found == TEST_ROUNDS * FIB_ROUTES) ? "SUCCESS" : "FAILED");
+
+    fib_deinit(&_table);
+
+    return 0;
+}
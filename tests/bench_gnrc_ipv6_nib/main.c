@@ -0,0 +1,131 @@
+/*
+ * Copyright (C) 2026 agent <agent@local>
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Measures the duration of neighbor cache and forwarding table
+ *              lookups in a NIB with many entries
+ *
+ * @author      agent <agent@local>
+ *
+ * @}
+ */
+
+#include <inttypes.h>
+#include <stdio.h>
+
+#include "byteorder.h"
+#include "net/gnrc/ipv6/nib.h"
+#include "net/ipv6/addr.h"
+#include "xtimer.h"
+
+#include "_nib-internal.h"
+
+#ifndef TEST_ROUNDS
+#define TEST_ROUNDS         (100U)
+#endif
+
+#define ENTRIES_NUMOF       (GNRC_IPV6_NIB_NUMOF)
+#define IFACE               (6U)
+
+#if (GNRC_IPV6_NIB_ONL_HASH_SIZE > 1)
+#define HASHED              (1)
+#else
+#define HASHED              (0)
+#endif
+
+/* fe80::ff:fe00:<i + 1> */
+static void _neighbor(ipv6_addr_t *addr, unsigned i)
+{
+    ipv6_addr_set_link_local_prefix(addr);
+    addr->u64[1].u64 = 0;
+    addr->u8[11] = 0xff;
+    addr->u8[12] = 0xfe;
+    addr->u16[7] = byteorder_htons(i + 1);
+}
+
+/* 2001:db8:<i>::/48, /56, or /64 */
+static unsigned _route(ipv6_addr_t *pfx, unsigned i)
+{
+    ipv6_addr_set_unspecified(pfx);
+    pfx->u16[0] = byteorder_htons(0x2001);
+    pfx->u16[1] = byteorder_htons(0x0db8);
+    pfx->u16[2] = byteorder_htons(i);
+    return 48U + (8U * (i % 3));
+}
+
+static void _fill(void)
+{
+    for (unsigned i = 0; i < ENTRIES_NUMOF; i++) {
+        ipv6_addr_t addr, pfx;
+        _nib_onl_entry_t *node;
+        unsigned pfx_len;
+
+        _neighbor(&addr, i);
+        node = _nib_nc_add(&addr, IFACE,
+                           GNRC_IPV6_NIB_NC_INFO_NUD_STATE_STALE);
+        if (node == NULL) {
+            printf("error: unable to add neighbor %u\n", i);
+            continue;
+        }
+        pfx_len = _route(&pfx, i);
+        /* route over the neighbor just added, so it takes no extra entry */
+        if (_nib_ft_add(&addr, IFACE, &pfx, pfx_len) == NULL) {
+            printf("error: unable to add route %u\n", i);
+        }
+    }
+}
+
+int main(void)
+{
+    uint32_t start, nc_us, ft_us;
+    unsigned found = 0;
+
+    mutex_lock(&_nib_mutex);
+    _fill();
+
+    start = xtimer_now_usec();
+    for (unsigned r = 0; r < TEST_ROUNDS; r++) {
+        for (unsigned i = 0; i < ENTRIES_NUMOF; i++) {
+            ipv6_addr_t addr;
+
+            _neighbor(&addr, i);
+            if (_nib_onl_get(&addr, IFACE) != NULL) {
+                found++;
+            }
+        }
+    }
+    nc_us = xtimer_now_usec() - start;
+
+    start = xtimer_now_usec();
+    for (unsigned r = 0; r < TEST_ROUNDS; r++) {
+        for (unsigned i = 0; i < ENTRIES_NUMOF; i++) {
+            gnrc_ipv6_nib_ft_t fte;
+            ipv6_addr_t dst;
+
+            _route(&dst, i);
+            dst.u8[15] = 1;
+            if (_nib_get_route(&dst, NULL, &fte) == 0) {
+                found++;
+            }
+        }
+    }
+    ft_us = xtimer_now_usec() - start;
+    mutex_unlock(&_nib_mutex);
+
+    printf("{ \"entries\" : %u, \"hashed\" : %u, \"lookups\" : %u, "
+           "\"found\" : %u, \"nc_us\" : %" PRIu32 ", \"ft_us\" : %" PRIu32
+           " }\n", ENTRIES_NUMOF, HASHED, 2 * TEST_ROUNDS * ENTRIES_NUMOF,
+           found, nc_us, ft_us);
+    puts((found == 2 * TEST_ROUNDS * ENTRIES_NUMOF) ? "SUCCESS" : "FAILED");
+
+    return 0;
+}
@@ -0,0 +1,272 @@
+/*
+ * Copyright (C) 2026 agent <agent@local>
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Measures receive and forwarding latency of GNRC with and
+ *              without the run-to-completion receive path
+ *
+ * @author      agent <agent@local>
+ *
+ * @}
+ */
+
+#include <errno.h>
+#include <inttypes.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "byteorder.h"
+#include "msg.h"
+#include "net/gnrc/ipv6/nib/ft.h"
+#include "net/gnrc/netapi.h"
+#include "net/gnrc/netif.h"
+#include "net/gnrc/netif/ieee802154.h"
+#include "net/gnrc/netreg.h"
+#include "net/gnrc/pktbuf.h"
+#include "net/ieee802154.h"
+#include "net/inet_csum.h"
+#include "net/ipv6/hdr.h"
+#include "net/netdev_test.h"
+#include "net/protnum.h"
+#include "net/sixlowpan.h"
+#include "net/udp.h"
+#include "thread.h"
+#include "xtimer.h"
+
+#ifndef TEST_ROUNDS
+#define TEST_ROUNDS         (1000U)
+#endif
+
+#ifdef MODULE_GNRC_NETAPI_RTC
+#define NETAPI_RTC          (1)
+#else
+#define NETAPI_RTC          (0)
+#endif
+
+#define TEST_PORT           (5683U)
+#define TEST_PAYLOAD_LEN    (16U)
+#define TEST_MHR_LEN        (21U)
+#define TEST_FRAME_LEN      (TEST_MHR_LEN + 1U + sizeof(ipv6_hdr_t) + \
+                             sizeof(udp_hdr_t) + TEST_PAYLOAD_LEN)
+#define TEST_MAX_FRAG_SIZE  (102U)
+#define MSG_TYPE_FORWARDED  (0x8ff0)
+#define MSG_QUEUE_SIZE      (8U)
+#define TEST_TIMEOUT        (100U * US_PER_MS)
+
+static char _netif_stack[THREAD_STACKSIZE_DEFAULT +
+                         GNRC_NETAPI_RTC_EXTRA_STACKSIZE];
+static netdev_test_t _dev;
+static msg_t _msg_queue[MSG_QUEUE_SIZE];
+static kernel_pid_t _main_pid;
+
+static uint8_t _frame[TEST_FRAME_LEN];
+static uint8_t _sent[IEEE802154_FRAME_LEN_MAX];
+
+/* fd01::1 (this node), fd01::2 (sender) and fd02::1 (forwarded to) */
+static const ipv6_addr_t _local = { .u8 = { 0xfd, 0x01, [15] = 0x01 } };
+static const ipv6_addr_t _remote = { .u8 = { 0xfd, 0x01, [15] = 0x02 } };
+static const ipv6_addr_t _offlink = { .u8 = { 0xfd, 0x02, [15] = 0x01 } };
+/* link-local address of the neighbor that sends the frames, its IID is
+ * derived from its link-layer address 02:00:00:ff:fe:00:00:02 */
+static const ipv6_addr_t _neighbor = { .u8 = { 0xfe, 0x80, [11] = 0xff,
+                                               [12] = 0xfe, [15] = 0x02 } };
+static const uint8_t _payload[TEST_PAYLOAD_LEN] = {
+    0xbe, 0x11, 0xc0, 0x01, 0xbe, 0x11, 0xc0, 0x01,
+    0xbe, 0x11, 0xc0, 0x01, 0xbe, 0x11, 0xc0, 0x01,
+};
+
+/* builds an uncompressed 6LoWPAN frame from the neighbor to dst */
+static void _build_frame(const ipv6_addr_t *dst)
+{
+    static const uint8_t mhr[TEST_MHR_LEN] = {
+        /* data frame, PAN ID compression, long addresses */
+        0x41, 0xcc, 0x00, 0x23, 0x00,
+        /* destination 02:00:00:ff:fe:00:00:01 (little endian) */
+        0x01, 0x00, 0x00, 0xfe, 0xff, 0x00, 0x00, 0x02,
+        /* source 02:00:00:ff:fe:00:00:02 (little endian) */
+        0x02, 0x00, 0x00, 0xfe, 0xff, 0x00, 0x00, 0x02,
+    };
+    ipv6_hdr_t *ipv6 = (ipv6_hdr_t *)&_frame[TEST_MHR_LEN + 1];
+    udp_hdr_t *udp = (udp_hdr_t *)(ipv6 + 1);
+    const uint16_t udp_len = sizeof(udp_hdr_t) + TEST_PAYLOAD_LEN;
+    uint16_t csum;
+
+    memcpy(_frame, mhr, sizeof(mhr));
+    _frame[TEST_MHR_LEN] = SIXLOWPAN_UNCOMP;
+    memset(ipv6, 0, sizeof(ipv6_hdr_t));
+    ipv6_hdr_set_version(ipv6);
+    ipv6->len = byteorder_htons(udp_len);
+    ipv6->nh = PROTNUM_UDP;
+    ipv6->hl = 64;
+    memcpy(&ipv6->src, &_remote, sizeof(ipv6_addr_t));
+    memcpy(&ipv6->dst, dst, sizeof(ipv6_addr_t));
+    udp->src_port = byteorder_htons(TEST_PORT);
+    udp->dst_port = byteorder_htons(TEST_PORT);
+    udp->length = byteorder_htons(udp_len);
+    udp->checksum = byteorder_htons(0);
+    memcpy(udp + 1, _payload, TEST_PAYLOAD_LEN);
+    csum = inet_csum(0, (uint8_t *)udp, udp_len);
+    csum = ~ipv6_hdr_inet_csum(csum, ipv6, PROTNUM_UDP, udp_len);
+    udp->checksum = byteorder_htons((csum == 0) ? 0xffff : csum);
+}
+
+static int _recv(netdev_t *dev, char *buf, int len, void *info)
+{
+    (void)dev;
+    (void)info;
+    if (buf == NULL) {
+        return sizeof(_frame);
+    }
+    if (((unsigned)len) < sizeof(_frame)) {
+        return -ENOBUFS;
+    }
+    memcpy(buf, _frame, sizeof(_frame));
+    return sizeof(_frame);
+}
+
+static void _isr(netdev_t *dev)
+{
+    dev->event_callback(dev, NETDEV_EVENT_RX_COMPLETE);
+}
+
+/* runs in the interface's thread */
+static int _send(netdev_t *dev, const iolist_t *iolist)
+{
+    size_t len = 0;
+
+    (void)dev;
+    for (const iolist_t *iol = iolist; iol; iol = iol->iol_next) {
+        if ((len + iol->iol_len) > sizeof(_sent)) {
+            return -ENOBUFS;
+        }
+        memcpy(&_sent[len], iol->iol_base, iol->iol_len);
+        len += iol->iol_len;
+    }
+    /* ignore neighbor discovery, only report the forwarded frames */
+    if ((len >= TEST_PAYLOAD_LEN) &&
+        (memcmp(&_sent[len - TEST_PAYLOAD_LEN], _payload,
+                TEST_PAYLOAD_LEN) == 0)) {
+        msg_t msg = { .type = MSG_TYPE_FORWARDED };
+
+        msg_try_send(&msg, _main_pid);
+    }
+    return (int)len;
+}
+
+static int _get_device_type(netdev_t *dev, void *value, size_t max_len)
+{
+    (void)dev;
+    (void)max_len;
+    *((uint16_t *)value) = NETDEV_TYPE_IEEE802154;
+    return sizeof(uint16_t);
+}
+
+static int _get_max_packet_size(netdev_t *dev, void *value, size_t max_len)
+{
+    (void)dev;
+    (void)max_len;
+    *((uint16_t *)value) = TEST_MAX_FRAG_SIZE;
+    return sizeof(uint16_t);
+}
+
+static int _get_src_len(netdev_t *dev, void *value, size_t max_len)
+{
+    (void)dev;
+    (void)max_len;
+    *((uint16_t *)value) = IEEE802154_LONG_ADDRESS_LEN;
+    return sizeof(uint16_t);
+}
+
+static gnrc_netif_t *_init_interface(void)
+{
+    gnrc_netif_t *netif;
+
+    netdev_test_setup(&_dev, NULL);
+    netdev_test_set_recv_cb(&_dev, _recv);
+    netdev_test_set_isr_cb(&_dev, _isr);
+    netdev_test_set_send_cb(&_dev, _send);
+    netdev_test_set_get_cb(&_dev, NETOPT_DEVICE_TYPE, _get_device_type);
+    netdev_test_set_get_cb(&_dev, NETOPT_MAX_PACKET_SIZE,
+                           _get_max_packet_size);
+    netdev_test_set_get_cb(&_dev, NETOPT_SRC_LEN, _get_src_len);
+    _dev.netdev.proto = GNRC_NETTYPE_SIXLOWPAN;
+    netif = gnrc_netif_ieee802154_create(_netif_stack, sizeof(_netif_stack),
+                                         GNRC_NETIF_PRIO, "bench_netif",
+                                         (netdev_t *)&_dev);
+    xtimer_usleep(500); /* wait for thread to start */
+    if (gnrc_netapi_set(netif->pid, NETOPT_IPV6_ADDR, 64U << 8U,
+                        (void *)&_local, sizeof(_local)) < 0) {
+        puts("error: unable to add fd01::1/64");
+    }
+    if (gnrc_ipv6_nib_ft_add(NULL, 0, &_neighbor, netif->pid, 0) < 0) {
+        puts("error: unable to add default route");
+    }
+    return netif;
+}
+
+/* returns the time in microseconds it took to handle TEST_ROUNDS frames */
+static uint32_t _run(gnrc_netif_t *netif, uint16_t msg_type,
+                     unsigned *handled)
+{
+    uint32_t sum = 0;
+
+    for (unsigned i = 0; i < TEST_ROUNDS; i++) {
+        msg_t msg;
+        uint32_t start = xtimer_now_usec();
+
+        netif->dev->event_callback(netif->dev, NETDEV_EVENT_ISR);
+        if (xtimer_msg_receive_timeout(&msg, TEST_TIMEOUT) < 0) {
+            continue;
+        }
+        sum += xtimer_now_usec() - start;
+        if (msg.type == msg_type) {
+            (*handled)++;
+        }
+        if (msg.type == GNRC_NETAPI_MSG_TYPE_RCV) {
+            gnrc_pktbuf_release(msg.content.ptr);
+        }
+    }
+    return sum;
+}
+
+int main(void)
+{
+    gnrc_netreg_entry_t port = GNRC_NETREG_ENTRY_INIT_PID(TEST_PORT,
+                                                          thread_getpid());
+    gnrc_netif_t *netif;
+    uint32_t recv_us, fwd_us;
+    unsigned handled = 0;
+
+    _main_pid = thread_getpid();
+    msg_init_queue(_msg_queue, MSG_QUEUE_SIZE);
+    netif = _init_interface();
+    gnrc_netreg_register(GNRC_NETTYPE_UDP, &port);
+    /* let neighbor discovery settle */
+    xtimer_sleep(1);
+    while (msg_avail() > 0) {
+        msg_t msg;
+
+        msg_receive(&msg);
+    }
+
+    _build_frame(&_local);
+    recv_us = _run(netif, GNRC_NETAPI_MSG_TYPE_RCV, &handled);
+    _build_frame(&_offlink);
+    fwd_us = _run(netif, MSG_TYPE_FORWARDED, &handled);
+
+    printf("{ \"rtc\" : %u, \"rounds\" : %u, \"handled\" : %u, "
+           "\"recv_us\" : %" PRIu32 ", \"fwd_us\" : %" PRIu32 " }\n",
+           NETAPI_RTC, TEST_ROUNDS, handled, recv_us, fwd_us);
+    puts((handled == 2 * TEST_ROUNDS) ? "SUCCESS" : "FAILED");
+
+    return 0;
+}
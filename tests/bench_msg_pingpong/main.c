@@ -28,6 +28,13 @@
 #define TEST_DURATION       (1000000U)
 #endif
 
+#ifndef TEST_BULK
+#define TEST_BULK           (0)
+#endif
+
+/* largest batch size measured with TEST_BULK */
+#define BULK_MAX            (32U)
+
 volatile unsigned _flag = 0;
 static char _stack[THREAD_STACKSIZE_MAIN];
 
@@ -50,6 +57,40 @@ static void *_second_thread(void *arg)
     return NULL;
 }
 
+static void *_second_thread_bulk(void *arg)
+{
+    (void)arg;
+    msg_t queue[BULK_MAX];
+    msg_t test[BULK_MAX];
+
+    msg_init_queue(queue, BULK_MAX);
+
+    while(1) {
+        msg_receive_bulk(test, BULK_MAX);
+    }
+
+    return NULL;
+}
+
+static uint32_t _bench_bulk(kernel_pid_t other, unsigned batch)
+{
+    static msg_t test[BULK_MAX];
+    xtimer_t timer = { .callback = _timer_callback };
+    uint32_t n = 0;
+
+    _flag = 0;
+    xtimer_set(&timer, TEST_DURATION);
+    while(!_flag) {
+        unsigned sent = 0;
+        while (sent < batch) {
+            sent += msg_send_bulk(&test[sent], batch - sent, other);
+        }
+        n += batch;
+    }
+
+    return n;
+}
+
 int main(void)
 {
     printf("main starting\n");
@@ -58,11 +99,20 @@ int main(void)
                                        sizeof(_stack),
                                        (THREAD_PRIORITY_MAIN - 1),
                                        THREAD_CREATE_STACKTEST,
-                                       _second_thread,
+                                       TEST_BULK ? _second_thread_bulk
+                                                 : _second_thread,
                                        NULL,
                                        "second_thread");
 
-    xtimer_t timer;
+    if (TEST_BULK) {
+        for (unsigned batch = 1; batch <= BULK_MAX; batch *= 2) {
+            uint32_t n = _bench_bulk(other, batch);
+            printf("{ \"batch\" : %u, \"result\" : %"PRIu32" }\n", batch, n);
+        }
+        return 0;
+    }
+
+    xtimer_t timer = { 0 };
     timer.callback = _timer_callback;
 
     msg_t test;
@@ -7,12 +7,17 @@
 # General Public License v2.1. See the file LICENSE in the top level
 # directory for more details.
 
+import os
 import sys
 from testrunner import run
 
 
 def testfunc(child):
-    child.expect(r"{ \"result\" : \d+ }")
+    if os.environ.get('TEST_BULK', '0') != '0':
+        for batch in (1, 2, 4, 8, 16, 32):
+            child.expect(r"{ \"batch\" : %d, \"result\" : \d+ }" % batch)
+    else:
+        child.expect(r"{ \"result\" : \d+ }")
 
 
 if __name__ == "__main__":
@@ -54,6 +54,9 @@ static void *_second_thread(void *arg)
 int main(void)
 {
     printf("main starting\n");
+#if defined(MUTEX_FAST_PATH) && (MUTEX_FAST_PATH == 0)
+    printf("mutex fast path disabled\n");
+#endif
 
     thread_create(_stack,
                   sizeof(_stack),
@@ -67,8 +70,7 @@ int main(void)
     mutex_lock(&_mutex);
     thread_yield_higher();
 
-    xtimer_t timer;
-    timer.callback = _timer_callback;
+    xtimer_t timer = { .callback = _timer_callback };
 
     uint32_t n = 0;
 
@@ -80,5 +82,19 @@ int main(void)
 
     printf("{ \"result\" : %"PRIu32" }\n", n);
 
+    /* lock and unlock a mutex nobody else is interested in */
+    mutex_t uncontended = MUTEX_INIT;
+
+    n = 0;
+    _flag = 0;
+    xtimer_set(&timer, TEST_DURATION);
+    while(!_flag) {
+        mutex_lock(&uncontended);
+        mutex_unlock(&uncontended);
+        n++;
+    }
+
+    printf("{ \"uncontended\" : %"PRIu32" }\n", n);
+
     return 0;
 }
@@ -0,0 +1,173 @@
+/*
+ * Copyright (C) 2026 agent <agent@local>
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Measure frames per second through netdev_tap
+ *
+ * @author      agent <agent@local>
+ *
+ * @}
+ */
+
+#include <inttypes.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "msg.h"
+#include "thread.h"
+#include "xtimer.h"
+
+#include "net/ethernet.h"
+#include "net/netdev.h"
+#include "netdev_tap.h"
+#include "netdev_tap_params.h"
+
+#ifndef TEST_DURATION
+#define TEST_DURATION       (1000000U)
+#endif
+
+#ifndef TEST_ROUNDS
+#define TEST_ROUNDS         (10U)
+#endif
+
+#ifndef TEST_TX
+#define TEST_TX             (0)
+#endif
+
+/* IEEE 802 local experimental ethertype */
+#define TEST_ETHERTYPE      (0x88b5)
+#define TEST_FRAME_LEN      (64U)
+
+#define MSG_TYPE_ISR        (0x3456)
+#define MSG_TYPE_REPORT     (0x3457)
+
+static netdev_tap_t _dev;
+static kernel_pid_t _main_pid;
+static uint8_t _rx_buf[ETHERNET_FRAME_LEN];
+static msg_t _queue[8];
+
+static uint32_t _rx_frames;
+static uint32_t _rx_bytes;
+static uint32_t _isrs;
+
+static void _event_cb(netdev_t *netdev, netdev_event_t event)
+{
+    if (event == NETDEV_EVENT_ISR) {
+        msg_t msg = { .type = MSG_TYPE_ISR };
+
+        if (msg_send(&msg, _main_pid) <= 0) {
+            puts("lost interrupt");
+        }
+    }
+    else if (event == NETDEV_EVENT_RX_COMPLETE) {
+        /* same two-call pattern as a network stack would use */
+        int len = netdev->driver->recv(netdev, NULL, 0, NULL);
+
+        if (len > (int)sizeof(_rx_buf)) {
+            len = sizeof(_rx_buf);
+        }
+        len = netdev->driver->recv(netdev, _rx_buf, len, NULL);
+        if (len > 0) {
+            _rx_frames++;
+            _rx_bytes += len;
+        }
+    }
+}
+
+static void _handle(msg_t *msg)
+{
+    if (msg->type == MSG_TYPE_ISR) {
+        _isrs++;
+        _dev.netdev.driver->isr(&_dev.netdev);
+    }
+}
+
+static void _bench_rx(void)
+{
+    msg_t report = { .type = MSG_TYPE_REPORT };
+    xtimer_t timer;
+
+    for (unsigned round = 0; round < TEST_ROUNDS; round++) {
+        msg_t msg;
+
+        _rx_frames = 0;
+        _rx_bytes = 0;
+        _isrs = 0;
+        xtimer_set_msg(&timer, TEST_DURATION, &report, _main_pid);
+        do {
+            msg_receive(&msg);
+            _handle(&msg);
+        } while (msg.type != MSG_TYPE_REPORT);
+
+        printf("{ \"rx_pps\" : %" PRIu32 ", \"rx_bytes\" : %" PRIu32
+               ", \"isrs\" : %" PRIu32 " }\n", _rx_frames, _rx_bytes, _isrs);
+    }
+}
+
+static void _bench_tx(void)
+{
+    msg_t report = { .type = MSG_TYPE_REPORT };
+    xtimer_t timer;
+    uint8_t frame[TEST_FRAME_LEN];
+    ethernet_hdr_t *hdr = (ethernet_hdr_t *)frame;
+    iolist_t iolist = { .iol_base = frame, .iol_len = sizeof(frame) };
+
+    memset(frame, 0, sizeof(frame));
+    memset(hdr->dst, 0xff, ETHERNET_ADDR_LEN);
+    memcpy(hdr->src, _dev.addr, ETHERNET_ADDR_LEN);
+    hdr->type = byteorder_htons(TEST_ETHERTYPE);
+
+    for (unsigned round = 0; round < TEST_ROUNDS; round++) {
+        uint32_t tx_frames = 0;
+        bool done = false;
+
+        xtimer_set_msg(&timer, TEST_DURATION, &report, _main_pid);
+        while (!done) {
+            msg_t msg;
+
+            if (_dev.netdev.driver->send(&_dev.netdev, &iolist) > 0) {
+                tx_frames++;
+            }
+            while (msg_try_receive(&msg) == 1) {
+                _handle(&msg);
+                done |= (msg.type == MSG_TYPE_REPORT);
+            }
+        }
+
+        printf("{ \"tx_pps\" : %" PRIu32 " }\n", tx_frames);
+    }
+}
+
+int main(void)
+{
+    _main_pid = thread_getpid();
+    msg_init_queue(_queue, sizeof(_queue) / sizeof(_queue[0]));
+
+    netdev_tap_setup(&_dev, &netdev_tap_params[0]);
+    _dev.netdev.event_callback = _event_cb;
+    if (_dev.netdev.driver->init(&_dev.netdev) != 0) {
+        puts("init failed");
+        return 1;
+    }
+
+    printf("bench_netdev_tap: %s on %s\n", TEST_TX ? "TX" : "RX",
+           _dev.tap_name);
+    if (TEST_TX) {
+        _bench_tx();
+    }
+    else {
+        _bench_rx();
+    }
+    puts("done");
+
+    return 0;
+}
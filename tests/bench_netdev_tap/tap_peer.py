@@ -0,0 +1,88 @@
+#!/usr/bin/env python3
+
+# Copyright (C) 2026 agent <agent@local>
+#
+# This file is subject to the terms and conditions of the GNU Lesser
+# General Public License v2.1. See the file LICENSE in the top level
+# directory for more details.
+
+"""
+Host side peer of tests/bench_netdev_tap
+
+Sends frames into the tap interface as fast as possible (`send`), or counts
+the frames the application sends per second (`recv`). Needs CAP_NET_RAW.
+"""
+
+import sys
+import time
+import socket
+import argparse
+
+ETHERTYPE = 0x88b5
+ETH_P_ALL = 0x0003
+
+
+def _send(sock, dst, length, duration):
+    src = sock.getsockname()[4]
+    frame = dst + src + ETHERTYPE.to_bytes(2, 'big')
+    frame += bytes(max(0, length - len(frame)))
+    end = time.monotonic() + duration
+    sent = 0
+    second = time.monotonic() + 1
+    while time.monotonic() < end:
+        try:
+            sock.send(frame)
+            sent += 1
+        except BlockingIOError:
+            pass
+        if time.monotonic() >= second:
+            print('{{ "host_tx_pps" : {} }}'.format(sent))
+            sent = 0
+            second += 1
+
+
+def _recv(sock, duration):
+    end = time.monotonic() + duration
+    received = 0
+    second = time.monotonic() + 1
+    sock.settimeout(0.1)
+    while time.monotonic() < end:
+        try:
+            frame = sock.recv(2048)
+            if int.from_bytes(frame[12:14], 'big') == ETHERTYPE:
+                received += 1
+        except socket.timeout:
+            pass
+        if time.monotonic() >= second:
+            print('{{ "host_rx_pps" : {} }}'.format(received))
+            received = 0
+            second += 1
+
+
+def main():
+    parser = argparse.ArgumentParser()
+    parser.add_argument('mode', choices=['send', 'recv'])
+    parser.add_argument('-i', '--interface', default='tap0',
+                        help='tap interface (default: tap0)')
+    parser.add_argument('-d', '--dst', default='ff:ff:ff:ff:ff:ff',
+                        help='destination MAC address (default: broadcast)')
+    parser.add_argument('-l', '--length', type=int, default=64,
+                        help='frame length in bytes (default: 64)')
+    parser.add_argument('-t', '--time', type=float, default=10,
+                        help='duration in seconds (default: 10)')
+    args = parser.parse_args()
+
+    sock = socket.socket(socket.AF_PACKET, socket.SOCK_RAW,
+                         socket.htons(ETH_P_ALL))
+    sock.bind((args.interface, 0))
+
+    if args.mode == 'send':
+        dst = bytes(int(b, 16) for b in args.dst.split(':'))
+        _send(sock, dst, args.length, args.time)
+    else:
+        _recv(sock, args.time)
+    return 0
+
+
+if __name__ == '__main__':
+    sys.exit(main())
@@ -0,0 +1,91 @@
+/*
+ * Copyright (C) 2026 agent <agent@local>
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Measures the duration of registry lookups with many
+ *              registrations
+ *
+ * @author      agent <agent@local>
+ *
+ * @}
+ */
+
+#include <inttypes.h>
+#include <stdio.h>
+
+#include "msg.h"
+#include "net/gnrc/netreg.h"
+#include "thread.h"
+#include "xtimer.h"
+
+#ifndef TEST_ROUNDS
+#define TEST_ROUNDS         (1000U)
+#endif
+
+#define ENTRIES_NUMOF       (64U)
+#define PORT_BASE           (1024U)
+/* spread ports like a gateway's: well-known ones and some in between */
+#define PORT(i)             (PORT_BASE + ((i) * 37U))
+#define MSG_QUEUE_SIZE      (4U)
+
+static gnrc_netreg_entry_t _entries[ENTRIES_NUMOF];
+static msg_t _msg_queue[MSG_QUEUE_SIZE];
+
+/* emulates gnrc_netapi_dispatch(): every entry for the context is visited */
+static unsigned _dispatch(uint32_t demux_ctx)
+{
+    unsigned num = 0;
+
+    for (gnrc_netreg_entry_t *entry = gnrc_netreg_lookup(GNRC_NETTYPE_UNDEF,
+                                                         demux_ctx);
+         entry != NULL; entry = gnrc_netreg_getnext(entry)) {
+        num++;
+    }
+    return num;
+}
+
+int main(void)
+{
+    uint32_t start, hit_us, miss_us;
+    unsigned found = 0;
+
+    msg_init_queue(_msg_queue, MSG_QUEUE_SIZE);
+    for (unsigned i = 0; i < ENTRIES_NUMOF; i++) {
+        gnrc_netreg_entry_init_pid(&_entries[i], PORT(i), thread_getpid());
+        gnrc_netreg_register(GNRC_NETTYPE_UNDEF, &_entries[i]);
+    }
+
+    start = xtimer_now_usec();
+    for (unsigned r = 0; r < TEST_ROUNDS; r++) {
+        for (unsigned i = 0; i < ENTRIES_NUMOF; i++) {
+            found += _dispatch(PORT(i));
+        }
+    }
+    hit_us = xtimer_now_usec() - start;
+
+    start = xtimer_now_usec();
+    for (unsigned r = 0; r < TEST_ROUNDS; r++) {
+        for (unsigned i = 0; i < ENTRIES_NUMOF; i++) {
+            /* no port in between is registered */
+            found += _dispatch(PORT(i) + 1);
+        }
+    }
+    miss_us = xtimer_now_usec() - start;
+
+    printf("{ \"entries\" : %u, \"buckets\" : %u, \"lookups\" : %u, "
+           "\"found\" : %u, \"hit_us\" : %" PRIu32 ", \"miss_us\" : %" PRIu32
+           " }\n", ENTRIES_NUMOF, GNRC_NETREG_BUCKETS,
+           2 * TEST_ROUNDS * ENTRIES_NUMOF, found, hit_us, miss_us);
+    puts((found == TEST_ROUNDS * ENTRIES_NUMOF) ? "SUCCESS" : "FAILED");
+
+    return 0;
+}
@@ -0,0 +1,197 @@
+/*
+ * Copyright (C) 2026 agent <agent@local>
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Replays a trace of packet buffer operations and measures
+ *              their duration
+ *
+ * @author      agent <agent@local>
+ *
+ * @}
+ */
+
+#include <inttypes.h>
+#include <stdio.h>
+
+#include "net/gnrc/pktbuf.h"
+#include "random.h"
+#include "xtimer.h"
+
+#ifndef TEST_STEPS
+#define TEST_STEPS          (10000U)
+#endif
+
+#ifndef TEST_SEED
+#define TEST_SEED           (0x5eed)
+#endif
+
+/* packets that are in the packet buffer at the same time at most */
+#define SLOTS               (24U)
+
+#define FRAME_LEN           (127U)
+#define IPV6_HDR_LEN        (40U)
+#define UDP_HDR_LEN         (8U)
+#define NETIF_HDR_LEN       (24U)
+#define DATAGRAM_LEN_MIN    (200U)
+#define DATAGRAM_LEN_MAX    (1280U)
+
+typedef struct {
+    gnrc_pktsnip_t *pkt;
+    unsigned expires;
+} slot_t;
+
+static slot_t _slots[SLOTS];
+static uint32_t _ops;
+static uint32_t _failed;
+static uint32_t _total_us;
+static uint32_t _max_us;
+static uint32_t _start;
+
+static inline void _op_start(void)
+{
+    _start = xtimer_now_usec();
+}
+
+static inline void _op_end(bool success)
+{
+    uint32_t duration = xtimer_now_usec() - _start;
+
+    _ops++;
+    _total_us += duration;
+    if (duration > _max_us) {
+        _max_us = duration;
+    }
+    if (!success) {
+        _failed++;
+    }
+}
+
+static void _release(gnrc_pktsnip_t *pkt)
+{
+    _op_start();
+    gnrc_pktbuf_release(pkt);
+    _op_end(true);
+}
+
+static gnrc_pktsnip_t *_add(gnrc_pktsnip_t *next, size_t size,
+                            gnrc_nettype_t type)
+{
+    gnrc_pktsnip_t *pkt;
+
+    _op_start();
+    pkt = gnrc_pktbuf_add(next, NULL, size, type);
+    _op_end(pkt != NULL);
+    if ((pkt == NULL) && (next != NULL)) {
+        _release(next);
+    }
+    return pkt;
+}
+
+/* a frame as received by a netif, then handed to IPv6 */
+static gnrc_pktsnip_t *_rx_frame(void)
+{
+    gnrc_pktsnip_t *pkt = _add(NULL, FRAME_LEN, GNRC_NETTYPE_UNDEF);
+    bool success;
+
+    if (pkt == NULL) {
+        return NULL;
+    }
+    _op_start();
+    success = (gnrc_pktbuf_realloc_data(pkt, random_uint32_range(IPV6_HDR_LEN,
+                                                                 FRAME_LEN + 1)) == 0);
+    _op_end(success);
+    _op_start();
+    success = (gnrc_pktbuf_mark(pkt, IPV6_HDR_LEN, GNRC_NETTYPE_UNDEF) != NULL);
+    _op_end(success);
+    if (!success) {
+        _release(pkt);
+        return NULL;
+    }
+    return _add(pkt, NETIF_HDR_LEN, GNRC_NETTYPE_NETIF);
+}
+
+/* a datagram in reassembly */
+static gnrc_pktsnip_t *_rx_datagram(void)
+{
+    return _add(NULL, random_uint32_range(DATAGRAM_LEN_MIN,
+                                          DATAGRAM_LEN_MAX + 1),
+                GNRC_NETTYPE_UNDEF);
+}
+
+/* a UDP packet on its way down the stack */
+static gnrc_pktsnip_t *_tx_packet(void)
+{
+    gnrc_pktsnip_t *pkt = _add(NULL, random_uint32_range(8, 201),
+                               GNRC_NETTYPE_UNDEF);
+
+    if (pkt == NULL) {
+        return NULL;
+    }
+    if ((pkt = _add(pkt, UDP_HDR_LEN, GNRC_NETTYPE_UNDEF)) == NULL) {
+        return NULL;
+    }
+    if ((pkt = _add(pkt, IPV6_HDR_LEN, GNRC_NETTYPE_UNDEF)) == NULL) {
+        return NULL;
+    }
+    return _add(pkt, NETIF_HDR_LEN, GNRC_NETTYPE_NETIF);
+}
+
+static void _step(unsigned step)
+{
+    slot_t *free_slot = NULL;
+    uint32_t event = random_uint32_range(0, 100);
+
+    for (unsigned i = 0; i < SLOTS; i++) {
+        if ((_slots[i].pkt != NULL) && (_slots[i].expires <= step)) {
+            _release(_slots[i].pkt);
+            _slots[i].pkt = NULL;
+        }
+        if (_slots[i].pkt == NULL) {
+            free_slot = &_slots[i];
+        }
+    }
+    if (free_slot == NULL) {
+        return;
+    }
+    if (event < 60) {
+        free_slot->pkt = _rx_frame();
+        free_slot->expires = step + random_uint32_range(1, 4);
+    }
+    else if (event < 70) {
+        free_slot->pkt = _rx_datagram();
+        free_slot->expires = step + random_uint32_range(5, 41);
+    }
+    else {
+        free_slot->pkt = _tx_packet();
+        free_slot->expires = step + random_uint32_range(1, 9);
+    }
+}
+
+int main(void)
+{
+    random_init(TEST_SEED);
+
+    for (unsigned step = 0; step < TEST_STEPS; step++) {
+        _step(step);
+    }
+
+    printf("{ \"steps\" : %u, \"ops\" : %" PRIu32 ", \"failed\" : %" PRIu32
+           ", \"total_us\" : %" PRIu32 ", \"max_us\" : %" PRIu32 " }\n",
+           TEST_STEPS, _ops, _failed, _total_us, _max_us);
+#ifdef DEVELHELP
+    gnrc_pktbuf_stats();
+#else
+    puts("packet buffer: statistics need DEVELHELP");
+#endif
+
+    return 0;
+}
@@ -0,0 +1,20 @@
+#!/usr/bin/env python3
+
+# Copyright (C) 2026 agent <agent@local>
+#
+# This file is subject to the terms and conditions of the GNU Lesser
+# General Public License v2.1. See the file LICENSE in the top level
+# directory for more details.
+
+import sys
+from testrunner import run
+
+
+def testfunc(child):
+    child.expect(r"{ \"steps\" : \d+, \"ops\" : \d+, \"failed\" : \d+, "
+                 r"\"total_us\" : \d+, \"max_us\" : \d+ }")
+    child.expect_exact("packet buffer:")
+
+
+if __name__ == "__main__":
+    sys.exit(run(testfunc))
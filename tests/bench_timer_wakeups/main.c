@@ -0,0 +1,143 @@
+/*
+ * Copyright (C) 2026 agent <agent@local>
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Measure wakeups caused by long-lived timeouts
+ *
+ * @author      agent <agent@local>
+ *
+ * @}
+ */
+
+#include <stdint.h>
+#include <stdio.h>
+#include <sys/resource.h>
+
+#include "mutex.h"
+#include "native_internal.h"
+#include "timex.h"
+
+#ifdef MODULE_ZTIMER_MSEC
+#include "ztimer.h"
+#else
+#include "xtimer.h"
+#endif
+
+#ifndef BENCH_DURATION
+#define BENCH_DURATION      (30U)
+#endif
+
+#define SEC_PER_HOUR        (3600U)
+
+#ifdef MODULE_ZTIMER_MSEC
+#define BENCH_TIMER_NAME    "ztimer (ZTIMER_MSEC)"
+typedef ztimer_t bench_timer_t;
+
+static void _set_ms(bench_timer_t *timer, uint32_t ms)
+{
+    ztimer_set(ZTIMER_MSEC, timer, ms);
+}
+
+static void _remove(bench_timer_t *timer)
+{
+    ztimer_remove(ZTIMER_MSEC, timer);
+}
+#else
+#define BENCH_TIMER_NAME    "xtimer"
+typedef xtimer_t bench_timer_t;
+
+static void _set_ms(bench_timer_t *timer, uint32_t ms)
+{
+    xtimer_set(timer, ms * US_PER_MS);
+}
+
+static void _remove(bench_timer_t *timer)
+{
+    xtimer_remove(timer);
+}
+#endif
+
+typedef struct {
+    bench_timer_t timer;
+    uint32_t period;
+} bench_timeout_t;
+
+/* periods of the simulated protocol timeouts in ms */
+static const uint32_t _periods[] = { 250, 500, 1000, 2000, 5000, 10000 };
+
+#define TIMEOUT_NUMOF   (sizeof(_periods) / sizeof(_periods[0]))
+
+static bench_timeout_t _timeouts[TIMEOUT_NUMOF];
+static bench_timer_t _end;
+static mutex_t _done = MUTEX_INIT_LOCKED;
+static volatile unsigned _callbacks;
+
+static void _timeout_cb(void *arg)
+{
+    bench_timeout_t *timeout = arg;
+
+    _callbacks++;
+    _set_ms(&timeout->timer, timeout->period);
+}
+
+static void _end_cb(void *arg)
+{
+    (void)arg;
+    mutex_unlock(&_done);
+}
+
+static long _host_wakeups(void)
+{
+    struct rusage usage;
+
+    _native_syscall_enter();
+    getrusage(RUSAGE_SELF, &usage);
+    _native_syscall_leave();
+
+    return usage.ru_nvcsw;
+}
+
+int main(void)
+{
+    printf("Measuring wakeups of %s for %u s\n", BENCH_TIMER_NAME,
+           BENCH_DURATION);
+
+    long wakeups = _host_wakeups();
+
+    for (unsigned i = 0; i < TIMEOUT_NUMOF; i++) {
+        _timeouts[i].period = _periods[i];
+        _timeouts[i].timer.callback = _timeout_cb;
+        _timeouts[i].timer.arg = &_timeouts[i];
+        _set_ms(&_timeouts[i].timer, _periods[i]);
+    }
+    _end.callback = _end_cb;
+    _set_ms(&_end, BENCH_DURATION * MS_PER_SEC);
+
+    mutex_lock(&_done);
+
+    for (unsigned i = 0; i < TIMEOUT_NUMOF; i++) {
+        _remove(&_timeouts[i].timer);
+    }
+    wakeups = _host_wakeups() - wakeups;
+
+    unsigned callbacks = _callbacks;
+    printf("callbacks: %u\n", callbacks);
+    printf("wakeups: %ld\n", wakeups);
+    printf("callbacks per hour: %lu\n",
+           (unsigned long)callbacks * SEC_PER_HOUR / BENCH_DURATION);
+    printf("wakeups per hour: %lu\n",
+           (unsigned long)wakeups * SEC_PER_HOUR / BENCH_DURATION);
+    printf("{ \"result\" : %lu }\n",
+           (unsigned long)wakeups * SEC_PER_HOUR / BENCH_DURATION);
+
+    return 0;
+}
@@ -238,6 +238,41 @@ extern "C" {
 #define SPIN_MAX_TARGET 16
 #endif
 
+/* Run the xtimer scaling benchmark instead of the statistical benchmark */
+#ifndef TEST_XTIMER_SCALING
+#define TEST_XTIMER_SCALING 0
+#endif
+
+/* Numbers of concurrent timers used by the scaling benchmark */
+#ifndef TEST_SCALING_NUMOF
+#define TEST_SCALING_NUMOF 10, 100, 1000
+#endif
+
+/* Size of the timer pool of the scaling benchmark, larger entries in
+ * TEST_SCALING_NUMOF are skipped. Reduce this if RAM usage is too high */
+#ifndef TEST_SCALING_MAX
+#define TEST_SCALING_MAX 1000
+#endif
+
+/* Timer offsets used for measuring set and remove, in TUT ticks, the timers
+ * must not fire while they are being set and removed */
+#ifndef TEST_SCALING_OFFSET
+#define TEST_SCALING_OFFSET ((TIM_TEST_FREQ) * 2)
+#endif
+#ifndef TEST_SCALING_SPREAD
+#define TEST_SCALING_SPREAD (TIM_TEST_FREQ)
+#endif
+
+/* Timer offsets used for measuring the callback lateness, in TUT ticks, the
+ * fire offsets are randomly spread over TEST_SCALING_FIRE_SPACING ticks per
+ * concurrent timer */
+#ifndef TEST_SCALING_FIRE_OFFSET
+#define TEST_SCALING_FIRE_OFFSET 10000
+#endif
+#ifndef TEST_SCALING_FIRE_SPACING
+#define TEST_SCALING_FIRE_SPACING 50
+#endif
+
 /* estimate_cpu_overhead will loop for this many iterations to get a proper estimate */
 #define ESTIMATE_CPU_ITERATIONS 2048
 
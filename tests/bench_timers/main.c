@@ -41,6 +41,7 @@
 #include "periph/timer.h"
 
 #include "print_results.h"
+#include "scaling.h"
 #include "spin_random.h"
 #include "bench_timers_config.h"
 
@@ -593,6 +594,10 @@ static void estimate_cpu_overhead(void)
     print_str(" (s2 = ");
     uint32_t var = matstat_variance(&ref_state);
     print_u32_dec(var);
+    print_str(", min = ");
+    print_s32_dec(ref_state.min);
+    print_str(", max = ");
+    print_s32_dec(ref_state.max);
     print_str(")\n");
     if (var > 2) {
         print_str("Warning: Variance in CPU estimation is too high\n");
@@ -605,6 +610,10 @@ static void estimate_cpu_overhead(void)
     print_str(" (s2 = ");
     var = matstat_variance(&int_state);
     print_u32_dec(var);
+    print_str(", min = ");
+    print_s32_dec(int_state.min);
+    print_str(", max = ");
+    print_s32_dec(int_state.max);
     print_str(")\n");
     if (var > 2) {
         print_str("Warning: Variance in CPU estimation is too high\n");
@@ -740,6 +749,11 @@ int main(void)
 #ifdef MODULE_PERIPH_RTT
     rtt_begin = rtt_get_counter();
 #endif
+    if (TEST_XTIMER_SCALING) {
+        while(1) {
+            scaling_bench();
+        }
+    }
     ref_begin = timer_read(TIM_REF_DEV);
     tut_begin = READ_TUT();
     while(1) {
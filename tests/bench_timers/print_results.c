@@ -62,6 +62,53 @@ static void print_statistics(const matstat_state_t *state, const stat_limits_t *
     print("\n", 1);
 }
 
+static uint32_t isqrt(uint64_t x)
+{
+    uint64_t res = 0;
+    uint64_t bit = 1ull << 62;
+
+    while (bit > x) {
+        bit >>= 2;
+    }
+    while (bit) {
+        if (x >= res + bit) {
+            x -= res + bit;
+            res = (res >> 1) + bit;
+        }
+        else {
+            res >>= 1;
+        }
+        bit >>= 2;
+    }
+    return (uint32_t)res;
+}
+
+static void print_jitter(const matstat_state_t *states, size_t nelem)
+{
+    matstat_state_t totals;
+    matstat_clear(&totals);
+    for (size_t k = 0; k < nelem; ++k) {
+        matstat_merge(&totals, &states[k]);
+    }
+    if (totals.count < 2) {
+        print_str("not enough samples\n");
+        return;
+    }
+    print_str("count=");
+    print_u32_dec(totals.count);
+    print_str(" mean=");
+    print_s32_dec(matstat_mean(&totals));
+    print_str(" stddev=");
+    print_u32_dec(isqrt(matstat_variance(&totals)));
+    print_str(" min=");
+    print_s32_dec(totals.min);
+    print_str(" max=");
+    print_s32_dec(totals.max);
+    print_str(" p2p=");
+    print_u32_dec((uint32_t)(totals.max - totals.min));
+    print_str("\n");
+}
+
 static void print_totals(const matstat_state_t *states, size_t nelem, const stat_limits_t *limits)
 {
     matstat_state_t totals;
@@ -182,5 +229,26 @@ void print_results(const result_presentation_t *pres, const matstat_state_t *ref
         }
     }
 
+    print_str("===== Jitter summary =====\n");
+    print_str("Target error per function and over all reference measurements, in reference timer ticks\n");
+    unsigned count = 1;
+    if (DETAILED_STATS) {
+        count = ((LOG2_STATS) ? (TEST_LOG2NUM) : (TEST_NUM));
+    }
+    unsigned num_states = 0;
+    for (unsigned g = 0; g < pres->num_groups; ++g) {
+        for (unsigned c = 0; c < pres->groups[g].num_sub_labels; ++c) {
+            print_str("jitter ");
+            print_str(pres->groups[g].label);
+            print(" ", 1);
+            print_str(pres->groups[g].sub_labels[c]);
+            print_str(": ");
+            print_jitter(&ref_states[num_states], count);
+            num_states += count;
+        }
+    }
+    print_str("jitter: ");
+    print_jitter(ref_states, num_states);
+
     print_str("-------------- END STATISTICS ---------------\n");
 }
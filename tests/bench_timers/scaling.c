@@ -0,0 +1,137 @@
+/*
+ * Copyright (C) 2026 agent <agent@local>
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       xtimer scaling benchmark
+ *
+ * @author      agent <agent@local>
+ *
+ * @}
+ */
+
+#include <stdint.h>
+#include <string.h>
+
+#include "fmt.h"
+#include "irq.h"
+#include "matstat.h"
+#include "mutex.h"
+#include "random.h"
+#include "xtimer.h"
+#include "periph/timer.h"
+
+#include "scaling.h"
+#include "bench_timers_config.h"
+
+typedef struct {
+    xtimer_t xt;
+    unsigned int target_ref; /* Target time in reference timer */
+} scaling_timer_t;
+
+static scaling_timer_t timers[TEST_SCALING_MAX];
+
+static const unsigned scaling_numof[] = { TEST_SCALING_NUMOF };
+
+static matstat_state_t fire_state;
+static unsigned fire_pending;
+static mutex_t mtx_fired = MUTEX_INIT_LOCKED;
+
+static void cb_fire(void *arg)
+{
+    unsigned int now_ref = timer_read(TIM_REF_DEV);
+    scaling_timer_t *t = arg;
+
+    matstat_add(&fire_state, (int32_t)(now_ref - t->target_ref));
+    if (--fire_pending == 0) {
+        mutex_unlock(&mtx_fired);
+    }
+}
+
+static void print_row(unsigned numof, const char *label, const matstat_state_t *state)
+{
+    char buf[20];
+
+    print(buf, fmt_lpad(buf, fmt_u32_dec(buf, numof), 6, ' '));
+    print_str("  ");
+    print_str(label);
+    print(buf, fmt_lpad(buf, fmt_u32_dec(buf, state->count), 8, ' '));
+    print(" ", 1);
+    print(buf, fmt_lpad(buf, fmt_s32_dec(buf, state->min), 6, ' '));
+    print(" ", 1);
+    print(buf, fmt_lpad(buf, fmt_s32_dec(buf, state->max), 6, ' '));
+    print(" ", 1);
+    print(buf, fmt_lpad(buf, fmt_s32_dec(buf, matstat_mean(state)), 6, ' '));
+    print(" ", 1);
+    print(buf, fmt_lpad(buf, fmt_u64_dec(buf, matstat_variance(state)), 9, ' '));
+    print("\n", 1);
+}
+
+static void run_scaling(unsigned numof)
+{
+    matstat_state_t set_state = MATSTAT_STATE_INIT;
+    matstat_state_t remove_state = MATSTAT_STATE_INIT;
+
+    memset(timers, 0, sizeof(timers));
+    for (unsigned k = 0; k < numof; ++k) {
+        timers[k].xt.callback = cb_fire;
+        timers[k].xt.arg = &timers[k];
+    }
+
+    /* set and remove timers which are far enough in the future to not fire
+     * during the measurement */
+    for (unsigned k = 0; k < numof; ++k) {
+        uint32_t offset = TEST_SCALING_OFFSET +
+                          random_uint32_range(0, TEST_SCALING_SPREAD);
+        unsigned int before = timer_read(TIM_REF_DEV);
+        _xtimer_set(&timers[k].xt, offset);
+        unsigned int after = timer_read(TIM_REF_DEV);
+        matstat_add(&set_state, (int32_t)(after - before));
+    }
+    for (unsigned k = 0; k < numof; ++k) {
+        unsigned int before = timer_read(TIM_REF_DEV);
+        xtimer_remove(&timers[k].xt);
+        unsigned int after = timer_read(TIM_REF_DEV);
+        matstat_add(&remove_state, (int32_t)(after - before));
+    }
+
+    /* let all timers fire, in random order */
+    matstat_clear(&fire_state);
+    fire_pending = numof;
+    for (unsigned k = 0; k < numof; ++k) {
+        uint32_t offset = TEST_SCALING_FIRE_OFFSET +
+                          random_uint32_range(0, numof * TEST_SCALING_FIRE_SPACING);
+        unsigned state = irq_disable();
+        timers[k].target_ref = timer_read(TIM_REF_DEV) + TIM_TEST_TO_REF(offset);
+        _xtimer_set(&timers[k].xt, offset);
+        irq_restore(state);
+    }
+    mutex_lock(&mtx_fired);
+
+    print_row(numof, "set   ", &set_state);
+    print_row(numof, "remove", &remove_state);
+    print_row(numof, "fire  ", &fire_state);
+}
+
+void scaling_bench(void)
+{
+    print_str("------------- BEGIN SCALING --------------\n");
+    print_str("set, remove: duration of the call, fire: callback lateness\n");
+    print_str("in reference timer ticks\n");
+    print_str(" timers  op        count    min    max   mean  variance\n");
+    for (unsigned k = 0; k < (sizeof(scaling_numof) / sizeof(scaling_numof[0])); ++k) {
+        if (scaling_numof[k] > TEST_SCALING_MAX) {
+            continue;
+        }
+        run_scaling(scaling_numof[k]);
+    }
+    print_str("-------------- END SCALING ---------------\n");
+}
@@ -0,0 +1,42 @@
+/*
+ * Copyright (C) 2026 agent <agent@local>
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       xtimer scaling benchmark declarations
+ *
+ * @author      agent <agent@local>
+ */
+
+#ifndef SCALING_H
+#define SCALING_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief   Measure the cost of setting, removing and firing xtimers while
+ *          many timers are pending at the same time
+ *
+ * The measurements are repeated for each number of concurrent timers in
+ * TEST_SCALING_NUMOF and printed as a table on stdout.
+ *
+ * @pre The reference timer TIM_REF_DEV must be initialized and running
+ */
+void scaling_bench(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* SCALING_H */
+/** @} */
@@ -0,0 +1,214 @@
+/*
+ * Copyright (C) 2026 agent <agent@local>
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Tests that multicast packets share their payload between
+ *              interfaces
+ *
+ * @author      agent <agent@local>
+ *
+ * @}
+ */
+
+#include <stdio.h>
+#include <string.h>
+
+#include "mutex.h"
+#include "net/ethernet.h"
+#include "net/icmpv6.h"
+#include "net/inet_csum.h"
+#include "net/ipv6/addr.h"
+#include "net/ipv6/hdr.h"
+#include "net/protnum.h"
+#include "net/gnrc/icmpv6/echo.h"
+#include "net/gnrc/ipv6/hdr.h"
+#include "net/gnrc/netapi.h"
+#include "net/gnrc/netif.h"
+#include "net/gnrc/netif/ethernet.h"
+#include "net/gnrc/netreg.h"
+#include "net/gnrc/pktbuf.h"
+#include "net/netdev_test.h"
+#include "xtimer.h"
+
+#define NETIF_NUMOF         (3U)
+#define PAYLOAD_SIZE        (800U)
+#define FRAME_SIZE          (sizeof(ethernet_hdr_t) + sizeof(ipv6_hdr_t) + \
+                             sizeof(icmpv6_echo_t) + PAYLOAD_SIZE)
+#define TIMEOUT             (1U * US_PER_SEC)
+
+static char _netif_stacks[NETIF_NUMOF][THREAD_STACKSIZE_DEFAULT];
+static netdev_test_t _devs[NETIF_NUMOF];
+/* locked by main to keep the interfaces from finishing their transmission */
+static mutex_t _tx_locks[NETIF_NUMOF];
+static uint8_t _frames[NETIF_NUMOF][FRAME_SIZE];
+static size_t _frame_lens[NETIF_NUMOF];
+static volatile unsigned _frames_held;
+
+static inline unsigned _dev_idx(netdev_t *dev)
+{
+    return (netdev_test_t *)dev - _devs;
+}
+
+static int _get_device_type(netdev_t *dev, void *value, size_t max_len)
+{
+    assert(max_len == sizeof(uint16_t));
+    (void)dev;
+
+    *((uint16_t *)value) = NETDEV_TYPE_ETHERNET;
+    return sizeof(uint16_t);
+}
+
+static int _get_max_packet_size(netdev_t *dev, void *value, size_t max_len)
+{
+    assert(max_len == sizeof(uint16_t));
+    (void)dev;
+
+    *((uint16_t *)value) = ETHERNET_DATA_LEN;
+    return sizeof(uint16_t);
+}
+
+static int _get_address(netdev_t *dev, void *value, size_t max_len)
+{
+    uint8_t addr[] = { 0x02, 0x00, 0x00, 0x00, 0x00, 0x01 };
+
+    assert(max_len >= sizeof(addr));
+    addr[sizeof(addr) - 1] += _dev_idx(dev);
+    memcpy(value, addr, sizeof(addr));
+    return sizeof(addr);
+}
+
+static int _send(netdev_t *dev, const iolist_t *iolist)
+{
+    unsigned idx = _dev_idx(dev);
+    uint8_t *frame = _frames[idx];
+    size_t len = 0;
+
+    for (const iolist_t *iol = iolist; iol != NULL; iol = iol->iol_next) {
+        size_t part = iol->iol_len;
+
+        if ((len + part) > FRAME_SIZE) {
+            part = FRAME_SIZE - len;
+        }
+        memcpy(&frame[len], iol->iol_base, part);
+        len += part;
+    }
+    /* only hold the echo request, not e.g. router solicitations */
+    if ((len == FRAME_SIZE) &&
+        (frame[sizeof(ethernet_hdr_t) + sizeof(ipv6_hdr_t)] == ICMPV6_ECHO_REQ)) {
+        _frame_lens[idx] = len;
+        _frames_held++;
+        mutex_lock(&_tx_locks[idx]);
+    }
+    return len;
+}
+
+static void _init_interfaces(void)
+{
+    for (unsigned i = 0; i < NETIF_NUMOF; i++) {
+        netdev_test_setup(&_devs[i], NULL);
+        netdev_test_set_get_cb(&_devs[i], NETOPT_DEVICE_TYPE,
+                               _get_device_type);
+        netdev_test_set_get_cb(&_devs[i], NETOPT_MAX_PACKET_SIZE,
+                               _get_max_packet_size);
+        netdev_test_set_get_cb(&_devs[i], NETOPT_ADDRESS, _get_address);
+        netdev_test_set_send_cb(&_devs[i], _send);
+        mutex_init(&_tx_locks[i]);
+        mutex_lock(&_tx_locks[i]);
+        gnrc_netif_ethernet_create(_netif_stacks[i], THREAD_STACKSIZE_DEFAULT,
+                                   GNRC_NETIF_PRIO, "dummy_netif",
+                                   (netdev_t *)&_devs[i]);
+    }
+    xtimer_usleep(500); /* wait for threads to start */
+}
+
+static int _send_echo_request(void)
+{
+    static uint8_t payload[PAYLOAD_SIZE];
+    ipv6_addr_t dst = IPV6_ADDR_ALL_NODES_LINK_LOCAL;
+    gnrc_pktsnip_t *pkt;
+
+    for (unsigned i = 0; i < sizeof(payload); i++) {
+        payload[i] = i;
+    }
+    pkt = gnrc_icmpv6_echo_build(ICMPV6_ECHO_REQ, 0x4d4c, 1, payload,
+                                 sizeof(payload));
+    if (pkt == NULL) {
+        return -1;
+    }
+    pkt = gnrc_ipv6_hdr_build(pkt, NULL, &dst);
+    if (pkt == NULL) {
+        return -1;
+    }
+    if (gnrc_netapi_dispatch_send(GNRC_NETTYPE_IPV6, GNRC_NETREG_DEMUX_CTX_ALL,
+                                  pkt) == 0) {
+        gnrc_pktbuf_release(pkt);
+        return -1;
+    }
+    return 0;
+}
+
+static bool _check_frame(unsigned idx)
+{
+    ipv6_hdr_t *ipv6 = (ipv6_hdr_t *)&_frames[idx][sizeof(ethernet_hdr_t)];
+    uint16_t len = byteorder_ntohs(ipv6->len);
+    uint16_t csum;
+    char addr_str[IPV6_ADDR_MAX_STR_LEN];
+    bool res = (_frame_lens[idx] == FRAME_SIZE);
+
+    csum = ipv6_hdr_inet_csum(0, ipv6, PROTNUM_ICMPV6, len);
+    csum = inet_csum(csum, (uint8_t *)(ipv6 + 1), len);
+    res = res && (csum == 0xffff);
+    /* every interface uses a source address of its own */
+    for (unsigned i = 0; i < idx; i++) {
+        ipv6_hdr_t *other = (ipv6_hdr_t *)&_frames[i][sizeof(ethernet_hdr_t)];
+
+        if (ipv6_addr_equal(&ipv6->src, &other->src)) {
+            res = false;
+        }
+    }
+    printf("frame %u: %u bytes, src: %s, checksum %s\n", idx,
+           (unsigned)_frame_lens[idx],
+           ipv6_addr_to_str(addr_str, &ipv6->src, sizeof(addr_str)),
+           (csum == 0xffff) ? "valid" : "invalid");
+    return res;
+}
+
+int main(void)
+{
+    uint32_t start;
+    bool success = true;
+
+    _init_interfaces();
+    printf("payload: %u bytes\n", PAYLOAD_SIZE);
+    if (_send_echo_request() < 0) {
+        puts("FAILED: unable to send echo request");
+        return 1;
+    }
+    start = xtimer_now_usec();
+    while (_frames_held < NETIF_NUMOF) {
+        if ((xtimer_now_usec() - start) > TIMEOUT) {
+            printf("FAILED: only %u frames sent\n", _frames_held);
+            return 1;
+        }
+        xtimer_usleep(1000);
+    }
+    /* all interfaces hold their frame now */
+    gnrc_pktbuf_stats();
+    for (unsigned i = 0; i < NETIF_NUMOF; i++) {
+        success = _check_frame(i) && success;
+    }
+    for (unsigned i = 0; i < NETIF_NUMOF; i++) {
+        mutex_unlock(&_tx_locks[i]);
+    }
+    puts(success ? "SUCCESS" : "FAILED");
+    return 0;
+}
@@ -0,0 +1,30 @@
+#!/usr/bin/env python3
+
+# Copyright (C) 2026 agent <agent@local>
+#
+# This file is subject to the terms and conditions of the GNU Lesser
+# General Public License v2.1. See the file LICENSE in the top level
+# directory for more details.
+
+import sys
+from testrunner import run
+
+
+NETIF_NUMOF = 3
+
+
+def testfunc(child):
+    child.expect(r"payload: (\d+) bytes")
+    payload = int(child.match.group(1))
+    child.expect(r"used: (\d+) bytes")
+    used = int(child.match.group(1))
+    # the payload is in the packet buffer only once, not once per interface
+    assert used < (2 * payload), "{} bytes used".format(used)
+    for i in range(NETIF_NUMOF):
+        child.expect_exact("frame {}: ".format(i))
+        child.expect_exact("checksum valid")
+    child.expect_exact("SUCCESS")
+
+
+if __name__ == "__main__":
+    sys.exit(run(testfunc))
@@ -0,0 +1,133 @@
+/*
+ * Copyright (C) 2026 agent <agent@local>
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Tests handing packet trains down the network stack with
+ *              gnrc_netapi_send_train()
+ *
+ * @author      agent <agent@local>
+ *
+ * @}
+ */
+
+#include <stdbool.h>
+#include <stdio.h>
+
+#include "msg.h"
+#include "net/gnrc/netapi.h"
+#include "net/gnrc/pktbuf.h"
+#include "net/gnrc/pktqueue.h"
+#include "thread.h"
+
+#define TEST_TRAIN_LEN      (4U)
+#define MSG_QUEUE_SIZE      (4U)
+
+static char _stack[THREAD_STACKSIZE_DEFAULT];
+static msg_t _msg_queue[MSG_QUEUE_SIZE];
+/* number of packets the receiver takes from each train */
+static unsigned _take;
+
+/* a network module that only takes the first _take packets of a train, like
+ * a busy one would */
+static void *_receiver(void *arg)
+{
+    msg_t msg, reply = { .type = GNRC_NETAPI_MSG_TYPE_ACK };
+
+    (void)arg;
+    msg_init_queue(_msg_queue, MSG_QUEUE_SIZE);
+    while (1) {
+        msg_receive(&msg);
+        if (msg.type != GNRC_NETAPI_MSG_TYPE_SND_TRAIN) {
+            continue;
+        }
+        reply.content.value = 0;
+        for (gnrc_pktqueue_t *node = msg.content.ptr;
+             (node != NULL) && (reply.content.value < _take);
+             node = node->next) {
+            /* "sends" the packet */
+            gnrc_pktbuf_release(node->pkt);
+            reply.content.value++;
+        }
+        msg_reply(&msg, &reply);
+    }
+    return NULL;
+}
+
+/* sends a train of TEST_TRAIN_LEN packets to pid, of which the receiver takes
+ * take, and checks that the rest is handed back in order */
+static bool _test_send_train(kernel_pid_t pid, unsigned take)
+{
+    gnrc_pktqueue_t nodes[TEST_TRAIN_LEN];
+    gnrc_pktqueue_t *train = NULL;
+    bool res = true;
+    unsigned left = 0;
+
+    for (unsigned i = 0; i < TEST_TRAIN_LEN; i++) {
+        nodes[i].pkt = gnrc_pktbuf_add(NULL, NULL, 8, GNRC_NETTYPE_UNDEF);
+        if (nodes[i].pkt == NULL) {
+            puts("error: packet buffer full");
+            return false;
+        }
+        nodes[i].next = NULL;
+        gnrc_pktqueue_add(&train, &nodes[i]);
+    }
+    _take = take;
+    if (gnrc_netapi_send_train(pid, &train) != (int)take) {
+        res = false;
+    }
+    /* the packets that were not taken are still owned by the sender */
+    for (unsigned i = take; train != NULL; i++) {
+        gnrc_pktqueue_t *node = gnrc_pktqueue_remove_head(&train);
+
+        if (node != &nodes[i]) {
+            res = false;
+        }
+        gnrc_pktbuf_release(node->pkt);
+        left++;
+    }
+    return res && (left == (TEST_TRAIN_LEN - take)) &&
+           gnrc_pktbuf_is_empty();
+}
+
+int main(void)
+{
+    kernel_pid_t pid = thread_create(_stack, sizeof(_stack),
+                                     THREAD_PRIORITY_MAIN - 1,
+                                     THREAD_CREATE_STACKTEST, _receiver,
+                                     NULL, "receiver");
+    bool success = true;
+
+    if (_test_send_train(pid, TEST_TRAIN_LEN)) {
+        puts("all packets taken: ok");
+    }
+    else {
+        puts("all packets taken: failed");
+        success = false;
+    }
+    if (_test_send_train(pid, TEST_TRAIN_LEN / 2)) {
+        puts("some packets taken: ok");
+    }
+    else {
+        puts("some packets taken: failed");
+        success = false;
+    }
+    if (_test_send_train(pid, 0)) {
+        puts("no packets taken: ok");
+    }
+    else {
+        puts("no packets taken: failed");
+        success = false;
+    }
+    puts(success ? "SUCCESS" : "FAILED");
+
+    return 0;
+}
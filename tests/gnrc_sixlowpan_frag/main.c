@@ -0,0 +1,348 @@
+/*
+ * Copyright (C) 2026 agent <agent@local>
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Tests reassembly of 6LoWPAN fragments
+ *
+ * @author      agent <agent@local>
+ *
+ * @}
+ */
+
+#include <errno.h>
+#include <inttypes.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "byteorder.h"
+#include "msg.h"
+#include "net/gnrc/netapi.h"
+#include "net/gnrc/netif.h"
+#include "net/gnrc/netif/ieee802154.h"
+#include "net/gnrc/netreg.h"
+#include "net/gnrc/pktbuf.h"
+#include "net/ieee802154.h"
+#include "net/inet_csum.h"
+#include "net/ipv6/hdr.h"
+#include "net/netdev_test.h"
+#include "net/protnum.h"
+#include "net/sixlowpan.h"
+#include "net/udp.h"
+#include "thread.h"
+#include "xtimer.h"
+
+/* number of datagrams reassembled at once */
+#ifndef TEST_DATAGRAMS
+#define TEST_DATAGRAMS      (32U)
+#endif
+#define TEST_PORT           (5683U)
+/* datagrams are split into fragments at these offsets (in units of 8 byte) */
+#define TEST_OFFSET_1       (8U)
+#define TEST_OFFSET_2       (10U)
+#define TEST_UNITS          (TEST_OFFSET_2 + 2U)
+#define TEST_FRAGMENTS      (3U)
+#define TEST_DATAGRAM_SIZE  (TEST_UNITS * 8U)
+#define TEST_PAYLOAD_LEN    (TEST_DATAGRAM_SIZE - sizeof(ipv6_hdr_t) - \
+                             sizeof(udp_hdr_t))
+/* tags of the datagrams of each part of the test */
+#define TEST_TAG_DUPLICATE  (0x100U)
+#define TEST_TAG_OVERLAP    (0x101U)
+#define TEST_MHR_LEN        (21U)
+#define TEST_MAX_FRAG_SIZE  (102U)
+#define MSG_TYPE_CONSUMED   (0x8ff0)
+#define MSG_QUEUE_SIZE      (8U)
+#define TEST_TIMEOUT        (100U * US_PER_MS)
+
+static char _netif_stack[THREAD_STACKSIZE_DEFAULT];
+static netdev_test_t _dev;
+static msg_t _msg_queue[MSG_QUEUE_SIZE];
+static kernel_pid_t _main_pid;
+static unsigned _received;
+
+static uint8_t _datagram[TEST_DATAGRAM_SIZE];
+static uint8_t _frame[IEEE802154_FRAME_LEN_MAX];
+static size_t _frame_len;
+
+/* fd01::1 (this node) and fd01::2 (sender) */
+static const ipv6_addr_t _local = { .u8 = { 0xfd, 0x01, [15] = 0x01 } };
+static const ipv6_addr_t _remote = { .u8 = { 0xfd, 0x01, [15] = 0x02 } };
+
+/* builds an uncompressed UDP datagram from fd01::2 to fd01::1 */
+static void _build_datagram(void)
+{
+    ipv6_hdr_t *ipv6 = (ipv6_hdr_t *)_datagram;
+    udp_hdr_t *udp = (udp_hdr_t *)(ipv6 + 1);
+    const uint16_t udp_len = sizeof(udp_hdr_t) + TEST_PAYLOAD_LEN;
+    uint16_t csum;
+
+    memset(_datagram, 0, sizeof(_datagram));
+    ipv6_hdr_set_version(ipv6);
+    ipv6->len = byteorder_htons(udp_len);
+    ipv6->nh = PROTNUM_UDP;
+    ipv6->hl = 64;
+    memcpy(&ipv6->src, &_remote, sizeof(ipv6_addr_t));
+    memcpy(&ipv6->dst, &_local, sizeof(ipv6_addr_t));
+    udp->src_port = byteorder_htons(TEST_PORT);
+    udp->dst_port = byteorder_htons(TEST_PORT);
+    udp->length = byteorder_htons(udp_len);
+    memset(udp + 1, 0xbe, TEST_PAYLOAD_LEN);
+    csum = ipv6_hdr_inet_csum(0, ipv6, PROTNUM_UDP, udp_len);
+    csum = inet_csum(csum, (uint8_t *)udp, udp_len);
+    udp->checksum = byteorder_htons((csum == 0xffff) ? csum : ~csum);
+}
+
+/* builds the fragment of datagram tag covering the units [start, end) of 8
+ * byte as received from the neighbor */
+static void _build_fragment(uint16_t tag, uint8_t start, uint8_t end)
+{
+    static const uint8_t mhr[TEST_MHR_LEN] = {
+        /* data frame, PAN ID compression, long addresses */
+        0x41, 0xcc, 0x00, 0x23, 0x00,
+        /* destination 02:00:00:ff:fe:00:00:01 (little endian) */
+        0x01, 0x00, 0x00, 0xfe, 0xff, 0x00, 0x00, 0x02,
+        /* source 02:00:00:ff:fe:00:00:02 (little endian) */
+        0x02, 0x00, 0x00, 0xfe, 0xff, 0x00, 0x00, 0x02,
+    };
+    sixlowpan_frag_n_t *frag = (sixlowpan_frag_n_t *)&_frame[TEST_MHR_LEN];
+
+    memcpy(_frame, mhr, sizeof(mhr));
+    frag->disp_size = byteorder_htons(TEST_DATAGRAM_SIZE);
+    frag->tag = byteorder_htons(tag);
+    if (start == 0) {
+        uint8_t *disp = &_frame[TEST_MHR_LEN + sizeof(sixlowpan_frag_t)];
+
+        frag->disp_size.u8[0] |= SIXLOWPAN_FRAG_1_DISP;
+        *disp = SIXLOWPAN_UNCOMP;
+        _frame_len = TEST_MHR_LEN + sizeof(sixlowpan_frag_t) + 1;
+    }
+    else {
+        frag->disp_size.u8[0] |= SIXLOWPAN_FRAG_N_DISP;
+        frag->offset = start;
+        _frame_len = TEST_MHR_LEN + sizeof(sixlowpan_frag_n_t);
+    }
+    memcpy(&_frame[_frame_len], &_datagram[start * 8U], (end - start) * 8U);
+    _frame_len += (end - start) * 8U;
+}
+
+/* runs in the interface's thread */
+static int _recv(netdev_t *dev, char *buf, int len, void *info)
+{
+    msg_t msg = { .type = MSG_TYPE_CONSUMED };
+
+    (void)dev;
+    (void)info;
+    if (buf == NULL) {
+        return _frame_len;
+    }
+    if (((unsigned)len) < _frame_len) {
+        return -ENOBUFS;
+    }
+    memcpy(buf, _frame, _frame_len);
+    /* _frame may be overwritten with the next fragment now */
+    msg_try_send(&msg, _main_pid);
+    return _frame_len;
+}
+
+static void _isr(netdev_t *dev)
+{
+    dev->event_callback(dev, NETDEV_EVENT_RX_COMPLETE);
+}
+
+static int _get_device_type(netdev_t *dev, void *value, size_t max_len)
+{
+    (void)dev;
+    (void)max_len;
+    *((uint16_t *)value) = NETDEV_TYPE_IEEE802154;
+    return sizeof(uint16_t);
+}
+
+static int _get_max_packet_size(netdev_t *dev, void *value, size_t max_len)
+{
+    (void)dev;
+    (void)max_len;
+    *((uint16_t *)value) = TEST_MAX_FRAG_SIZE;
+    return sizeof(uint16_t);
+}
+
+static int _get_src_len(netdev_t *dev, void *value, size_t max_len)
+{
+    (void)dev;
+    (void)max_len;
+    *((uint16_t *)value) = IEEE802154_LONG_ADDRESS_LEN;
+    return sizeof(uint16_t);
+}
+
+static gnrc_netif_t *_init_interface(void)
+{
+    gnrc_netif_t *netif;
+
+    netdev_test_setup(&_dev, NULL);
+    netdev_test_set_recv_cb(&_dev, _recv);
+    netdev_test_set_isr_cb(&_dev, _isr);
+    netdev_test_set_get_cb(&_dev, NETOPT_DEVICE_TYPE, _get_device_type);
+    netdev_test_set_get_cb(&_dev, NETOPT_MAX_PACKET_SIZE,
+                           _get_max_packet_size);
+    netdev_test_set_get_cb(&_dev, NETOPT_SRC_LEN, _get_src_len);
+    _dev.netdev.proto = GNRC_NETTYPE_SIXLOWPAN;
+    netif = gnrc_netif_ieee802154_create(_netif_stack, sizeof(_netif_stack),
+                                         GNRC_NETIF_PRIO, "frag_netif",
+                                         (netdev_t *)&_dev);
+    xtimer_usleep(500); /* wait for thread to start */
+    if (gnrc_netapi_set(netif->pid, NETOPT_IPV6_ADDR, 64U << 8U,
+                        (void *)&_local, sizeof(_local)) < 0) {
+        puts("error: unable to add fd01::1/64");
+    }
+    return netif;
+}
+
+/* handles a message to the main thread, counting received datagrams */
+static void _handle(msg_t *msg)
+{
+    if (msg->type == GNRC_NETAPI_MSG_TYPE_RCV) {
+        _received++;
+        gnrc_pktbuf_release(msg->content.ptr);
+    }
+}
+
+/* waits up to TEST_TIMEOUT for a message of the given type, handling all
+ * others */
+static int _wait_for(msg_t *msg, uint16_t type)
+{
+    do {
+        if (xtimer_msg_receive_timeout(msg, TEST_TIMEOUT) < 0) {
+            return -ETIMEDOUT;
+        }
+        _handle(msg);
+    } while (msg->type != type);
+    return 0;
+}
+
+/* hands a fragment to the interface and waits until it was read */
+static int _inject(gnrc_netif_t *netif, uint16_t tag, uint8_t start,
+                   uint8_t end)
+{
+    msg_t msg;
+
+    _build_fragment(tag, start, end);
+    netif->dev->event_callback(netif->dev, NETDEV_EVENT_ISR);
+    return _wait_for(&msg, MSG_TYPE_CONSUMED);
+}
+
+/* waits until no more datagrams are received and returns their number */
+static unsigned _settle(void)
+{
+    msg_t msg;
+
+    while (xtimer_msg_receive_timeout(&msg, TEST_TIMEOUT) >= 0) {
+        _handle(&msg);
+    }
+    return _received;
+}
+
+/* reassembles TEST_DATAGRAMS datagrams at once and returns the number of
+ * them delivered */
+static unsigned _test_reassembly(gnrc_netif_t *netif)
+{
+    static const uint8_t bounds[TEST_FRAGMENTS + 1] = {
+        0, TEST_OFFSET_1, TEST_OFFSET_2, TEST_UNITS
+    };
+    uint32_t start, stop;
+    msg_t msg;
+
+    _received = 0;
+    start = xtimer_now_usec();
+    /* all first fragments first, so all datagrams are reassembled at once */
+    for (unsigned f = 0; f < TEST_FRAGMENTS; f++) {
+        for (unsigned d = 0; d < TEST_DATAGRAMS; d++) {
+            if (_inject(netif, d, bounds[f], bounds[f + 1]) < 0) {
+                puts("error: fragment was not read");
+            }
+        }
+    }
+    /* the last datagrams may still be on their way up the stack */
+    while ((_received < TEST_DATAGRAMS) &&
+           (xtimer_msg_receive_timeout(&msg, TEST_TIMEOUT) >= 0)) {
+        _handle(&msg);
+    }
+    stop = xtimer_now_usec();
+
+    printf("{ \"entries\" : %u, \"buckets\" : %u, \"datagrams\" : %u, "
+           "\"received\" : %u, \"us\" : %" PRIu32 " }\n",
+           RBUF_SIZE, RBUF_HASH_SIZE, TEST_DATAGRAMS, _received,
+           stop - start);
+    return _received;
+}
+
+/* a fragment received twice is ignored the second time */
+static bool _test_duplicate(gnrc_netif_t *netif)
+{
+    _received = 0;
+    _inject(netif, TEST_TAG_DUPLICATE, TEST_OFFSET_1, TEST_OFFSET_2);
+    _inject(netif, TEST_TAG_DUPLICATE, 0, TEST_OFFSET_1);
+    _inject(netif, TEST_TAG_DUPLICATE, TEST_OFFSET_1, TEST_OFFSET_2);
+    _inject(netif, TEST_TAG_DUPLICATE, TEST_OFFSET_2, TEST_UNITS);
+    return _settle() == 1;
+}
+
+/* a fragment that covers only units received before, but with another size,
+ * discards the datagram and starts a new one
+ * (https://tools.ietf.org/html/rfc4944#section-5.3) */
+static bool _test_overlap(gnrc_netif_t *netif)
+{
+    _received = 0;
+    _inject(netif, TEST_TAG_OVERLAP, TEST_OFFSET_1, TEST_UNITS);
+    _inject(netif, TEST_TAG_OVERLAP, TEST_OFFSET_1, TEST_OFFSET_2);
+    /* would complete the discarded datagram */
+    _inject(netif, TEST_TAG_OVERLAP, 0, TEST_OFFSET_1);
+    if (_settle() != 0) {
+        return false;
+    }
+    _inject(netif, TEST_TAG_OVERLAP, TEST_OFFSET_2, TEST_UNITS);
+    return _settle() == 1;
+}
+
+int main(void)
+{
+    gnrc_netreg_entry_t udp = GNRC_NETREG_ENTRY_INIT_PID(TEST_PORT,
+                                                         thread_getpid());
+    gnrc_netif_t *netif;
+    bool success = true;
+
+    _main_pid = thread_getpid();
+    msg_init_queue(_msg_queue, MSG_QUEUE_SIZE);
+    netif = _init_interface();
+    gnrc_netreg_register(GNRC_NETTYPE_UDP, &udp);
+    /* let neighbor discovery settle */
+    xtimer_sleep(1);
+    _settle();
+
+    _build_datagram();
+    success &= (_test_reassembly(netif) == TEST_DATAGRAMS);
+    if (_test_duplicate(netif)) {
+        puts("duplicate fragment: ok");
+    }
+    else {
+        puts("duplicate fragment: failed");
+        success = false;
+    }
+    if (_test_overlap(netif)) {
+        puts("overlapping fragment: ok");
+    }
+    else {
+        puts("overlapping fragment: failed");
+        success = false;
+    }
+    puts(success ? "SUCCESS" : "FAILED");
+
+    return 0;
+}
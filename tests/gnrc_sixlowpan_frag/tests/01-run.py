@@ -0,0 +1,22 @@
+#!/usr/bin/env python3
+
+# Copyright (C) 2026 agent <agent@local>
+#
+# This file is subject to the terms and conditions of the GNU Lesser
+# General Public License v2.1. See the file LICENSE in the top level
+# directory for more details.
+
+import sys
+from testrunner import run
+
+
+def testfunc(child):
+    child.expect(r"{ \"entries\" : \d+, \"buckets\" : \d+, \"datagrams\" : \d+, "
+                 r"\"received\" : \d+, \"us\" : \d+ }")
+    child.expect_exact("duplicate fragment: ok")
+    child.expect_exact("overlapping fragment: ok")
+    child.expect_exact("SUCCESS")
+
+
+if __name__ == "__main__":
+    sys.exit(run(testfunc, timeout=60))
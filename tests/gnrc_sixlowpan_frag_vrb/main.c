@@ -0,0 +1,340 @@
+/*
+ * Copyright (C) 2026 agent <agent@local>
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Tests forwarding of 6LoWPAN fragments without reassembly
+ *
+ * @author      agent <agent@local>
+ *
+ * @}
+ */
+
+#include <errno.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "byteorder.h"
+#include "msg.h"
+#include "net/gnrc/ipv6/nib/ft.h"
+#include "net/gnrc/netapi.h"
+#include "net/gnrc/netif.h"
+#include "net/gnrc/netif/ieee802154.h"
+#include "net/ieee802154.h"
+#include "net/ipv6/hdr.h"
+#include "net/netdev_test.h"
+#include "net/protnum.h"
+#include "net/sixlowpan.h"
+#include "net/udp.h"
+#include "thread.h"
+#include "xtimer.h"
+
+#ifdef MODULE_GNRC_SIXLOWPAN_FRAG_VRB
+#define VRB                 (1)
+#else
+#define VRB                 (0)
+#endif
+
+/* more than the reassembly buffer can hold */
+#define TEST_DATAGRAMS      (8U)
+#define TEST_PORT           (5683U)
+/* datagrams are split into fragments at these offsets (in units of 8 byte) */
+#define TEST_OFFSET_1       (8U)
+#define TEST_OFFSET_2       (10U)
+#define TEST_UNITS          (TEST_OFFSET_2 + 2U)
+#define TEST_FRAGMENTS      (3U)
+#define TEST_DATAGRAM_SIZE  (TEST_UNITS * 8U)
+#define TEST_PAYLOAD_LEN    (TEST_DATAGRAM_SIZE - sizeof(ipv6_hdr_t) - \
+                             sizeof(udp_hdr_t))
+/* tag of the datagram that is received twice */
+#define TEST_TAG_DUPLICATE  (0x100U)
+#define TEST_MHR_LEN        (21U)
+#define TEST_MAX_FRAG_SIZE  (102U)
+#define MSG_TYPE_FORWARDED  (0x8ff0)
+#define MSG_QUEUE_SIZE      (8U)
+#define TEST_TIMEOUT        (100U * US_PER_MS)
+
+static char _netif_stack[THREAD_STACKSIZE_DEFAULT];
+static netdev_test_t _dev;
+static msg_t _msg_queue[MSG_QUEUE_SIZE];
+static kernel_pid_t _main_pid;
+
+static uint8_t _datagram[TEST_DATAGRAM_SIZE];
+static uint8_t _frame[IEEE802154_FRAME_LEN_MAX];
+static size_t _frame_len;
+static uint8_t _sent[IEEE802154_FRAME_LEN_MAX];
+
+/* fd01::1 (this node), fd01::2 (sender) and fd02::1 (forwarded to) */
+static const ipv6_addr_t _local = { .u8 = { 0xfd, 0x01, [15] = 0x01 } };
+static const ipv6_addr_t _remote = { .u8 = { 0xfd, 0x01, [15] = 0x02 } };
+static const ipv6_addr_t _offlink = { .u8 = { 0xfd, 0x02, [15] = 0x01 } };
+/* link-local address of the neighbor that sends the frames, its IID is
+ * derived from its link-layer address 02:00:00:ff:fe:00:00:02 */
+static const ipv6_addr_t _neighbor = { .u8 = { 0xfe, 0x80, [11] = 0xff,
+                                               [12] = 0xfe, [15] = 0x02 } };
+
+/* builds an uncompressed UDP datagram from fd01::2 to fd02::1 */
+static void _build_datagram(void)
+{
+    ipv6_hdr_t *ipv6 = (ipv6_hdr_t *)_datagram;
+    udp_hdr_t *udp = (udp_hdr_t *)(ipv6 + 1);
+    const uint16_t udp_len = sizeof(udp_hdr_t) + TEST_PAYLOAD_LEN;
+
+    memset(_datagram, 0, sizeof(_datagram));
+    ipv6_hdr_set_version(ipv6);
+    ipv6->len = byteorder_htons(udp_len);
+    ipv6->nh = PROTNUM_UDP;
+    ipv6->hl = 64;
+    memcpy(&ipv6->src, &_remote, sizeof(ipv6_addr_t));
+    memcpy(&ipv6->dst, &_offlink, sizeof(ipv6_addr_t));
+    udp->src_port = byteorder_htons(TEST_PORT);
+    udp->dst_port = byteorder_htons(TEST_PORT);
+    udp->length = byteorder_htons(udp_len);
+    /* checksum is not verified by a router */
+    udp->checksum = byteorder_htons(0xffff);
+    memset(udp + 1, 0xbe, TEST_PAYLOAD_LEN);
+}
+
+/* builds the fragment of datagram tag covering the units [start, end) of 8
+ * byte as received from the neighbor */
+static void _build_fragment(uint16_t tag, uint8_t start, uint8_t end)
+{
+    static const uint8_t mhr[TEST_MHR_LEN] = {
+        /* data frame, PAN ID compression, long addresses */
+        0x41, 0xcc, 0x00, 0x23, 0x00,
+        /* destination 02:00:00:ff:fe:00:00:01 (little endian) */
+        0x01, 0x00, 0x00, 0xfe, 0xff, 0x00, 0x00, 0x02,
+        /* source 02:00:00:ff:fe:00:00:02 (little endian) */
+        0x02, 0x00, 0x00, 0xfe, 0xff, 0x00, 0x00, 0x02,
+    };
+    sixlowpan_frag_n_t *frag = (sixlowpan_frag_n_t *)&_frame[TEST_MHR_LEN];
+
+    memcpy(_frame, mhr, sizeof(mhr));
+    frag->disp_size = byteorder_htons(TEST_DATAGRAM_SIZE);
+    frag->tag = byteorder_htons(tag);
+    if (start == 0) {
+        uint8_t *disp = &_frame[TEST_MHR_LEN + sizeof(sixlowpan_frag_t)];
+
+        frag->disp_size.u8[0] |= SIXLOWPAN_FRAG_1_DISP;
+        *disp = SIXLOWPAN_UNCOMP;
+        _frame_len = TEST_MHR_LEN + sizeof(sixlowpan_frag_t) + 1;
+    }
+    else {
+        frag->disp_size.u8[0] |= SIXLOWPAN_FRAG_N_DISP;
+        frag->offset = start;
+        _frame_len = TEST_MHR_LEN + sizeof(sixlowpan_frag_n_t);
+    }
+    memcpy(&_frame[_frame_len], &_datagram[start * 8U], (end - start) * 8U);
+    _frame_len += (end - start) * 8U;
+}
+
+/* runs in the interface's thread */
+static int _recv(netdev_t *dev, char *buf, int len, void *info)
+{
+    (void)dev;
+    (void)info;
+    if (buf == NULL) {
+        return _frame_len;
+    }
+    if (((unsigned)len) < _frame_len) {
+        return -ENOBUFS;
+    }
+    memcpy(buf, _frame, _frame_len);
+    return _frame_len;
+}
+
+static void _isr(netdev_t *dev)
+{
+    dev->event_callback(dev, NETDEV_EVENT_RX_COMPLETE);
+}
+
+/* runs in the interface's thread */
+static int _send(netdev_t *dev, const iolist_t *iolist)
+{
+    sixlowpan_frag_n_t *frag;
+    size_t len = 0, mhr_len;
+    msg_t msg = { .type = MSG_TYPE_FORWARDED };
+
+    (void)dev;
+    for (const iolist_t *iol = iolist; iol; iol = iol->iol_next) {
+        if ((len + iol->iol_len) > sizeof(_sent)) {
+            return -ENOBUFS;
+        }
+        memcpy(&_sent[len], iol->iol_base, iol->iol_len);
+        len += iol->iol_len;
+    }
+    mhr_len = ieee802154_get_frame_hdr_len(_sent);
+    frag = (sixlowpan_frag_n_t *)&_sent[mhr_len];
+    /* ignore neighbor discovery, only report the forwarded fragments */
+    if ((mhr_len == 0) || (len <= (mhr_len + sizeof(sixlowpan_frag_t))) ||
+        !sixlowpan_frag_is((sixlowpan_frag_t *)frag)) {
+        return (int)len;
+    }
+    /* report tag and offset */
+    msg.content.value = (uint32_t)byteorder_ntohs(frag->tag) << 16;
+    if ((frag->disp_size.u8[0] & SIXLOWPAN_FRAG_DISP_MASK) ==
+        SIXLOWPAN_FRAG_N_DISP) {
+        msg.content.value |= frag->offset;
+    }
+    msg_try_send(&msg, _main_pid);
+    return (int)len;
+}
+
+static int _get_device_type(netdev_t *dev, void *value, size_t max_len)
+{
+    (void)dev;
+    (void)max_len;
+    *((uint16_t *)value) = NETDEV_TYPE_IEEE802154;
+    return sizeof(uint16_t);
+}
+
+static int _get_max_packet_size(netdev_t *dev, void *value, size_t max_len)
+{
+    (void)dev;
+    (void)max_len;
+    *((uint16_t *)value) = TEST_MAX_FRAG_SIZE;
+    return sizeof(uint16_t);
+}
+
+static int _get_src_len(netdev_t *dev, void *value, size_t max_len)
+{
+    (void)dev;
+    (void)max_len;
+    *((uint16_t *)value) = IEEE802154_LONG_ADDRESS_LEN;
+    return sizeof(uint16_t);
+}
+
+static gnrc_netif_t *_init_interface(void)
+{
+    gnrc_netif_t *netif;
+
+    netdev_test_setup(&_dev, NULL);
+    netdev_test_set_recv_cb(&_dev, _recv);
+    netdev_test_set_isr_cb(&_dev, _isr);
+    netdev_test_set_send_cb(&_dev, _send);
+    netdev_test_set_get_cb(&_dev, NETOPT_DEVICE_TYPE, _get_device_type);
+    netdev_test_set_get_cb(&_dev, NETOPT_MAX_PACKET_SIZE,
+                           _get_max_packet_size);
+    netdev_test_set_get_cb(&_dev, NETOPT_SRC_LEN, _get_src_len);
+    _dev.netdev.proto = GNRC_NETTYPE_SIXLOWPAN;
+    netif = gnrc_netif_ieee802154_create(_netif_stack, sizeof(_netif_stack),
+                                         GNRC_NETIF_PRIO, "vrb_netif",
+                                         (netdev_t *)&_dev);
+    xtimer_usleep(500); /* wait for thread to start */
+    if (gnrc_netapi_set(netif->pid, NETOPT_IPV6_ADDR, 64U << 8U,
+                        (void *)&_local, sizeof(_local)) < 0) {
+        puts("error: unable to add fd01::1/64");
+    }
+    if (gnrc_ipv6_nib_ft_add(NULL, 0, &_neighbor, netif->pid, 0) < 0) {
+        puts("error: unable to add default route");
+    }
+    return netif;
+}
+
+/* hands a fragment to the interface and returns the tag it was forwarded
+ * with, or -1 if it was not forwarded as expected */
+static int _forward(gnrc_netif_t *netif, uint16_t tag, uint8_t start,
+                    uint8_t end)
+{
+    msg_t msg;
+
+    _build_fragment(tag, start, end);
+    netif->dev->event_callback(netif->dev, NETDEV_EVENT_ISR);
+    if ((xtimer_msg_receive_timeout(&msg, TEST_TIMEOUT) < 0) ||
+        (msg.type != MSG_TYPE_FORWARDED) ||
+        ((msg.content.value & 0xff) != start)) {
+        return -1;
+    }
+    return msg.content.value >> 16;
+}
+
+/* forwards TEST_DATAGRAMS datagrams at once and returns the number of
+ * fragments forwarded as soon as they arrived */
+static unsigned _test_forwarding(gnrc_netif_t *netif)
+{
+    static const uint8_t bounds[TEST_FRAGMENTS + 1] = {
+        0, TEST_OFFSET_1, TEST_OFFSET_2, TEST_UNITS
+    };
+    int out_tags[TEST_DATAGRAMS];
+    unsigned forwarded = 0;
+
+    /* all first fragments first, so all datagrams are in flight at once */
+    for (unsigned f = 0; f < TEST_FRAGMENTS; f++) {
+        for (unsigned d = 0; d < TEST_DATAGRAMS; d++) {
+            int out_tag = _forward(netif, d, bounds[f], bounds[f + 1]);
+
+            if (f == 0) {
+                out_tags[d] = out_tag;
+            }
+            if ((out_tag >= 0) && (out_tag == out_tags[d])) {
+                forwarded++;
+            }
+        }
+    }
+
+    printf("{ \"vrb\" : %u, \"datagrams\" : %u, \"fragments\" : %u, "
+           "\"forwarded\" : %u }\n", VRB, TEST_DATAGRAMS,
+           TEST_DATAGRAMS * TEST_FRAGMENTS, forwarded);
+    return forwarded;
+}
+
+/* a fragment received twice is only forwarded once */
+static bool _test_forwarding_duplicate(gnrc_netif_t *netif)
+{
+    msg_t msg;
+    int out_tag;
+
+    out_tag = _forward(netif, TEST_TAG_DUPLICATE, 0, TEST_OFFSET_1);
+    if ((out_tag < 0) ||
+        (_forward(netif, TEST_TAG_DUPLICATE, TEST_OFFSET_1,
+                  TEST_OFFSET_2) != out_tag)) {
+        return false;
+    }
+    _build_fragment(TEST_TAG_DUPLICATE, TEST_OFFSET_1, TEST_OFFSET_2);
+    netif->dev->event_callback(netif->dev, NETDEV_EVENT_ISR);
+    if ((xtimer_msg_receive_timeout(&msg, TEST_TIMEOUT) >= 0) &&
+        (msg.type == MSG_TYPE_FORWARDED)) {
+        return false;
+    }
+    return _forward(netif, TEST_TAG_DUPLICATE, TEST_OFFSET_2,
+                    TEST_UNITS) == out_tag;
+}
+
+int main(void)
+{
+    gnrc_netif_t *netif;
+    bool success = true;
+
+    _main_pid = thread_getpid();
+    msg_init_queue(_msg_queue, MSG_QUEUE_SIZE);
+    netif = _init_interface();
+    _build_datagram();
+    /* let neighbor discovery settle */
+    xtimer_sleep(1);
+    while (msg_avail() > 0) {
+        msg_t msg;
+
+        msg_receive(&msg);
+    }
+
+    success &= (_test_forwarding(netif) == TEST_DATAGRAMS * TEST_FRAGMENTS);
+    if (_test_forwarding_duplicate(netif)) {
+        puts("duplicate forwarded fragment: ok");
+    }
+    else {
+        puts("duplicate forwarded fragment: failed");
+        success = false;
+    }
+    puts(success ? "SUCCESS" : "FAILED");
+
+    return 0;
+}
@@ -0,0 +1,216 @@
+/*
+ * Copyright (C) 2026 agent <agent@local>
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Measure how long a high priority thread waits for a mutex
+ *              held by a low priority thread while a medium priority thread
+ *              is busy
+ *
+ * @author      agent <agent@local>
+ *
+ * @}
+ */
+
+#include <stdint.h>
+#include <stdio.h>
+
+#include "mutex.h"
+#include "thread.h"
+#include "xtimer.h"
+
+#ifndef ROUNDS
+#define ROUNDS          (10U)
+#endif
+
+/* time the low priority thread holds the mutex */
+#ifndef LOW_WORK_US
+#define LOW_WORK_US     (2U * US_PER_MS)
+#endif
+
+/* time the medium priority thread keeps the CPU busy */
+#ifndef MID_BUSY_US
+#define MID_BUSY_US     (50U * US_PER_MS)
+#endif
+
+static char _stack_low[THREAD_STACKSIZE_DEFAULT];
+static char _stack_mid[THREAD_STACKSIZE_DEFAULT];
+static char _stack_high[THREAD_STACKSIZE_DEFAULT];
+
+static kernel_pid_t _pid_low;
+static kernel_pid_t _pid_mid;
+static kernel_pid_t _pid_high;
+
+static mutex_t _res = MUTEX_INIT;
+static uint32_t _wait_max;
+
+static void _busy(uint32_t us)
+{
+    uint32_t start = xtimer_now_usec();
+
+    while ((xtimer_now_usec() - start) < us) {}
+}
+
+static void *_low(void *arg)
+{
+    (void)arg;
+
+    while (1) {
+        thread_sleep();
+        mutex_lock(&_res);
+        /* high preempts us right away and blocks on the mutex */
+        thread_wakeup(_pid_high);
+        _busy(LOW_WORK_US);
+        mutex_unlock(&_res);
+    }
+
+    return NULL;
+}
+
+static void *_mid(void *arg)
+{
+    (void)arg;
+
+    while (1) {
+        thread_sleep();
+        _busy(MID_BUSY_US);
+    }
+
+    return NULL;
+}
+
+static void *_high(void *arg)
+{
+    (void)arg;
+
+    while (1) {
+        thread_sleep();
+        /* mid becomes runnable while low holds the mutex */
+        thread_wakeup(_pid_mid);
+
+        uint32_t start = xtimer_now_usec();
+        mutex_lock(&_res);
+        uint32_t wait = xtimer_now_usec() - start;
+        mutex_unlock(&_res);
+
+        if (wait > _wait_max) {
+            _wait_max = wait;
+        }
+    }
+
+    return NULL;
+}
+
+#ifdef MODULE_CORE_MUTEX_PRIORITY_INHERITANCE
+static char _stack_waiter[THREAD_STACKSIZE_DEFAULT];
+static mutex_t _a = MUTEX_INIT;
+static mutex_t _b = MUTEX_INIT;
+static mutex_t *_waited;
+
+static void *_waiter(void *arg)
+{
+    (void)arg;
+
+    while (1) {
+        thread_sleep();
+        mutex_lock(_waited);
+        mutex_unlock(_waited);
+    }
+
+    return NULL;
+}
+
+/* locks _a and _b, lets a higher priority thread block on waited and
+ * unlocks the other mutex first. Returns 1 if main keeps the waiter's
+ * priority until it unlocks waited and gets its own back afterwards */
+static int _unlock_out_of_order(kernel_pid_t waiter, mutex_t *waited,
+                                mutex_t *other)
+{
+    volatile thread_t *me = thread_get(thread_getpid());
+    int res = 1;
+
+    mutex_lock(&_a);
+    mutex_lock(&_b);
+    _waited = waited;
+    /* preempts us and blocks on waited */
+    thread_wakeup(waiter);
+    mutex_unlock(other);
+    if (me->priority != THREAD_PRIORITY_MAIN - 3) {
+        printf("lost inherited priority: %u\n", (unsigned)me->priority);
+        res = 0;
+    }
+    mutex_unlock(waited);
+    if (me->priority != THREAD_PRIORITY_MAIN) {
+        printf("kept inherited priority: %u\n", (unsigned)me->priority);
+        res = 0;
+    }
+    return res;
+}
+#endif
+
+int main(void)
+{
+#ifdef MODULE_CORE_MUTEX_PRIORITY_INHERITANCE
+    puts("mutex priority inheritance: enabled");
+
+    kernel_pid_t waiter = thread_create(_stack_waiter, sizeof(_stack_waiter),
+                                        THREAD_PRIORITY_MAIN - 3,
+                                        THREAD_CREATE_STACKTEST,
+                                        _waiter, NULL, "waiter");
+
+    if (!_unlock_out_of_order(waiter, &_a, &_b) ||
+        !_unlock_out_of_order(waiter, &_b, &_a)) {
+        puts("[FAILURE] wrong priority after unlocking out of order");
+        return 0;
+    }
+    puts("priority after unlocking out of order: ok");
+#else
+    puts("mutex priority inheritance: disabled");
+#endif
+
+    _pid_low = thread_create(_stack_low, sizeof(_stack_low),
+                             THREAD_PRIORITY_MAIN - 1,
+                             THREAD_CREATE_SLEEPING | THREAD_CREATE_STACKTEST,
+                             _low, NULL, "low");
+    _pid_mid = thread_create(_stack_mid, sizeof(_stack_mid),
+                             THREAD_PRIORITY_MAIN - 2,
+                             THREAD_CREATE_SLEEPING | THREAD_CREATE_STACKTEST,
+                             _mid, NULL, "mid");
+    _pid_high = thread_create(_stack_high, sizeof(_stack_high),
+                              THREAD_PRIORITY_MAIN - 3,
+                              THREAD_CREATE_SLEEPING | THREAD_CREATE_STACKTEST,
+                              _high, NULL, "high");
+
+    /* let each thread run up to its first thread_sleep() */
+    thread_wakeup(_pid_low);
+    thread_wakeup(_pid_mid);
+    thread_wakeup(_pid_high);
+
+    for (unsigned i = 0; i < ROUNDS; i++) {
+        /* main has the lowest priority, so all threads are asleep again
+         * whenever this returns */
+        thread_wakeup(_pid_low);
+    }
+
+    printf("low work: %u us, mid busy: %u us\n",
+           (unsigned)LOW_WORK_US, (unsigned)MID_BUSY_US);
+    printf("worst case wait of high: %lu us\n", (unsigned long)_wait_max);
+    printf("{ \"result\" : %lu }\n", (unsigned long)_wait_max);
+
+    if (_wait_max < MID_BUSY_US) {
+        puts("[SUCCESS] priority inversion bounded");
+    }
+    else {
+        puts("[FAILURE] high waited for mid");
+    }
+
+    return 0;
+}
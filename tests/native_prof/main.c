@@ -0,0 +1,53 @@
+/*
+ * Copyright (C) 2026 agent <agent@local>
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Keeps the CPU busy for a while, so the instance started with
+ *              `--prof` has something to sample
+ *
+ * @author      agent <agent@local>
+ *
+ * @}
+ */
+
+#include <stdint.h>
+#include <stdio.h>
+
+#include "periph/pm.h"
+#include "xtimer.h"
+
+/* about 300 samples at the default NATIVE_PROF_HZ */
+#define BUSY_US     (300U * US_PER_MS)
+
+static volatile uint32_t _sink;
+
+static void _busy(uint32_t us)
+{
+    uint32_t start = xtimer_now_usec();
+
+    while ((xtimer_now_usec() - start) < us) {
+        for (unsigned i = 0; i < 1000; i++) {
+            _sink = (_sink * 1103515245U) + 12345U;
+        }
+    }
+}
+
+int main(void)
+{
+    puts("native_prof test application");
+    _busy(BUSY_US);
+    puts("done");
+    /* exiting writes the profile */
+    pm_off();
+
+    return 0;
+}
@@ -0,0 +1,41 @@
+#!/usr/bin/env python3
+
+# Copyright (C) 2026 agent <agent@local>
+#
+# This file is subject to the terms and conditions of the GNU Lesser
+# General Public License v2.1. See the file LICENSE in the top level
+# directory for more details.
+
+import os
+import re
+import sys
+import pexpect
+from testrunner import run
+
+PROF_FILE = os.environ["PROF_FILE"]
+
+
+def testfunc(child):
+    child.expect_exact("native_prof test application")
+    child.expect_exact("done")
+    child.expect_exact("native: exiting")
+    # the profile is written by an exit handler
+    child.expect(pexpect.EOF)
+
+    with open(PROF_FILE) as prof:
+        lines = prof.read().splitlines()
+    assert lines, "profile is empty"
+    samples = 0
+    for line in lines:
+        match = re.match(r"^[^;\s]+(;\S+)+ (\d+)$", line)
+        assert match, "malformed line: {}".format(line)
+        samples += int(match.group(2))
+    # most of the samples are taken while main is busy
+    assert any(line.startswith("main;") for line in lines)
+    print("{} samples in {} stacks".format(samples, len(lines)))
+
+
+if __name__ == "__main__":
+    if os.path.exists(PROF_FILE):
+        os.remove(PROF_FILE)
+    sys.exit(run(testfunc))
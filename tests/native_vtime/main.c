@@ -0,0 +1,54 @@
+/*
+ * Copyright (C) 2026 agent <agent@local>
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Test application for native's virtual time
+ *
+ * Sleeps for a simulated day, which must take no more than a few seconds of
+ * wall clock time.
+ *
+ * @author      agent <agent@local>
+ *
+ * @}
+ */
+
+#include <inttypes.h>
+#include <stdio.h>
+
+#include "xtimer.h"
+
+#define HOURS               (24U)
+#define SECONDS_PER_HOUR    (3600U)
+
+int main(void)
+{
+    puts("native_vtime test application");
+
+    for (unsigned hour = 1; hour <= HOURS; hour++) {
+        uint64_t before = xtimer_now_usec64();
+
+        xtimer_sleep(SECONDS_PER_HOUR);
+
+        uint64_t slept = xtimer_now_usec64() - before;
+        if ((slept < (uint64_t)SECONDS_PER_HOUR * US_PER_SEC) ||
+            (slept > ((uint64_t)SECONDS_PER_HOUR * US_PER_SEC) + US_PER_SEC)) {
+            printf("[FAILURE] slept %" PRIu32 " ms\n",
+                   (uint32_t)(slept / US_PER_MS));
+            return 1;
+        }
+        printf("hour %u\n", hour);
+    }
+
+    puts("[SUCCESS]");
+
+    return 0;
+}
@@ -0,0 +1,24 @@
+#!/usr/bin/env python3
+
+# Copyright (C) 2026 agent <agent@local>
+#
+# This file is subject to the terms and conditions of the GNU Lesser
+# General Public License v2.1. See the file LICENSE in the top level
+# directory for more details.
+
+import sys
+from testrunner import run
+
+HOURS = 24
+
+
+def testfunc(child):
+    child.expect_exact("native_vtime test application")
+    # a simulated day must pass in seconds
+    for hour in range(1, HOURS + 1):
+        child.expect_exact("hour {}\r\n".format(hour), timeout=5)
+    child.expect_exact("[SUCCESS]")
+
+
+if __name__ == "__main__":
+    sys.exit(run(testfunc))
@@ -31,6 +31,11 @@ PS_EXPECTED = (
     ('\t    | SUM                  |            |     | \d+  (\d+)')
 )
 
+HIST_EXPECTED = (
+    '\tscheduler histograms, column n counts [2^n, 2^(n+1)) ticks',
+    '\tpid | hist  |      0      1      2      3',
+)
+
 
 def _check_startup(child):
     for i in range(5):
@@ -53,6 +58,11 @@ def _check_ps(child):
     child.sendline('ps')
     for line in PS_EXPECTED:
         child.expect(line)
+    for line in HIST_EXPECTED:
+        child.expect_exact(line)
+    for pid in range(1, 8):
+        child.expect(r'\t{:3d} \| wake  \|( +\d+)+'.format(pid))
+        child.expect(r'\t    \| slice \|( +\d+)+')
 
 
 def testfunc(child):
@@ -0,0 +1,74 @@
+/*
+ * Copyright (C) 2026 agent <agent@local>
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Trace recorder test application
+ *
+ * @author      agent <agent@local>
+ *
+ * @}
+ */
+
+#include <stdio.h>
+
+#include "msg.h"
+#include "thread.h"
+#include "trace_rec.h"
+
+#define MSG_TYPE_PING       (0x1234)
+#define ROUNDS              (3U)
+
+static char _stack[THREAD_STACKSIZE_DEFAULT];
+
+static void *_pong(void *arg)
+{
+    (void)arg;
+    msg_t m, reply = { .type = MSG_TYPE_PING + 1 };
+
+    while (1) {
+        msg_receive(&m);
+        trace_rec_span_begin("pong");
+        msg_reply(&m, &reply);
+        trace_rec_span_end("pong");
+    }
+
+    return NULL;
+}
+
+static void _write(void *arg, const char *buf, size_t len)
+{
+    (void)arg;
+    printf("%.*s", (int)len, buf);
+}
+
+int main(void)
+{
+    kernel_pid_t pid = thread_create(_stack, sizeof(_stack),
+                                     THREAD_PRIORITY_MAIN - 1,
+                                     THREAD_CREATE_STACKTEST,
+                                     _pong, NULL, "pong");
+
+    trace_rec_clear();
+
+    for (unsigned i = 0; i < ROUNDS; i++) {
+        msg_t m = { .type = MSG_TYPE_PING }, reply;
+        trace_rec_span_begin("ping");
+        msg_send_receive(&m, &reply, pid);
+        trace_rec_span_end("ping");
+    }
+
+    puts("dump start");
+    trace_rec_dump(_write, NULL);
+    puts("dump end");
+
+    return 0;
+}
@@ -0,0 +1,36 @@
+#!/usr/bin/env python3
+
+# Copyright (C) 2026 agent <agent@local>
+#
+# This file is subject to the terms and conditions of the GNU Lesser
+# General Public License v2.1. See the file LICENSE in the top level
+# directory for more details.
+
+import sys
+from testrunner import run
+
+ROUNDS = 3
+
+
+def testfunc(child):
+    child.expect_exact("dump start")
+    child.expect(r"# trace_rec 1 \d+ (\d+)\r\n")
+    child.expect(r"T 2 (main|-)\r\n")
+    child.expect(r"T 3 (pong|-)\r\n")
+    for _ in range(ROUNDS):
+        child.expect(r"\d+ span_begin 2 0 \d+ ping\r\n")
+        # 0x1234 == 4660
+        child.expect(r"\d+ msg_send 2 3 4660 \r\n")
+        child.expect(r"\d+ switch 3 2 0 \r\n")
+        child.expect(r"\d+ msg_recv 3 2 4660 \r\n")
+        child.expect(r"\d+ span_begin 3 0 \d+ pong\r\n")
+        child.expect(r"\d+ msg_send 3 2 4661 \r\n")
+        child.expect(r"\d+ span_end 3 0 \d+ pong\r\n")
+        child.expect(r"\d+ switch 2 3 0 \r\n")
+        child.expect(r"\d+ msg_recv 2 3 4661 \r\n")
+        child.expect(r"\d+ span_end 2 0 \d+ ping\r\n")
+    child.expect_exact("dump end")
+
+
+if __name__ == "__main__":
+    sys.exit(run(testfunc))
@@ -976,6 +976,125 @@ static void test_fib_20_replace_prefix(void)
     fib_deinit(&test_fib_table);
 }
 
+/*
+* @brief checking the memory usage statistics of the universal addresses
+* It is expected to count one entry per distinct address and one reference
+* per use of an address
+*/
+static void test_fib_22_universal_address_stats(void)
+{
+    universal_address_stats_t stats;
+    char addr[] = "Test address 22";
+
+    fib_init(&test_fib_table);
+    _fill_FIB_multiple(20, 11);
+
+    universal_address_get_stats(&stats);
+    TEST_ASSERT_EQUAL_INT(UNIVERSAL_ADDRESS_MAX_ENTRIES, stats.size);
+    TEST_ASSERT_EQUAL_INT(20, stats.used);
+    TEST_ASSERT_EQUAL_INT(20, stats.max_used);
+    TEST_ASSERT_EQUAL_INT(40, stats.refs);
+    TEST_ASSERT_EQUAL_INT(0, stats.failed);
+
+    universal_address_container_t *entry = universal_address_add((uint8_t *)addr,
+                                                                 sizeof(addr) - 1);
+    TEST_ASSERT_NOT_NULL(entry);
+    TEST_ASSERT(entry == universal_address_add((uint8_t *)addr, sizeof(addr) - 1));
+    TEST_ASSERT_EQUAL_INT(2, entry->use_count);
+
+    universal_address_get_stats(&stats);
+    TEST_ASSERT_EQUAL_INT(21, stats.used);
+    TEST_ASSERT_EQUAL_INT(21, stats.max_used);
+    TEST_ASSERT_EQUAL_INT(42, stats.refs);
+
+    universal_address_rem(entry);
+    universal_address_rem(entry);
+    fib_deinit(&test_fib_table);
+
+    universal_address_get_stats(&stats);
+    TEST_ASSERT_EQUAL_INT(0, stats.used);
+    TEST_ASSERT_EQUAL_INT(21, stats.max_used);
+    TEST_ASSERT_EQUAL_INT(0, stats.refs);
+}
+
+/*
+* @brief testing prefixes that end within the same byte of the address
+* It is expected to choose the entry with the most matching bits and, on a
+* tie, the entry that was added first
+*/
+static void test_fib_23_prefix_same_byte(void)
+{
+    size_t add_buf_size = 16;
+    uint8_t addr_dst[add_buf_size];
+    uint8_t addr_nxt_hop[add_buf_size];
+    uint8_t addr_nxt[add_buf_size];
+    uint8_t addr_lookup[add_buf_size];
+    kernel_pid_t iface_id = KERNEL_PID_UNDEF;
+    uint32_t next_hop_flags = 0;
+
+    fib_init(&test_fib_table);
+
+    /* 2001:db8::/32 over fe80::1 */
+    memset(addr_dst, 0, add_buf_size);
+    addr_dst[0] = 0x20;
+    addr_dst[1] = 0x01;
+    addr_dst[2] = 0x0d;
+    addr_dst[3] = 0xb8;
+    memset(addr_nxt, 0, add_buf_size);
+    addr_nxt[0] = 0xfe;
+    addr_nxt[1] = 0x80;
+    addr_nxt[15] = 0x01;
+    TEST_ASSERT_EQUAL_INT(0, fib_add_entry(&test_fib_table, 42, addr_dst,
+                                           add_buf_size,
+                                           (32 << FIB_FLAG_NET_PREFIX_SHIFT),
+                                           addr_nxt, add_buf_size, 0x0,
+                                           (uint32_t)FIB_LIFETIME_NO_EXPIRE));
+
+    /* 2001:db8:1000::/36 over fe80::2 */
+    addr_dst[4] = 0x10;
+    addr_nxt[15] = 0x02;
+    TEST_ASSERT_EQUAL_INT(0, fib_add_entry(&test_fib_table, 42, addr_dst,
+                                           add_buf_size,
+                                           (36 << FIB_FLAG_NET_PREFIX_SHIFT),
+                                           addr_nxt, add_buf_size, 0x0,
+                                           (uint32_t)FIB_LIFETIME_NO_EXPIRE));
+
+    /* 2001:db8:1000::1 shares most bits with the /36 */
+    memcpy(addr_lookup, addr_dst, add_buf_size);
+    addr_lookup[15] = 0x01;
+    TEST_ASSERT_EQUAL_INT(0, fib_get_next_hop(&test_fib_table, &iface_id,
+                                              addr_nxt_hop, &add_buf_size,
+                                              &next_hop_flags, addr_lookup,
+                                              add_buf_size, 0x0));
+    TEST_ASSERT_EQUAL_INT(0x02, addr_nxt_hop[15]);
+
+    /* 2001:db8:2000::1 shares as many bits with both, so the /32 wins */
+    addr_lookup[4] = 0x20;
+    add_buf_size = 16;
+    TEST_ASSERT_EQUAL_INT(0, fib_get_next_hop(&test_fib_table, &iface_id,
+                                              addr_nxt_hop, &add_buf_size,
+                                              &next_hop_flags, addr_lookup,
+                                              add_buf_size, 0x0));
+    TEST_ASSERT_EQUAL_INT(0x01, addr_nxt_hop[15]);
+
+    /* 2001:db9::1 is covered by neither */
+    addr_lookup[3] = 0xb9;
+    add_buf_size = 16;
+    TEST_ASSERT_EQUAL_INT(-EHOSTUNREACH,
+                          fib_get_next_hop(&test_fib_table, &iface_id,
+                                           addr_nxt_hop, &add_buf_size,
+                                           &next_hop_flags, addr_lookup,
+                                           add_buf_size, 0x0));
+
+#if (TEST_FIB_SHOW_OUTPUT == 1)
+    fib_print_fib_table(&test_fib_table);
+    puts("");
+    universal_address_print_table();
+    puts("");
+#endif
+    fib_deinit(&test_fib_table);
+}
+
 Test *tests_fib_tests(void)
 {
     fib_init(&test_fib_table);
@@ -1000,6 +1119,8 @@ Test *tests_fib_tests(void)
                         new_TestFixture(test_fib_18_get_next_hop_invalid_parameters),
                         new_TestFixture(test_fib_19_default_gateway),
                         new_TestFixture(test_fib_20_replace_prefix),
+                        new_TestFixture(test_fib_22_universal_address_stats),
+                        new_TestFixture(test_fib_23_prefix_same_byte),
     };
 
     EMB_UNIT_TESTCALLER(fib_tests, NULL, NULL, fixtures);
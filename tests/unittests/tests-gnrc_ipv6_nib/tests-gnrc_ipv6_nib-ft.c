@@ -178,6 +178,106 @@ static void test_nib_ft_get__success4(void)
     TEST_ASSERT_EQUAL_INT(IFACE, fte.iface);
 }
 
+/*
+ * Adds four routes with nested prefixes of different lengths, not ordered by
+ * their length, then tries to get routes for addresses that match some of
+ * them.
+ * Expected result: gnrc_ipv6_nib_ft_get() returns the route with the longest
+ * matching prefix
+ */
+static void test_nib_ft_get__success5(void)
+{
+    static const uint8_t pfx_lens[] = { 32, 64, 16, 48 };
+    gnrc_ipv6_nib_ft_t fte;
+    ipv6_addr_t dst = { .u64 = { { .u8 = GLOBAL_PREFIX },
+                                 { .u64 = TEST_UINT64 } } };
+    ipv6_addr_t next_hop = { .u64 = { { .u8 = LINK_LOCAL_PREFIX },
+                                      { .u64 = TEST_UINT64 } } };
+
+    dst.u16[2].u16 = 0x0101;
+    dst.u16[3].u16 = 0x0202;
+    for (unsigned i = 0; i < sizeof(pfx_lens); i++) {
+        /* next hop identifies the route by its prefix length */
+        next_hop.u8[15] = pfx_lens[i];
+        TEST_ASSERT_EQUAL_INT(0, gnrc_ipv6_nib_ft_add(&dst, pfx_lens[i],
+                                                      &next_hop, IFACE, 0));
+    }
+    TEST_ASSERT_EQUAL_INT(0, gnrc_ipv6_nib_ft_get(&dst, NULL, &fte));
+    TEST_ASSERT_EQUAL_INT(64, fte.dst_len);
+    TEST_ASSERT_EQUAL_INT(64, fte.next_hop.u8[15]);
+    /* only matches the routes up to /48 */
+    dst.u16[3].u16++;
+    TEST_ASSERT_EQUAL_INT(0, gnrc_ipv6_nib_ft_get(&dst, NULL, &fte));
+    TEST_ASSERT_EQUAL_INT(48, fte.dst_len);
+    TEST_ASSERT_EQUAL_INT(48, fte.next_hop.u8[15]);
+    /* only matches the routes up to /32 */
+    dst.u16[2].u16++;
+    TEST_ASSERT_EQUAL_INT(0, gnrc_ipv6_nib_ft_get(&dst, NULL, &fte));
+    TEST_ASSERT_EQUAL_INT(32, fte.dst_len);
+    TEST_ASSERT_EQUAL_INT(32, fte.next_hop.u8[15]);
+    /* only matches the /16 route */
+    dst.u16[1].u16++;
+    TEST_ASSERT_EQUAL_INT(0, gnrc_ipv6_nib_ft_get(&dst, NULL, &fte));
+    TEST_ASSERT_EQUAL_INT(16, fte.dst_len);
+    TEST_ASSERT_EQUAL_INT(16, fte.next_hop.u8[15]);
+}
+
+/*
+ * Adds routes with nested prefixes of different lengths, removes the one
+ * with the longest prefix, then tries to get a route for an address that
+ * matched it.
+ * Expected result: gnrc_ipv6_nib_ft_get() returns the route with the next
+ * shorter prefix
+ */
+static void test_nib_ft_get__success6(void)
+{
+    gnrc_ipv6_nib_ft_t fte;
+    static const ipv6_addr_t dst = { .u64 = { { .u8 = GLOBAL_PREFIX },
+                                              { .u64 = TEST_UINT64 } } };
+    static const ipv6_addr_t next_hop1 = { .u64 = { { .u8 = LINK_LOCAL_PREFIX },
+                                                  { .u64 = TEST_UINT64 } } };
+    static const ipv6_addr_t next_hop2 = { .u64 = { { .u8 = LINK_LOCAL_PREFIX },
+                                                  { .u64 = TEST_UINT64 + 1 } } };
+
+    TEST_ASSERT_EQUAL_INT(0, gnrc_ipv6_nib_ft_add(&dst, GLOBAL_PREFIX_LEN,
+                                                  &next_hop1, IFACE, 0));
+    TEST_ASSERT_EQUAL_INT(0, gnrc_ipv6_nib_ft_add(&dst, 64,
+                                                  &next_hop2, IFACE, 0));
+    TEST_ASSERT_EQUAL_INT(0, gnrc_ipv6_nib_ft_get(&dst, NULL, &fte));
+    TEST_ASSERT_EQUAL_INT(64, fte.dst_len);
+    gnrc_ipv6_nib_ft_del(&dst, 64);
+    TEST_ASSERT_EQUAL_INT(0, gnrc_ipv6_nib_ft_get(&dst, NULL, &fte));
+    TEST_ASSERT(ipv6_addr_equal(&next_hop1, &fte.next_hop));
+    TEST_ASSERT_EQUAL_INT(GLOBAL_PREFIX_LEN, fte.dst_len);
+}
+
+/*
+ * Adds routes with the same prefix length and different prefixes, more than
+ * there are hash buckets, then tries to get a route for an address of each
+ * prefix.
+ * Expected result: gnrc_ipv6_nib_ft_get() returns the route of the prefix
+ */
+static void test_nib_ft_get__success_hash_collision(void)
+{
+    gnrc_ipv6_nib_ft_t fte;
+    ipv6_addr_t dst = { .u64 = { { .u8 = GLOBAL_PREFIX },
+                                 { .u64 = TEST_UINT64 } } };
+    static const ipv6_addr_t next_hop = { .u64 = { { .u8 = LINK_LOCAL_PREFIX },
+                                                 { .u64 = TEST_UINT64 } } };
+
+    for (unsigned i = 0; i < GNRC_IPV6_NIB_OFFL_NUMOF; i++) {
+        dst.u16[3].u16 = i;
+        TEST_ASSERT_EQUAL_INT(0, gnrc_ipv6_nib_ft_add(&dst, 64, &next_hop,
+                                                      IFACE, 0));
+    }
+    for (unsigned i = 0; i < GNRC_IPV6_NIB_OFFL_NUMOF; i++) {
+        dst.u16[3].u16 = i;
+        TEST_ASSERT_EQUAL_INT(0, gnrc_ipv6_nib_ft_get(&dst, NULL, &fte));
+        TEST_ASSERT_EQUAL_INT(64, fte.dst_len);
+        TEST_ASSERT(ipv6_addr_match_prefix(&dst, &fte.dst) >= 64);
+    }
+}
+
 /*
  * Tries to create a forwarding table entry for the default route (::) with
  * NULL as next hop.
@@ -727,6 +827,9 @@ Test *tests_gnrc_ipv6_nib_ft_tests(void)
         new_TestFixture(test_nib_ft_get__success2),
         new_TestFixture(test_nib_ft_get__success3),
         new_TestFixture(test_nib_ft_get__success4),
+        new_TestFixture(test_nib_ft_get__success5),
+        new_TestFixture(test_nib_ft_get__success6),
+        new_TestFixture(test_nib_ft_get__success_hash_collision),
         new_TestFixture(test_nib_ft_add__EINVAL_def_route_next_hop_NULL),
         new_TestFixture(test_nib_ft_add__EINVAL_iface0),
         new_TestFixture(test_nib_ft_add__ENOMEM_diff_def_router),
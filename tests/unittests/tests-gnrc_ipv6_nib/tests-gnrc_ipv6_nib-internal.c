@@ -343,6 +343,82 @@ static void test_nib_get__success(void)
     TEST_ASSERT(nib_alloced == nib_got);
 }
 
+/*
+ * Creates GNRC_IPV6_NIB_NUMOF entries with different IP addresses, more than
+ * there are hash buckets, and then tries to get all of them.
+ * Expected result: _nib_onl_get() returns the entry of each address
+ */
+static void test_nib_get__success_hash_collision(void)
+{
+    _nib_onl_entry_t *nodes[GNRC_IPV6_NIB_NUMOF];
+    ipv6_addr_t addr = { .u64 = { { .u8 = GLOBAL_PREFIX },
+                                  { .u64 = TEST_UINT64 } } };
+
+    for (int i = 0; i < GNRC_IPV6_NIB_NUMOF; i++) {
+        TEST_ASSERT_NOT_NULL((nodes[i] = _nib_onl_alloc(&addr, IFACE)));
+        nodes[i]->mode = _NC;
+        addr.u64[1].u64++;
+    }
+    addr.u64[1].u64 = TEST_UINT64;
+    for (int i = 0; i < GNRC_IPV6_NIB_NUMOF; i++) {
+        TEST_ASSERT(nodes[i] == _nib_onl_get(&addr, IFACE));
+        addr.u64[1].u64++;
+    }
+}
+
+/*
+ * Creates GNRC_IPV6_NIB_NUMOF entries with different IP addresses, clears
+ * every second one and then tries to get all of them.
+ * Expected result: _nib_onl_get() returns NULL for the cleared entries and
+ * the entry of the address for the others
+ */
+static void test_nib_get__success_cleared_hash_collision(void)
+{
+    _nib_onl_entry_t *nodes[GNRC_IPV6_NIB_NUMOF];
+    ipv6_addr_t addr = { .u64 = { { .u8 = GLOBAL_PREFIX },
+                                  { .u64 = TEST_UINT64 } } };
+
+    for (int i = 0; i < GNRC_IPV6_NIB_NUMOF; i++) {
+        TEST_ASSERT_NOT_NULL((nodes[i] = _nib_onl_alloc(&addr, IFACE)));
+        nodes[i]->mode = _NC;
+        addr.u64[1].u64++;
+    }
+    for (int i = 0; i < GNRC_IPV6_NIB_NUMOF; i += 2) {
+        nodes[i]->mode = _EMPTY;
+        TEST_ASSERT(_nib_onl_clear(nodes[i]));
+    }
+    addr.u64[1].u64 = TEST_UINT64;
+    for (int i = 0; i < GNRC_IPV6_NIB_NUMOF; i++) {
+        if ((i % 2) == 0) {
+            TEST_ASSERT_NULL(_nib_onl_get(&addr, IFACE));
+        }
+        else {
+            TEST_ASSERT(nodes[i] == _nib_onl_get(&addr, IFACE));
+        }
+        addr.u64[1].u64++;
+    }
+}
+
+/*
+ * Creates a persistent on-link entry with no IPv6 address, then creates
+ * another one with the same interface, but with an address, and then tries
+ * to get the entry by that address.
+ * Expected result: _nib_onl_get() returns NULL before and the entry after its
+ * address was set
+ */
+static void test_nib_get__success_noaddr_override(void)
+{
+    _nib_onl_entry_t *node;
+    static const ipv6_addr_t addr = { .u64 = { { .u8 = GLOBAL_PREFIX },
+                                               { .u64 = TEST_UINT64 } } };
+
+    TEST_ASSERT_NOT_NULL((node = _nib_onl_alloc(NULL, IFACE)));
+    node->mode = _NC;
+    TEST_ASSERT_NULL(_nib_onl_get(&addr, IFACE));
+    TEST_ASSERT(node == _nib_onl_alloc(&addr, IFACE));
+    TEST_ASSERT(node == _nib_onl_get(&addr, IFACE));
+}
+
 /*
  * Tries to get a NIB entry that is not in the NIB.
  * Expected result: _nib_onl_get() returns NULL
@@ -1929,6 +2005,9 @@ Test *tests_gnrc_ipv6_nib_internal_tests(void)
         new_TestFixture(test_nib_get__empty),
         new_TestFixture(test_nib_get__not_in_nib),
         new_TestFixture(test_nib_get__success),
+        new_TestFixture(test_nib_get__success_hash_collision),
+        new_TestFixture(test_nib_get__success_cleared_hash_collision),
+        new_TestFixture(test_nib_get__success_noaddr_override),
         new_TestFixture(test_nib_nc_add__no_space_left_diff_addr),
         new_TestFixture(test_nib_nc_add__no_space_left_diff_iface),
         new_TestFixture(test_nib_nc_add__no_space_left_diff_addr_iface),
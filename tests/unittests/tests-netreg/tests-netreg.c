@@ -21,6 +21,9 @@
 #include "unittests-constants.h"
 #include "tests-netreg.h"
 
+/* enough entries for several in every bucket */
+#define MANY_NUMOF  (4 * GNRC_NETREG_BUCKETS)
+
 static gnrc_netreg_entry_t entries[] = {
     GNRC_NETREG_ENTRY_INIT_PID(TEST_UINT16, TEST_UINT8),
     GNRC_NETREG_ENTRY_INIT_PID(TEST_UINT16, TEST_UINT8 + 1)
@@ -139,6 +142,34 @@ void test_netreg_getnext__2_entries(void)
     TEST_ASSERT_NOT_NULL(gnrc_netreg_getnext(res));
 }
 
+void test_netreg_lookup__many_entries(void)
+{
+    static gnrc_netreg_entry_t many[MANY_NUMOF];
+    gnrc_netreg_entry_t *res;
+
+    for (unsigned i = 0; i < MANY_NUMOF; i++) {
+        /* every demux context twice */
+        gnrc_netreg_entry_init_pid(&many[i], TEST_UINT16 + (i / 2), i);
+        TEST_ASSERT_EQUAL_INT(0, gnrc_netreg_register(GNRC_NETTYPE_TEST, &many[i]));
+    }
+    for (unsigned i = 0; i < MANY_NUMOF; i += 2) {
+        /* latest registration first */
+        TEST_ASSERT((res = gnrc_netreg_lookup(GNRC_NETTYPE_TEST,
+                                              TEST_UINT16 + (i / 2))) == &many[i + 1]);
+        TEST_ASSERT(gnrc_netreg_getnext(res) == &many[i]);
+        TEST_ASSERT_NULL(gnrc_netreg_getnext(&many[i]));
+        TEST_ASSERT_EQUAL_INT(2, gnrc_netreg_num(GNRC_NETTYPE_TEST, TEST_UINT16 + (i / 2)));
+    }
+    TEST_ASSERT_NULL(gnrc_netreg_lookup(GNRC_NETTYPE_TEST,
+                                        TEST_UINT16 + MANY_NUMOF));
+    for (unsigned i = 0; i < MANY_NUMOF; i += 2) {
+        gnrc_netreg_unregister(GNRC_NETTYPE_TEST, &many[i + 1]);
+        TEST_ASSERT(gnrc_netreg_lookup(GNRC_NETTYPE_TEST, TEST_UINT16 + (i / 2)) == &many[i]);
+        gnrc_netreg_unregister(GNRC_NETTYPE_TEST, &many[i]);
+        TEST_ASSERT_NULL(gnrc_netreg_lookup(GNRC_NETTYPE_TEST, TEST_UINT16 + (i / 2)));
+    }
+}
+
 Test *tests_netreg_tests(void)
 {
     EMB_UNIT_TESTFIXTURES(fixtures) {
@@ -155,6 +186,7 @@ Test *tests_netreg_tests(void)
         new_TestFixture(test_netreg_num__2_entries),
         new_TestFixture(test_netreg_getnext__NULL),
         new_TestFixture(test_netreg_getnext__2_entries),
+        new_TestFixture(test_netreg_lookup__many_entries),
     };
 
     EMB_UNIT_TESTCALLER(netreg_tests, set_up, NULL, fixtures);
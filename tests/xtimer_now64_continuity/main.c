@@ -28,6 +28,34 @@
 #define ITERATIONS  (100000LU)
 #define MAXDIFF     (1000U)
 
+/* interval of the timer interrupt load, which concurrently reads
+ * xtimer_now64() from interrupt context */
+#ifndef ISR_INTERVAL
+#define ISR_INTERVAL    (500U)
+#endif
+
+static xtimer_t _isr_timer;
+static volatile int _isr_running = 1;
+static volatile uint32_t _isr_calls;
+static volatile uint32_t _isr_errors;
+static xtimer_ticks64_t _isr_last;
+
+static void _isr_cb(void *arg)
+{
+    (void)arg;
+    xtimer_ticks64_t now = xtimer_now64();
+
+    if (now.ticks64 < _isr_last.ticks64) {
+        _isr_errors++;
+    }
+    _isr_last = now;
+    _isr_calls++;
+
+    if (_isr_running) {
+        xtimer_set(&_isr_timer, ISR_INTERVAL);
+    }
+}
+
 int main(void)
 {
     uint32_t n = ITERATIONS;
@@ -35,6 +63,8 @@ int main(void)
     uint64_t diff_max = 0;
     uint64_t diff_sum = 0;
     print_str("[START]\n");
+    _isr_timer.callback = _isr_cb;
+    xtimer_set(&_isr_timer, ISR_INTERVAL);
     xtimer_ticks64_t before = xtimer_now64();
     while(--n) {
         xtimer_ticks64_t now = xtimer_now64();
@@ -48,6 +78,8 @@ int main(void)
         diff_sum += diff.ticks64;
         before = now;
     }
+    _isr_running = 0;
+    xtimer_remove(&_isr_timer);
     print_str("[RESULTS] min=");
     print_u64_dec(diff_min);
     print_str(", avg=");
@@ -55,7 +87,13 @@ int main(void)
     print_str(", max=");
     print_u64_dec(diff_max);
     print_str("\n");
-    if ((diff_max > MAXDIFF) || (diff_sum/ITERATIONS > MAXDIFF)) {
+    print_str("[ISR] calls=");
+    print_u32_dec(_isr_calls);
+    print_str(", errors=");
+    print_u32_dec(_isr_errors);
+    print_str("\n");
+    if ((diff_max > MAXDIFF) || (diff_sum/ITERATIONS > MAXDIFF) ||
+        (_isr_calls == 0) || _isr_errors) {
         print_str("[FAILURE]\n");
         return 1;
     }
@@ -13,6 +13,7 @@ from testrunner import run
 def testfunc(child):
     child.expect_exact("[START]")
     child.expect(u"\[RESULTS\] min=\d+, avg=\d+, max=\d+")
+    child.expect(u"\[ISR\] calls=\d+, errors=0")
     child.expect_exact("[SUCCESS]")
 
 